@@ -0,0 +1,160 @@
+#pragma once
+
+#include <type_traits>
+
+/**
+ * @brief Width in bytes of the native SIMD register used by `Sglty::Simd`.
+ *
+ * Detected from the target instruction set (AVX-512, AVX, SSE2 or NEON) and
+ * only enabled for compilers with GNU vector extensions. May be defined before
+ * including Singularity to override the detection; `0` disables packet
+ * evaluation entirely.
+ */
+#ifndef SGLTY_SIMD_BYTES
+#if defined(__GNUC__) || defined(__clang__)
+#if defined(__AVX512F__)
+#define SGLTY_SIMD_BYTES 64
+#elif defined(__AVX__)
+#define SGLTY_SIMD_BYTES 32
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+#define SGLTY_SIMD_BYTES 16
+#else
+#define SGLTY_SIMD_BYTES 0
+#endif
+#else
+#define SGLTY_SIMD_BYTES 0
+#endif
+#endif
+
+/**
+ * @brief Whether the target computes fused multiply-adds in hardware.
+ *
+ * When non-zero, `Sglty::Simd::Fma` rounds `a * b + c` once through
+ * `std::fma`; otherwise it multiplies and adds separately, since `std::fma`
+ * would fall back to a slow software routine. Detected from the FMA (x86) and
+ * Arm FMA target features. May be defined before including Singularity to
+ * override the detection.
+ */
+#ifndef SGLTY_FMA
+#if defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+#define SGLTY_FMA 1
+#else
+#define SGLTY_FMA 0
+#endif
+#endif
+
+/**
+ * @brief Estimated scalar operations above which an evaluation is split into
+ * panels run through `Sglty::Exec::GetExecutor()`.
+ *
+ * Smaller evaluations, and every constant evaluation, stay on the calling
+ * thread. May be defined before including Singularity; `0` disables parallel
+ * evaluation entirely.
+ */
+#ifndef SGLTY_PARALLEL_THRESHOLD
+#define SGLTY_PARALLEL_THRESHOLD (1 << 18)
+#endif
+
+/**
+ * @brief Estimated scalar operations per panel of a parallel evaluation.
+ *
+ * Panels only depend on the shape of the result and on this value, never on
+ * the executor or its thread count (see `Sglty::Exec::PanelSize`).
+ */
+#ifndef SGLTY_PARALLEL_GRAIN
+#define SGLTY_PARALLEL_GRAIN (1 << 15)
+#endif
+
+/**
+ * @brief Elements above which a strided element-wise evaluation, e.g.
+ * `Trp(a) + b`, first copies its transposed operands.
+ *
+ * Transposes read across the storage order of their operand, so large ones
+ * are evaluated into temporaries through the tiled `Sglty::Kernel::Copy`
+ * before the rest of the expression is evaluated contiguously (see
+ * `Sglty::Traits::Expr::access_v`). May be defined before including
+ * Singularity; `0` keeps such evaluations lazy.
+ */
+#ifndef SGLTY_STRIDED_THRESHOLD
+#define SGLTY_STRIDED_THRESHOLD (1 << 14)
+#endif
+
+/**
+ * @brief Instrumentation level of `Sglty::Trace`.
+ *
+ * `0` (the default) compiles every hook away. `1` counts evaluations,
+ * temporaries, bytes and FLOPs per `Sglty::Trace::Kind`; `2` also times the
+ * instrumented regions and reports them to the sink installed with
+ * `Sglty::Trace::SetSink()`. Constant evaluations are never instrumented.
+ */
+#ifndef SGLTY_INSTRUMENT
+#define SGLTY_INSTRUMENT 0
+#endif
+
+/**
+ * @brief Largest fixed extent for which evaluation loops are fully unrolled.
+ *
+ * Applies to the elements traversed by `Sglty::Types::Traverse` and compared
+ * by `IsEqual` (`rows * cols`), to the inner dimension of `MulMatrix`
+ * elements and to the diagonal of `Identity()`. See
+ * `Sglty::Traits::Size::is_unrolled_v`. May be defined before including
+ * Singularity; `0` disables unrolling.
+ */
+#ifndef SGLTY_UNROLL_LIMIT
+#define SGLTY_UNROLL_LIMIT 16
+#endif
+
+/**
+ * @brief Extent of the square tiles of cores stored
+ * `Sglty::Core::Major::Tiled`.
+ *
+ * Edge tiles are padded to the full extent. The default keeps a tile row of
+ * `double` within one 64-byte cache line. May be defined before including
+ * Singularity; must be positive and the same in every translation unit.
+ */
+#ifndef SGLTY_TILE_EXTENT
+#define SGLTY_TILE_EXTENT 8
+#endif
+
+namespace Sglty::Config {
+
+/**
+ * @brief Detects whether the call happens during constant evaluation.
+ *
+ * Portable wrapper around `std::is_constant_evaluated()` that also works in
+ * C++17 mode through the compiler builtin. Used to keep the naive, constexpr
+ * friendly evaluation paths for compile-time computation while runtime calls
+ * are routed to optimized kernels.
+ *
+ * @return `true` if evaluated as part of a constant expression.
+ */
+constexpr bool IsConstantEvaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+  return std::is_constant_evaluated();
+#else
+  return __builtin_is_constant_evaluated();
+#endif
+}
+
+/**
+ * @brief Reinterprets the object representation of `_from` as a `_To`.
+ *
+ * Portable wrapper around `std::bit_cast()` that also works in C++17 mode
+ * through the compiler builtin, so bit-level conversions (e.g. of
+ * `Sglty::Core::BFloat16`) stay usable in constant expressions.
+ *
+ * @tparam _To   Destination type, of the same size as `_From`.
+ * @tparam _From Source type.
+ * @return The value of type `_To` with the bits of `_from`.
+ */
+template <typename _To, typename _From>
+constexpr _To BitCast(const _From& _from) noexcept {
+  static_assert(sizeof(_To) == sizeof(_From),
+                "Error: `_To` and `_From` have different sizes.");
+
+  return __builtin_bit_cast(_To, _from);
+}
+
+}  // namespace Sglty::Config
+
+// Singularity/Config.hpp
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 
 #include "Core/Enums.hpp"
 
@@ -9,8 +10,42 @@ namespace Sglty::Core {
 template <typename, std::size_t, std::size_t, Major>
 class Dense;
 
+template <typename, std::size_t, std::size_t, Major, std::size_t, bool>
+class DenseAligned;
+
+template <typename, std::size_t, std::size_t, Major, typename>
+class DenseHeap;
+
+template <typename, Major, typename>
+class Dynamic;
+
+template <typename, std::size_t, std::size_t, Major, std::size_t>
+class Sparse;
+
+template <typename, std::size_t, std::size_t, std::size_t, std::size_t>
+class Banded;
+
+template <typename, std::size_t>
+class Symmetric;
+
+template <typename, std::size_t, std::size_t, Major>
+class Map;
+
+template <typename, std::size_t, std::size_t, Major>
+class MapStrided;
+
+template <typename, Major, std::size_t>
+class Mapped;
+
 }  // namespace Sglty::Core
 
+namespace Sglty::Simd {
+
+template <typename, std::size_t>
+struct Lanes;
+
+}  // namespace Sglty::Simd
+
 namespace Sglty::Types {
 
 template <typename>
@@ -48,6 +83,290 @@ template <typename _Tp,
 using DenseMat =
     Sglty::Types::Matrix<Sglty::Core::Dense<_Tp, _rows, _cols, _core_major>>;
 
+/**
+ * @brief Convenience alias for a statically sized dense matrix with aligned,
+ * padded storage.
+ *
+ * Same as `DenseMat`, but backed by `Core::DenseAligned`: the buffer is
+ * aligned to `_alignment` bytes and each row (or column) is padded to a
+ * multiple of it.
+ *
+ * Example:
+ * ```cpp
+ * DenseAlignedMat<float, 100, 100> mat;  // rows padded to 112 floats
+ * ```
+ *
+ * @tparam _Tp         Value type (e.g., float, int, etc.)
+ * @tparam _rows       Number of rows (must be > 0)
+ * @tparam _cols       Number of columns (must be > 0)
+ * @tparam _core_major Memory layout (row-major or column-major)
+ * @tparam _alignment  Byte alignment of the storage (64 by default)
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major = Core::Major::Row,
+          std::size_t _alignment  = 64>
+using DenseAlignedMat = Sglty::Types::Matrix<
+    Sglty::Core::
+        DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, true>>;
+
+/**
+ * @brief Convenience alias for a statically sized dense matrix stored on the
+ * heap.
+ *
+ * Same as `DenseMat`, but backed by `Core::DenseHeap`, so large fixed-size
+ * matrices do not live on the stack and move in constant time.
+ *
+ * Example:
+ * ```cpp
+ * DenseHeapMat<double, 1024, 1024> big;  // 8 MB, heap-allocated
+ * ```
+ *
+ * @tparam _Tp         Value type (e.g., float, int, etc.)
+ * @tparam _rows       Number of rows (must be > 0)
+ * @tparam _cols       Number of columns (must be > 0)
+ * @tparam _core_major Memory layout (row-major or column-major)
+ * @tparam _Alloc      Allocator for the element buffer
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major = Core::Major::Row,
+          typename _Alloc         = std::allocator<_Tp>>
+using DenseHeapMat = Sglty::Types::Matrix<
+    Sglty::Core::DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>>;
+
+/**
+ * @brief Convenience alias for a dense matrix sized at runtime.
+ *
+ * `DynamicMat<T>` expands to a `Matrix` type backed by `Core::Dynamic`, whose
+ * shape is passed to the constructor instead of being part of the type.
+ *
+ * Example:
+ * ```cpp
+ * DynamicMat<double> mat(rows, cols);  // rows x cols, zero-initialized
+ * ```
+ *
+ * @tparam _Tp         Value type (e.g., float, int, etc.)
+ * @tparam _core_major Memory layout (row-major or column-major)
+ * @tparam _Alloc      Allocator for the element buffer
+ */
+template <typename _Tp,
+          Core::Major _core_major = Core::Major::Row,
+          typename _Alloc         = std::allocator<_Tp>>
+using DynamicMat =
+    Sglty::Types::Matrix<Sglty::Core::Dynamic<_Tp, _core_major, _Alloc>>;
+
+/**
+ * @brief Convenience alias for a statically sized compressed sparse matrix.
+ *
+ * `SparseMat<T, R, C, N>` expands to a `Matrix` type backed by `Core::Sparse`,
+ * storing at most `N` non-zero entries in CSR form (or CSC with
+ * `Core::Major::Col`).
+ *
+ * Example:
+ * ```cpp
+ * SparseMat<double, 1000, 1000, 5000> mat;  // up to 5000 non-zeros
+ * ```
+ *
+ * @tparam _Tp         Value type (e.g., float, int, etc.)
+ * @tparam _rows       Number of rows (must be > 0)
+ * @tparam _cols       Number of columns (must be > 0)
+ * @tparam _max_nnz    Maximum number of stored entries
+ * @tparam _core_major Compressed axis (`Row` for CSR, `Col` for CSC)
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _max_nnz,
+          Core::Major _core_major = Core::Major::Row>
+using SparseMat = Sglty::Types::Matrix<
+    Sglty::Core::Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>>;
+
+/**
+ * @brief Convenience alias for a statically sized banded matrix.
+ *
+ * `BandedMat<T, R, C, L, U>` expands to a `Matrix` type backed by
+ * `Core::Banded`, storing only the `L` diagonals below and the `U` diagonals
+ * above the main one; elements outside the band are zero.
+ *
+ * Example:
+ * ```cpp
+ * BandedMat<double, 100, 100, 1, 1> tri;  // tridiagonal, 298 elements
+ * ```
+ *
+ * @tparam _Tp    Value type (e.g., float, int, etc.)
+ * @tparam _rows  Number of rows (must be > 0)
+ * @tparam _cols  Number of columns (must be > 0)
+ * @tparam _lower Number of stored diagonals below the main one
+ * @tparam _upper Number of stored diagonals above the main one
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _lower,
+          std::size_t _upper>
+using BandedMat = Sglty::Types::Matrix<
+    Sglty::Core::Banded<_Tp, _rows, _cols, _lower, _upper>>;
+
+/**
+ * @brief Convenience alias for a statically sized diagonal matrix.
+ *
+ * Same as `BandedMat` with no diagonal but the main one: `_size` elements.
+ *
+ * Example:
+ * ```cpp
+ * DiagonalMat<float, 4> scale(2.0f);
+ * DenseMat<float, 4, 4> scaled = scale * mat;  // one multiply per element
+ * ```
+ *
+ * @tparam _Tp   Value type (e.g., float, int, etc.)
+ * @tparam _size Number of rows and columns (must be > 0)
+ */
+template <typename _Tp, std::size_t _size>
+using DiagonalMat = BandedMat<_Tp, _size, _size, 0, 0>;
+
+/**
+ * @brief Convenience alias for a statically sized upper triangular matrix.
+ *
+ * Same as `BandedMat` with the main diagonal and every one above it. Sums and
+ * products of upper triangular matrices stay upper triangular, and their
+ * transpose is a `LowerMat`.
+ *
+ * @tparam _Tp   Value type (e.g., float, int, etc.)
+ * @tparam _size Number of rows and columns (must be > 0)
+ */
+template <typename _Tp, std::size_t _size>
+using UpperMat = BandedMat<_Tp, _size, _size, 0, _size - 1>;
+
+/**
+ * @brief Convenience alias for a statically sized lower triangular matrix.
+ *
+ * Same as `BandedMat` with the main diagonal and every one below it. Sums and
+ * products of lower triangular matrices stay lower triangular, and their
+ * transpose is an `UpperMat`.
+ *
+ * @tparam _Tp   Value type (e.g., float, int, etc.)
+ * @tparam _size Number of rows and columns (must be > 0)
+ */
+template <typename _Tp, std::size_t _size>
+using LowerMat = BandedMat<_Tp, _size, _size, _size - 1, 0>;
+
+/**
+ * @brief Convenience alias for a statically sized symmetric matrix.
+ *
+ * `SymmetricMat<T, N>` expands to a `Matrix` type backed by
+ * `Core::Symmetric`, storing the upper triangle only; writing (i, j) also
+ * writes (j, i).
+ *
+ * Example:
+ * ```cpp
+ * SymmetricMat<double, 3> cov;
+ * cov(0, 2) = 0.5;  // cov(2, 0) == 0.5
+ * ```
+ *
+ * @tparam _Tp   Value type (e.g., float, int, etc.)
+ * @tparam _size Number of rows and columns (must be > 0)
+ */
+template <typename _Tp, std::size_t _size>
+using SymmetricMat = Sglty::Types::Matrix<Sglty::Core::Symmetric<_Tp, _size>>;
+
+/**
+ * @brief Convenience alias for a statically sized view over an external
+ * buffer.
+ *
+ * `MapMat<T, R, C>` expands to a `Matrix` type backed by `Core::Map`, which
+ * reads and writes `R * C` tightly packed elements owned by someone else.
+ *
+ * Example:
+ * ```cpp
+ * float buf[16];
+ * MapMat<float, 4, 4> mat(buf);        // no copy
+ * MapMat<const float, 4, 4> in(data);  // read-only
+ * ```
+ *
+ * @tparam _Tp         Value type, `const`-qualified for read-only buffers
+ * @tparam _rows       Number of rows (must be > 0)
+ * @tparam _cols       Number of columns (must be > 0)
+ * @tparam _core_major Memory layout (row-major or column-major)
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major = Core::Major::Row>
+using MapMat =
+    Sglty::Types::Matrix<Sglty::Core::Map<_Tp, _rows, _cols, _core_major>>;
+
+/**
+ * @brief Convenience alias for a statically sized view over an external
+ * buffer with a runtime leading dimension.
+ *
+ * Same as `MapMat`, but backed by `Core::MapStrided`: rows (or columns) start
+ * every `outer_stride` elements.
+ *
+ * Example:
+ * ```cpp
+ * MapStridedMat<double, 4, 4> tile(buf + offset, 256);
+ * ```
+ *
+ * @tparam _Tp         Value type, `const`-qualified for read-only buffers
+ * @tparam _rows       Number of rows (must be > 0)
+ * @tparam _cols       Number of columns (must be > 0)
+ * @tparam _core_major Memory layout (row-major or column-major)
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major = Core::Major::Row>
+using MapStridedMat = Sglty::Types::Matrix<
+    Sglty::Core::MapStrided<_Tp, _rows, _cols, _core_major>>;
+
+/**
+ * @brief Convenience alias for a dense matrix sized at runtime and stored in
+ * a memory mapping.
+ *
+ * `MappedMat<T>` expands to a `Matrix` type backed by `Core::Mapped`, which
+ * stores its elements in `_tile` x `_tile` tiles of an anonymous mapping or
+ * of a file. Include `Singularity/Core/Mapped.hpp` (POSIX) to use it.
+ *
+ * Example:
+ * ```cpp
+ * MappedMat<float> mat("features.bin", rows, cols);  // paged from the file
+ * ```
+ *
+ * @tparam _Tp         Value type (e.g., float, int, etc.)
+ * @tparam _core_major Order of tiles and of elements within a tile
+ * @tparam _tile       Extent of a tile
+ */
+template <typename _Tp,
+          Core::Major _core_major = Core::Major::Row,
+          std::size_t _tile       = 64>
+using MappedMat =
+    Sglty::Types::Matrix<Sglty::Core::Mapped<_Tp, _core_major, _tile>>;
+
+/**
+ * @brief Convenience alias for a batch of same-shaped matrices stored as
+ * structure-of-arrays.
+ *
+ * `BatchMat<M, N>` is `M` with its value type replaced by
+ * `Simd::Lanes<M::value_type, N>`: the same core family, shape and layout,
+ * holding `N` items side by side. Expressions over batches use the usual
+ * syntax and evaluate every item in one pass:
+ * ```cpp
+ * BatchMat<DenseMat<float, 4, 4>, 16> model, view;  // 16 transforms each
+ * BatchMat<DenseMat<float, 4, 4>, 16> mv = view * model;
+ * DenseMat<float, 4, 4> third = Item(mv, 2);        // see `Types::Item`
+ * ```
+ *
+ * @tparam _matrix The `Matrix` type of a single item.
+ * @tparam _count  Number of items in the batch.
+ */
+template <typename _matrix, std::size_t _count>
+using BatchMat = Sglty::Types::Matrix<
+    typename _matrix::core_impl::template core_rebind_value<
+        Sglty::Simd::Lanes<typename _matrix::value_type, _count>>>;
+
 }  // namespace Sglty
 
 // Singularity/Convenience.hpp
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+
+#include "Enums.hpp"
+#include "Dense.hpp"
+#include "Layout.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Mutable reference to an element of a `Banded` core.
+ *
+ * Refers to a stored element inside the band and to none outside it, where
+ * the element reads as zero and only zero may be written:
+ * ```
+ * Sglty::UpperMat<float, 3> u;
+ * float x = u(2, 0);  // 0
+ * u(2, 0) = 0.0f;     // fine
+ * u(2, 0) = 1.0f;     // throws std::invalid_argument
+ * ```
+ *
+ * @tparam _Tp The scalar element type.
+ */
+template <typename _Tp>
+class BandedReference {
+ public:
+  /**
+   * @brief Refers to `*_element`, or to an element outside the band if
+   * `_element` is `nullptr`.
+   *
+   * @param _element The stored element, if any.
+   */
+  constexpr explicit BandedReference(_Tp* _element);
+
+  constexpr BandedReference(const BandedReference&) = default;
+
+  /**
+   * @brief Reads the element, zero outside the band.
+   */
+  constexpr operator _Tp() const;
+
+  /**
+   * @brief Writes the element.
+   *
+   * @param _v The new value.
+   * @throws std::invalid_argument if the element is outside the band and
+   * `_v` is not zero.
+   */
+  constexpr BandedReference& operator=(const _Tp& _v);
+
+  /**
+   * @brief Writes the value of another element, as by `operator=(_Tp)`.
+   */
+  constexpr BandedReference& operator=(const BandedReference& _other);
+
+  constexpr BandedReference& operator+=(const _Tp& _v);
+  constexpr BandedReference& operator-=(const _Tp& _v);
+  constexpr BandedReference& operator*=(const _Tp& _v);
+  constexpr BandedReference& operator/=(const _Tp& _v);
+
+ private:
+  _Tp* _m_element;
+};
+
+/**
+ * @brief `type_traits` of a `Banded` core: those of `_Tp`, with
+ * `BandedReference` as the mutable reference.
+ *
+ * @tparam _Tp The scalar element type.
+ */
+template <typename _Tp>
+struct BandedTypeTraits : Traits::Type::Get<_Tp> {
+  using reference = BandedReference<_Tp>;
+};
+
+/**
+ * @brief Fixed-size band matrix core, storing only the elements of its band.
+ *
+ * Element (i, j) may be non-zero when it lies at most `_lower` diagonals
+ * below and `_upper` diagonals above the main one, `i - _lower <= j <= i +
+ * _upper`; every other element is zero. This covers the usual structures:
+ *
+ * - diagonal: `0`, `0` (`Sglty::DiagonalMat`)
+ *
+ * - upper triangular: `0`, `_cols - 1` (`Sglty::UpperMat`)
+ *
+ * - lower triangular: `_rows - 1`, `0` (`Sglty::LowerMat`)
+ *
+ * - banded, e.g. tridiagonal: `1`, `1` (`Sglty::BandedMat`)
+ *
+ * The elements of the band are stored row after row, each row from its first
+ * to its last column within the band, with no padding: a diagonal holds
+ * `_rows` elements, a triangle `_rows * (_rows + 1) / 2`.
+ *
+ * - the const `At()` returns a reference to a shared zero outside the band
+ *
+ * - the mutable `At()` returns a `BandedReference`, which reads as zero
+ *   outside the band and throws `std::invalid_argument` when a non-zero value
+ *   is written there; `Sglty::Types::Traverse` only visits the band, so
+ *   assigning an expression keeps the part of it within the band
+ *
+ * Products only read the operand elements inside the bands, so a diagonal
+ * times a dense matrix costs one multiply per result element and triangular
+ * products skip the zero triangles (see `Sglty::Expr::MulMatrix`). Sums,
+ * products and transposes of bands stay bands
+ * (see `Sglty::Traits::Core::sum_t`, `product_t` and `transpose_t`).
+ *
+ * @tparam _Tp    The scalar element type.
+ * @tparam _rows  The number of rows in the matrix.
+ * @tparam _cols  The number of columns in the matrix.
+ * @tparam _lower The number of sub-diagonals in the band.
+ * @tparam _upper The number of super-diagonals in the band.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _lower,
+          std::size_t _upper>
+class Banded {
+  static_assert(_lower < (_rows == 0 ? 1 : _rows) &&
+                    _upper < (_cols == 0 ? 1 : _cols),
+                "Error: the band is wider than the matrix.");
+
+ public:
+  /// Type traits for the matrix element type, see `BandedReference`.
+  using type_traits = BandedTypeTraits<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing the band and type identity.
+  using core_traits = Traits::Core::GetStructured<_lower, _upper, false>;
+
+  /**
+   * @brief Rebinds the core to a new size, the band clamped to fit it.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size =
+      Banded<_Tp,
+             _rebind_rows,
+             _rebind_cols,
+             Traits::Core::Impl::ClampBand(_lower, _rebind_rows),
+             Traits::Core::Impl::ClampBand(_upper, _rebind_cols)>;
+
+  /**
+   * @brief Rebinds the core to a new value type.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = Banded<_rebind_value, _rows, _cols, _lower, _upper>;
+
+  /**
+   * @brief Rebinds the core to a dense one of the same shape.
+   *
+   * @tparam _rebind_major The layout of the dense core.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Dense<_Tp, _rows, _cols, _rebind_major>;
+
+  /**
+   * @brief Rebinds the core to other bands.
+   *
+   * @tparam _rebind_lower The new number of sub-diagonals.
+   * @tparam _rebind_upper The new number of super-diagonals.
+   */
+  template <size_type _rebind_lower, size_type _rebind_upper>
+  using core_rebind_band =
+      Banded<_Tp, _rows, _cols, _rebind_lower, _rebind_upper>;
+
+  /**
+   * @brief The core of the transpose: the bands swap, so upper triangles
+   * become lower ones.
+   */
+  using core_transpose = Banded<_Tp, _cols, _rows, _upper, _lower>;
+
+  /**
+   * @brief Alias to a zero-sized base version, shared by all bands.
+   */
+  using core_base = Banded<_Tp, 0, 0, 0, 0>;
+
+  /**
+   * @brief Constructs a core whose band is zero.
+   */
+  constexpr Banded() = default;
+
+  /**
+   * @brief Constructs a core with all elements of the band set to a value.
+   *
+   * @param val The value to fill the band with.
+   */
+  constexpr Banded(value_type val);
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element; outside the band it reads as zero and
+   * throws `std::invalid_argument` when a non-zero value is written.
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element, or to zero outside the band.
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the stored elements.
+   *
+   * @return Mutable pointer to the band, row after row.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the stored elements.
+   *
+   * @return Const pointer to the band, row after row.
+   */
+  constexpr const_pointer Data() const;
+
+  /**
+   * @brief Whether element (_row, _col) lies within the band.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   */
+  static constexpr bool Contains(const size_type _row, const size_type _col);
+
+ private:
+  static constexpr value_type _m_zero{};
+
+  std::array<_Tp, Layout::BandOffset(_rows, _rows, _cols, _lower, _upper)>
+      _m_data{};
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Banded.tpp"
+
+// Singularity/Core/Banded.hpp
@@ -4,9 +4,11 @@
 #include <array>
 
 #include "Enums.hpp"
+#include "Layout.hpp"
 #include "../Traits/Type.hpp"
 #include "../Traits/Size.hpp"
 #include "../Traits/Core.hpp"
+#include "../Simd/Packet.hpp"
 
 namespace Sglty::Core {
 
@@ -30,7 +32,7 @@ namespace Sglty::Core {
  * @tparam _Tp         The scalar element type.
  * @tparam _rows       The number of rows in the matrix.
  * @tparam _cols       The number of columns in the matrix.
- * @tparam _core_major The memory layout (row-major or column-major).
+ * @tparam _core_major The memory layout (see `Sglty::Core::Layout`).
  */
 template <typename _Tp,
           std::size_t _rows,
@@ -82,7 +84,7 @@ class Dense {
   /**
    * @brief Rebinds the Dense core to a different memory layout.
    *
-   * Preserves size and type but switches between row-major and column-major.
+   * Preserves size and type but switches to another storage order.
    *
    * @tparam _rebind_major The new layout.
    */
@@ -143,8 +145,35 @@ class Dense {
    */
   constexpr const_pointer Data() const;
 
+  /**
+   * @brief Loads a SIMD packet starting at (_row, _col).
+   *
+   * Reads `Simd::Packet<value_type>::size` consecutive elements along the
+   * major axis. Only available for vectorizable value types.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return The loaded packet.
+   */
+  Simd::Packet<value_type> LoadPacket(const size_type _row,
+                                      const size_type _col) const;
+
+  /**
+   * @brief Stores a SIMD packet starting at (_row, _col).
+   *
+   * Writes `Simd::Packet<value_type>::size` consecutive elements along the
+   * major axis.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @param _p   The packet to store.
+   */
+  void StorePacket(const size_type _row,
+                   const size_type _col,
+                   const Simd::Packet<value_type>& _p);
+
  private:
-  std::array<_Tp, _rows * _cols> _m_data{};
+  std::array<_Tp, Layout::Size<_core_major>(_rows, _cols)> _m_data{};
 
   constexpr reference _m_Get(const size_type _row, const size_type _col);
   constexpr const_reference _m_Get(const size_type _row,
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <type_traits>
+
+#include "Dense.hpp"
+#include "Enums.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+#include "../Simd/Packet.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Fixed-size dense matrix core with aligned, optionally padded storage.
+ *
+ * Behaves like `Dense`, but its buffer is aligned to `_alignment` bytes and,
+ * when `_padded` is set, every row (row-major) or column (column-major) is
+ * padded to a whole multiple of `_alignment` bytes. With the defaults each
+ * row starts on its own 64-byte cache line, so:
+ *
+ * - every SIMD packet visited by `Sglty::Types::TraversePacket` is loaded and
+ *   stored with aligned accesses
+ *
+ * - rows written concurrently never share a cache line
+ *
+ * The layout is published through `core_traits` (see
+ * `Sglty::Traits::Core::GetAligned`) and can be queried with
+ * `Sglty::Traits::Core::alignment_v` and `Sglty::Traits::Core::leading_dim_v`.
+ * Padding elements are value-initialized and never read by expressions.
+ *
+ * @tparam _Tp         The scalar element type.
+ * @tparam _rows       The number of rows in the matrix.
+ * @tparam _cols       The number of columns in the matrix.
+ * @tparam _core_major The memory layout (row-major or column-major).
+ * @tparam _alignment  Byte alignment of the buffer (power of two).
+ * @tparam _padded     Whether to pad the leading dimension to `_alignment`.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment = 64,
+          bool _padded           = true>
+class DenseAligned {
+  static_assert(_alignment >= alignof(_Tp),
+                "Error: `_alignment` must be at least `alignof(_Tp)`.");
+  static_assert(_core_major == Core::Major::Row ||
+                    _core_major == Core::Major::Col,
+                "Error: `_core_major` must be `Row` or `Col`.");
+
+  static constexpr std::size_t _m_major_extent =
+      _core_major == Core::Major::Row ? _cols : _rows;
+
+  static constexpr std::size_t _m_minor_extent =
+      _core_major == Core::Major::Row ? _rows : _cols;
+
+  static constexpr std::size_t _m_pad_lanes =
+      _padded && _alignment > sizeof(_Tp) ? _alignment / sizeof(_Tp) : 1;
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout, alignment and type identity.
+  using core_traits = Traits::Core::GetAligned<
+      Core::Type::Dense,
+      _core_major,
+      _alignment,
+      (_m_major_extent + _m_pad_lanes - 1) / _m_pad_lanes * _m_pad_lanes>;
+
+  /**
+   * @brief Rebinds the core to a new size, keeping alignment and padding.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size = DenseAligned<_Tp,
+                                        _rebind_rows,
+                                        _rebind_cols,
+                                        _core_major,
+                                        _alignment,
+                                        _padded>;
+
+  /**
+   * @brief Rebinds the core to a new value type, keeping alignment and
+   * padding.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = DenseAligned<_rebind_value,
+                                         _rows,
+                                         _cols,
+                                         _core_major,
+                                         _alignment,
+                                         _padded>;
+
+  /**
+   * @brief Rebinds the core to a different memory layout, keeping alignment
+   * and padding; blocked layouts rebind to `Dense`, which pads them itself.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = std::conditional_t<
+      _rebind_major == Core::Major::Row || _rebind_major == Core::Major::Col,
+      DenseAligned<_Tp, _rows, _cols, _rebind_major, _alignment, _padded>,
+      Dense<_Tp, _rows, _cols, _rebind_major>>;
+
+  /**
+   * @brief Alias to a zero-sized base version with the same layout.
+   */
+  using core_base = DenseAligned<_Tp, 0, 0, _core_major, _alignment, _padded>;
+
+  /**
+   * @brief Default-constructs the core with zero-initialized data.
+   */
+  constexpr DenseAligned() = default;
+
+  /**
+   * @brief Constructs the core with all elements initialized to a value.
+   *
+   * @param val The value to fill every element with.
+   */
+  constexpr DenseAligned(value_type val);
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the underlying (padded) buffer.
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the underlying (padded) buffer.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  constexpr const_pointer Data() const;
+
+  /**
+   * @brief Loads a SIMD packet starting at (_row, _col).
+   *
+   * Reads `Simd::Packet<value_type>::size` consecutive elements along the
+   * major axis. When the layout guarantees it, an aligned load is used; the
+   * position along the major axis must then be a multiple of the packet size,
+   * as is the case for every chunk visited by `Types::TraversePacket`.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return The loaded packet.
+   */
+  Simd::Packet<value_type> LoadPacket(const size_type _row,
+                                      const size_type _col) const;
+
+  /**
+   * @brief Stores a SIMD packet starting at (_row, _col).
+   *
+   * Same alignment rules as `LoadPacket()`.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @param _p   The packet to store.
+   */
+  void StorePacket(const size_type _row,
+                   const size_type _col,
+                   const Simd::Packet<value_type>& _p);
+
+ private:
+  // Every packet-sized chunk along the major axis starts on a vector boundary.
+  static constexpr bool _m_aligned_packets =
+      SGLTY_SIMD_BYTES > 0 && _alignment >= SGLTY_SIMD_BYTES &&
+      core_traits::leading_dim * sizeof(_Tp) %
+              (SGLTY_SIMD_BYTES > 0 ? SGLTY_SIMD_BYTES : 1) ==
+          0;
+
+  alignas(_alignment)
+      std::array<_Tp, _m_minor_extent * core_traits::leading_dim> _m_data{};
+
+  constexpr reference _m_Get(const size_type _row, const size_type _col);
+  constexpr const_reference _m_Get(const size_type _row,
+                                   const size_type _col) const;
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/DenseAligned.tpp"
+
+// Singularity/Core/DenseAligned.hpp
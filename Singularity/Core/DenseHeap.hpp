@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "Enums.hpp"
+#include "Layout.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+#include "../Simd/Packet.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Fixed-size dense matrix core with owning heap storage.
+ *
+ * Same shape, layout and interface as `Dense`, but its
+ * elements live in a buffer obtained from `_Alloc` instead of inside the
+ * object, so the size of a `Matrix` backed by this core is a pointer and an
+ * allocator regardless of its dimensions. This lifts the practical stack
+ * limit of `Dense` for large fixed-size problems, including the temporaries
+ * returned by value from `Evaluate()`, `Cast()`, `Reorder()` and `Zero()`.
+ *
+ * - Copies allocate a new buffer and copy every element
+ *
+ * - Moves steal the buffer (and the allocator); the moved-from core holds no
+ *   storage and may only be assigned to or destroyed
+ *
+ * - All `core_rebind_*` aliases stay heap-backed, with `_Alloc` rebound to
+ *   the new value type where needed
+ *
+ * Not usable in constant expressions.
+ *
+ * @tparam _Tp         The scalar element type.
+ * @tparam _rows       The number of rows in the matrix.
+ * @tparam _cols       The number of columns in the matrix.
+ * @tparam _core_major The memory layout (see `Sglty::Core::Layout`).
+ * @tparam _Alloc      Allocator used for the element buffer.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc = std::allocator<_Tp>>
+class DenseHeap {
+  using _m_alloc_traits = std::allocator_traits<_Alloc>;
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// The allocator type used for the element buffer.
+  using allocator_type = _Alloc;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout and type identity.
+  using core_traits = Traits::Core::Get<Core::Type::Dense, _core_major>;
+
+  /**
+   * @brief Rebinds the core to a new size, keeping heap storage.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size =
+      DenseHeap<_Tp, _rebind_rows, _rebind_cols, _core_major, _Alloc>;
+
+  /**
+   * @brief Rebinds the core to a new value type, keeping heap storage.
+   *
+   * The allocator is rebound to `_rebind_value`.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = DenseHeap<
+      _rebind_value,
+      _rows,
+      _cols,
+      _core_major,
+      typename _m_alloc_traits::template rebind_alloc<_rebind_value>>;
+
+  /**
+   * @brief Rebinds the core to a different memory layout, keeping heap
+   * storage.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = DenseHeap<_Tp, _rows, _cols, _rebind_major, _Alloc>;
+
+  /**
+   * @brief Alias to a zero-sized base version with the same layout.
+   */
+  using core_base = DenseHeap<_Tp, 0, 0, _core_major, _Alloc>;
+
+  /**
+   * @brief Allocates the buffer with value-initialized elements.
+   */
+  DenseHeap();
+
+  /**
+   * @brief Allocates the buffer with value-initialized elements, using a
+   * given allocator instance.
+   *
+   * @param alloc The allocator to obtain storage from.
+   */
+  explicit DenseHeap(const allocator_type& alloc);
+
+  /**
+   * @brief Allocates the buffer with all elements initialized to a value.
+   *
+   * @param val The value to fill every element with.
+   */
+  DenseHeap(value_type val);
+
+  /**
+   * @brief Allocates a new buffer and copies every element of `_other`.
+   */
+  DenseHeap(const DenseHeap& _other);
+
+  /**
+   * @brief Takes over the buffer of `_other` without copying elements.
+   */
+  DenseHeap(DenseHeap&& _other) noexcept;
+
+  /**
+   * @brief Copies every element of `_other` into the current buffer.
+   *
+   * @return Reference to the current core.
+   */
+  DenseHeap& operator=(const DenseHeap& _other);
+
+  /**
+   * @brief Releases the current buffer and takes over the one of `_other`.
+   *
+   * @return Reference to the current core.
+   */
+  DenseHeap& operator=(DenseHeap&& _other) noexcept;
+
+  /**
+   * @brief Destroys the elements and releases the buffer.
+   */
+  ~DenseHeap();
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  const_reference At(const size_type _row, const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the heap buffer.
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the heap buffer.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  const_pointer Data() const;
+
+  /**
+   * @brief Loads a SIMD packet starting at (_row, _col).
+   *
+   * Reads `Simd::Packet<value_type>::size` consecutive elements along the
+   * major axis. Only available for vectorizable value types.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return The loaded packet.
+   */
+  Simd::Packet<value_type> LoadPacket(const size_type _row,
+                                      const size_type _col) const;
+
+  /**
+   * @brief Stores a SIMD packet starting at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @param _p   The packet to store.
+   */
+  void StorePacket(const size_type _row,
+                   const size_type _col,
+                   const Simd::Packet<value_type>& _p);
+
+ private:
+  static constexpr size_type _m_size =
+      Layout::Size<_core_major>(_rows, _cols);
+
+  allocator_type _m_alloc;
+  pointer _m_data = nullptr;
+
+  void _m_Allocate();
+  void _m_Release() noexcept;
+
+  reference _m_Get(const size_type _row, const size_type _col);
+  const_reference _m_Get(const size_type _row, const size_type _col) const;
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/DenseHeap.tpp"
+
+// Singularity/Core/DenseHeap.hpp
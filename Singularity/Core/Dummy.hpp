@@ -70,6 +70,15 @@ struct Dummy {
   template <std::size_t, std::size_t>
   using core_rebind_size = Dummy;
 
+  /**
+   * @brief Rebinds to another Dummy regardless of value type.
+   *
+   * Always returns `Dummy` — lets value-converting operations (e.g.
+   * `Expr::CastTo`) be probed with it.
+   */
+  template <typename>
+  using core_rebind_value = Dummy;
+
   /**
    * @brief Accesses the single dummy element.
    *
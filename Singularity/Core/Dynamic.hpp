@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Enums.hpp"
+#include "Layout.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+#include "../Simd/Packet.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Dense matrix core whose shape is chosen at runtime.
+ *
+ * Both extents in `size_traits` are `Sglty::Traits::Size::dynamic`; the actual
+ * row and column counts are stored in the core and exposed through `Rows()` /
+ * `Cols()`, which `Matrix`, the expression nodes and `Expr::Assign` consult
+ * whenever `Sglty::Traits::Core::is_dynamic_v` holds. Elements live
+ * contiguously in a `std::vector` with the same layout as `Dense`, so the
+ * blocked GEMM kernel and the SIMD packet path apply unchanged.
+ *
+ * - A default-constructed core is 0 x 0
+ *
+ * - Assigning an expression of a different shape resizes the destination
+ *
+ * - Dimension mismatches between operands are reported when the expression is
+ *   built, by throwing `std::invalid_argument`
+ *
+ * - All `core_rebind_*` aliases stay dynamic
+ *
+ * Not usable in constant expressions.
+ *
+ * @tparam _Tp         The scalar element type.
+ * @tparam _core_major The memory layout (see `Sglty::Core::Layout`).
+ * @tparam _Alloc      Allocator used for the element buffer.
+ */
+template <typename _Tp,
+          Core::Major _core_major,
+          typename _Alloc = std::allocator<_Tp>>
+class Dynamic {
+  using _m_alloc_traits = std::allocator_traits<_Alloc>;
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// The allocator type used for the element buffer.
+  using allocator_type = _Alloc;
+
+  /// Size traits, both extents are `Traits::Size::dynamic`.
+  using size_traits = Traits::Size::
+      Get<Traits::Size::dynamic, Traits::Size::dynamic, size_type>;
+
+  /// Core trait describing layout and type identity.
+  using core_traits = Traits::Core::Get<Core::Type::Dense, _core_major>;
+
+  /**
+   * @brief Rebinds the core to a new size; the result stays runtime-sized.
+   *
+   * Expression results are sized from the runtime extents of their operands,
+   * so the requested extents are not encoded in the type.
+   *
+   * @tparam _rebind_rows New row count (ignored).
+   * @tparam _rebind_cols New column count (ignored).
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size = Dynamic<_Tp, _core_major, _Alloc>;
+
+  /**
+   * @brief Rebinds the core to a new value type, keeping it runtime-sized.
+   *
+   * The allocator is rebound to `_rebind_value`.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = Dynamic<
+      _rebind_value,
+      _core_major,
+      typename _m_alloc_traits::template rebind_alloc<_rebind_value>>;
+
+  /**
+   * @brief Rebinds the core to a different memory layout, keeping it
+   * runtime-sized.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Dynamic<_Tp, _rebind_major, _Alloc>;
+
+  /**
+   * @brief Alias to the base version with the same layout.
+   */
+  using core_base = Dynamic<_Tp, _core_major, _Alloc>;
+
+  /**
+   * @brief Constructs an empty (0 x 0) core.
+   */
+  Dynamic() = default;
+
+  /**
+   * @brief Constructs a `_rows` x `_cols` core with value-initialized data.
+   *
+   * @param _rows The number of rows.
+   * @param _cols The number of columns.
+   */
+  Dynamic(const size_type _rows, const size_type _cols);
+
+  /**
+   * @brief Constructs a `_rows` x `_cols` core with all elements initialized
+   * to a value.
+   *
+   * @param _rows The number of rows.
+   * @param _cols The number of columns.
+   * @param val   The value to fill every element with.
+   */
+  Dynamic(const size_type _rows, const size_type _cols, value_type val);
+
+  /**
+   * @brief Returns the current number of rows.
+   */
+  size_type Rows() const;
+
+  /**
+   * @brief Returns the current number of columns.
+   */
+  size_type Cols() const;
+
+  /**
+   * @brief Changes the shape of the core.
+   *
+   * Existing element values are not preserved; every element is
+   * value-initialized. Does nothing if the shape is unchanged.
+   *
+   * @param _rows The new number of rows.
+   * @param _cols The new number of columns.
+   */
+  void Resize(const size_type _rows, const size_type _cols);
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  const_reference At(const size_type _row, const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the element buffer.
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the element buffer.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  const_pointer Data() const;
+
+  /**
+   * @brief Loads a SIMD packet starting at (_row, _col).
+   *
+   * Reads `Simd::Packet<value_type>::size` consecutive elements along the
+   * major axis. Only available for vectorizable value types.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return The loaded packet.
+   */
+  Simd::Packet<value_type> LoadPacket(const size_type _row,
+                                      const size_type _col) const;
+
+  /**
+   * @brief Stores a SIMD packet starting at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @param _p   The packet to store.
+   */
+  void StorePacket(const size_type _row,
+                   const size_type _col,
+                   const Simd::Packet<value_type>& _p);
+
+ private:
+  size_type _m_rows = 0;
+  size_type _m_cols = 0;
+
+  std::vector<_Tp, _Alloc> _m_data;
+
+  reference _m_Get(const size_type _row, const size_type _col);
+  const_reference _m_Get(const size_type _row, const size_type _col) const;
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Dynamic.tpp"
+
+// Singularity/Core/Dynamic.hpp
@@ -13,14 +13,20 @@ enum class Type {
   Dense,
 
   /// Sparse or non-contiguous representation (e.g. compressed formats).
-  Sparse
+  Sparse,
+
+  /// Fixed structure (band, triangle, symmetry) known from the type, storing
+  /// only the elements it does not imply (e.g. `Core::Banded`).
+  Structured
 };
 
 /**
  * @brief Enum representing memory layout order.
  *
  * Describes whether matrix elements are laid out in row-major or column-major
- * order. This impacts indexing and traversal logic.
+ * order, or in one of the blocked orders that keep both rows and columns
+ * local. This impacts indexing and traversal logic; see
+ * `Sglty::Core::Layout` for the offsets of each.
  */
 enum class Major {
   /// Row-major layout (C-style).
@@ -29,10 +35,31 @@ enum class Major {
   /// Column-major layout (Fortran-style).
   Col,
 
+  /// Square tiles of `SGLTY_TILE_EXTENT` elements, both the tiles and the
+  /// elements within a tile in row-major order.
+  Tiled,
+
+  /// Z-order (Morton) layout, recursively splitting into quadrants.
+  Morton,
+
   /// Used when layout is unspecified or irrelevant.
   Undefined
 };
 
+/**
+ * @brief Enum representing an access hint for a region of a matrix.
+ *
+ * Passed to `Matrix::Advise()` for cores that page their elements in and out
+ * (see `Sglty::Core::Mapped`). Hints never change element values.
+ */
+enum class Advice {
+  /// The elements will be read soon and should be paged in ahead of time.
+  WillNeed,
+
+  /// The elements will not be accessed again soon and may be paged out first.
+  Cold
+};
+
 }  // namespace Sglty::Core
 
 // Singularity/Core/Enums.hpp
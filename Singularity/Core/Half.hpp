@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+
+#include "../Traits/Type.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief 16-bit brain floating-point storage type.
+ *
+ * Holds the upper half of an IEEE 754 binary32: the same 8-bit exponent as
+ * `float` with a 7-bit mantissa. It only converts to and from `float`
+ * (rounding to nearest, ties to even), so all arithmetic on it happens in
+ * `float` (see `Sglty::Traits::Type::compute_t`).
+ *
+ * Meant for matrix storage: `DenseMat<BFloat16, ...>` halves the memory and
+ * bandwidth of a `float` matrix, and its products are accumulated in `float`
+ * and rounded once per stored element.
+ */
+struct BFloat16 {
+  /**
+   * @brief Constructs positive zero.
+   */
+  constexpr BFloat16() = default;
+
+  /**
+   * @brief Rounds a `float` to the nearest `BFloat16`, ties to even.
+   *
+   * NaNs stay (quiet) NaNs.
+   */
+  constexpr BFloat16(float _value) noexcept;
+
+  /**
+   * @brief Widens to `float` exactly.
+   */
+  constexpr operator float() const noexcept;
+
+  /**
+   * @brief Constructs a value from its bit pattern.
+   */
+  static constexpr BFloat16 FromBits(std::uint16_t _bits) noexcept;
+
+  /**
+   * @brief Bit pattern of the value.
+   */
+  constexpr std::uint16_t Bits() const noexcept;
+
+ private:
+  std::uint16_t _m_bits = 0;
+};
+
+/**
+ * @brief 16-bit IEEE 754 binary16 (half-precision) storage type.
+ *
+ * 5-bit exponent and 10-bit mantissa, with subnormals, infinities and NaNs.
+ * Like `BFloat16` it only converts to and from `float` (rounding to nearest,
+ * ties to even; values beyond the finite range become infinities), and all
+ * arithmetic on it happens in `float`.
+ */
+struct Float16 {
+  /**
+   * @brief Constructs positive zero.
+   */
+  constexpr Float16() = default;
+
+  /**
+   * @brief Rounds a `float` to the nearest `Float16`, ties to even.
+   *
+   * NaNs stay (quiet) NaNs.
+   */
+  constexpr Float16(float _value) noexcept;
+
+  /**
+   * @brief Widens to `float` exactly.
+   */
+  constexpr operator float() const noexcept;
+
+  /**
+   * @brief Constructs a value from its bit pattern.
+   */
+  static constexpr Float16 FromBits(std::uint16_t _bits) noexcept;
+
+  /**
+   * @brief Bit pattern of the value.
+   */
+  constexpr std::uint16_t Bits() const noexcept;
+
+ private:
+  std::uint16_t _m_bits = 0;
+};
+
+}  // namespace Sglty::Core
+
+namespace Sglty::Traits::Type {
+
+/**
+ * @brief `BFloat16` elements are computed in `float`.
+ */
+template <>
+struct Compute<Sglty::Core::BFloat16> {
+  using type = float;
+};
+
+/**
+ * @brief `Float16` elements are computed in `float`.
+ */
+template <>
+struct Compute<Sglty::Core::Float16> {
+  using type = float;
+};
+
+}  // namespace Sglty::Traits::Type
+
+#include "Impl/Half.tpp"
+
+// Singularity/Core/Half.hpp
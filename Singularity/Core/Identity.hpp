@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Enums.hpp"
+#include "Banded.hpp"
+#include "Dense.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Fixed-size identity matrix core, storing nothing.
+ *
+ * A read-only diagonal of ones: both `At()` return a reference to a shared
+ * one on the diagonal and to a shared zero elsewhere, and writing through
+ * them is a compile error, as for `Core::Map<const T, ...>`. This is what
+ * `Sglty::Types::Matrix::Identity()` returns for fixed-size cores.
+ *
+ * - Its structure is a diagonal band (see
+ *   `Sglty::Traits::Core::GetStructured`), so products with it cost one
+ *   multiply per result element
+ *
+ * - Like views, it cannot hold results: expressions over it evaluate into a
+ *   diagonal `Core::Banded` (see `Sglty::Traits::Core::plain_t`), and
+ *   `core_rebind_major` names a dense core
+ *
+ * @tparam _Tp   The scalar element type.
+ * @tparam _size The number of rows and columns in the matrix.
+ */
+template <typename _Tp, std::size_t _size>
+class Identity {
+ public:
+  /// Type traits for read-only elements of `_Tp`.
+  using type_traits = Traits::Type::Get<const _Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_size, _size, size_type>;
+
+  /// Core trait describing the diagonal band, owning no storage.
+  struct core_traits : Traits::Core::GetStructured<0, 0, false> {
+    static constexpr bool is_view = true;
+  };
+
+  /**
+   * @brief Rebinds the core to an owning diagonal `Banded` core of a new
+   * size.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size = Banded<_Tp, _rebind_rows, _rebind_cols, 0, 0>;
+
+  /**
+   * @brief Rebinds the core to an owning diagonal `Banded` core of a new
+   * value type.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = Banded<_rebind_value, _size, _size, 0, 0>;
+
+  /**
+   * @brief Rebinds the core to an owning dense one of the same shape.
+   *
+   * @tparam _rebind_major The layout of the dense core.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Dense<_Tp, _size, _size, _rebind_major>;
+
+  /**
+   * @brief The core of the transpose, the same core.
+   */
+  using core_transpose = Identity<_Tp, _size>;
+
+  /**
+   * @brief Alias to the zero-sized `Banded` base of diagonals.
+   */
+  using core_base = Banded<_Tp, 0, 0, 0, 0>;
+
+  /**
+   * @brief Constructs the identity.
+   */
+  constexpr Identity() = default;
+
+  /**
+   * @brief Accesses the element at (_row, _col); equivalent to the const
+   * version, since the elements are read-only.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to one or zero.
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to one on the diagonal, zero elsewhere.
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns `nullptr`, there is no storage.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns `nullptr`, there is no storage.
+   */
+  constexpr const_pointer Data() const;
+
+ private:
+  static constexpr value_type _m_zero{};
+  static constexpr value_type _m_one = value_type(1);
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Identity.tpp"
+
+// Singularity/Core/Identity.hpp
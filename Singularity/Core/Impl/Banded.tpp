@@ -0,0 +1,137 @@
+#pragma once
+
+#include "../Banded.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp>
+constexpr BandedReference<_Tp>::BandedReference(_Tp* _element)
+    : _m_element(_element) {}
+
+template <typename _Tp>
+constexpr BandedReference<_Tp>::operator _Tp() const {
+  return _m_element != nullptr ? *_m_element : _Tp{};
+}
+
+template <typename _Tp>
+constexpr BandedReference<_Tp>& BandedReference<_Tp>::operator=(
+    const _Tp& _v) {
+  if (_m_element != nullptr) {
+    *_m_element = _v;
+  } else if (_v != _Tp{}) {
+    throw std::invalid_argument(
+        "Error: the element is outside the band of the matrix.");
+  }
+  return *this;
+}
+
+template <typename _Tp>
+constexpr BandedReference<_Tp>& BandedReference<_Tp>::operator=(
+    const BandedReference& _other) {
+  return *this = static_cast<_Tp>(_other);
+}
+
+template <typename _Tp>
+constexpr BandedReference<_Tp>& BandedReference<_Tp>::operator+=(
+    const _Tp& _v) {
+  return *this = static_cast<_Tp>(static_cast<_Tp>(*this) + _v);
+}
+
+template <typename _Tp>
+constexpr BandedReference<_Tp>& BandedReference<_Tp>::operator-=(
+    const _Tp& _v) {
+  return *this = static_cast<_Tp>(static_cast<_Tp>(*this) - _v);
+}
+
+template <typename _Tp>
+constexpr BandedReference<_Tp>& BandedReference<_Tp>::operator*=(
+    const _Tp& _v) {
+  return *this = static_cast<_Tp>(static_cast<_Tp>(*this) * _v);
+}
+
+template <typename _Tp>
+constexpr BandedReference<_Tp>& BandedReference<_Tp>::operator/=(
+    const _Tp& _v) {
+  return *this = static_cast<_Tp>(static_cast<_Tp>(*this) / _v);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _lower,
+          std::size_t _upper>
+constexpr Banded<_Tp, _rows, _cols, _lower, _upper>::Banded(value_type val)
+    : _m_data() {
+  for (size_type k = 0; k < _m_data.size(); k++) {
+    _m_data[k] = val;
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _lower,
+          std::size_t _upper>
+constexpr typename Banded<_Tp, _rows, _cols, _lower, _upper>::reference
+Banded<_Tp, _rows, _cols, _lower, _upper>::At(const size_type _row,
+                                              const size_type _col) {
+  if (!Contains(_row, _col)) {
+    return reference(nullptr);
+  }
+  return reference(
+      const_cast<pointer>(&std::as_const(*this).At(_row, _col)));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _lower,
+          std::size_t _upper>
+constexpr typename Banded<_Tp, _rows, _cols, _lower, _upper>::const_reference
+Banded<_Tp, _rows, _cols, _lower, _upper>::At(const size_type _row,
+                                              const size_type _col) const {
+  if (!Contains(_row, _col)) {
+    return _m_zero;
+  }
+  const size_type first = _row > _lower ? _row - _lower : 0;
+  return _m_data[Layout::BandOffset(_row, _rows, _cols, _lower, _upper) +
+                 _col - first];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _lower,
+          std::size_t _upper>
+constexpr typename Banded<_Tp, _rows, _cols, _lower, _upper>::pointer
+Banded<_Tp, _rows, _cols, _lower, _upper>::Data() {
+  return _m_data.data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _lower,
+          std::size_t _upper>
+constexpr typename Banded<_Tp, _rows, _cols, _lower, _upper>::const_pointer
+Banded<_Tp, _rows, _cols, _lower, _upper>::Data() const {
+  return _m_data.data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _lower,
+          std::size_t _upper>
+constexpr bool Banded<_Tp, _rows, _cols, _lower, _upper>::Contains(
+    const size_type _row, const size_type _col) {
+  return _row <= _col + _lower && _col <= _row + _upper;
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Banded.tpp
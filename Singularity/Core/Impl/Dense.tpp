@@ -56,6 +56,27 @@ Dense<_Tp, _rows, _cols, _core_major>::Data() const {
   return _m_data.data();
 }
 
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+Simd::Packet<typename Dense<_Tp, _rows, _cols, _core_major>::value_type>
+Dense<_Tp, _rows, _cols, _core_major>::LoadPacket(const size_type _row,
+                                                  const size_type _col) const {
+  return Simd::Packet<value_type>::Load(&_m_Get(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+void Dense<_Tp, _rows, _cols, _core_major>::StorePacket(
+    const size_type _row,
+    const size_type _col,
+    const Simd::Packet<value_type>& _p) {
+  _p.Store(&_m_Get(_row, _col));
+}
+
 template <typename _Tp,
           std::size_t _rows,
           std::size_t _cols,
@@ -73,11 +94,7 @@ template <typename _Tp,
 constexpr typename Dense<_Tp, _rows, _cols, _core_major>::const_reference
 Dense<_Tp, _rows, _cols, _core_major>::_m_Get(const size_type _row,
                                               const size_type _col) const {
-  if (core_traits::core_major == Core::Major::Row) {
-    return _m_data[_row * _cols + _col];
-  } else {
-    return _m_data[_col * _rows + _row];
-  }
+  return _m_data[Layout::Offset<_core_major>(_row, _col, _rows, _cols)];
 }
 
 }  // namespace Sglty::Core
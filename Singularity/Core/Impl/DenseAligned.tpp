@@ -0,0 +1,171 @@
+#pragma once
+
+#include "../DenseAligned.hpp"
+
+#include <cstddef>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+constexpr DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::
+    DenseAligned(value_type val)
+    : _m_data() {
+  for (size_type i = 0; i < _rows; i++) {
+    for (size_type j = 0; j < _cols; j++) {
+      _m_Get(i, j) = val;
+    }
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+constexpr typename DenseAligned<_Tp,
+                                _rows,
+                                _cols,
+                                _core_major,
+                                _alignment,
+                                _padded>::reference
+DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::At(
+    const size_type _row, const size_type _col) {
+  return const_cast<reference>(std::as_const(*this).At(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+constexpr typename DenseAligned<_Tp,
+                                _rows,
+                                _cols,
+                                _core_major,
+                                _alignment,
+                                _padded>::const_reference
+DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::At(
+    const size_type _row, const size_type _col) const {
+  return _m_Get(_row, _col);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+constexpr typename DenseAligned<_Tp,
+                                _rows,
+                                _cols,
+                                _core_major,
+                                _alignment,
+                                _padded>::pointer
+DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::Data() {
+  return const_cast<pointer>(std::as_const(*this).Data());
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+constexpr typename DenseAligned<_Tp,
+                                _rows,
+                                _cols,
+                                _core_major,
+                                _alignment,
+                                _padded>::const_pointer
+DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::Data()
+    const {
+  return _m_data.data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+Simd::Packet<typename DenseAligned<_Tp,
+                                   _rows,
+                                   _cols,
+                                   _core_major,
+                                   _alignment,
+                                   _padded>::value_type>
+DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::LoadPacket(
+    const size_type _row, const size_type _col) const {
+  if constexpr (_m_aligned_packets) {
+    return Simd::Packet<value_type>::LoadAligned(&_m_Get(_row, _col));
+  } else {
+    return Simd::Packet<value_type>::Load(&_m_Get(_row, _col));
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+void DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::
+    StorePacket(const size_type _row,
+                const size_type _col,
+                const Simd::Packet<value_type>& _p) {
+  if constexpr (_m_aligned_packets) {
+    _p.StoreAligned(&_m_Get(_row, _col));
+  } else {
+    _p.Store(&_m_Get(_row, _col));
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+constexpr typename DenseAligned<_Tp,
+                                _rows,
+                                _cols,
+                                _core_major,
+                                _alignment,
+                                _padded>::reference
+DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::_m_Get(
+    const size_type _row, const size_type _col) {
+  return const_cast<reference>(std::as_const(*this)._m_Get(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _alignment,
+          bool _padded>
+constexpr typename DenseAligned<_Tp,
+                                _rows,
+                                _cols,
+                                _core_major,
+                                _alignment,
+                                _padded>::const_reference
+DenseAligned<_Tp, _rows, _cols, _core_major, _alignment, _padded>::_m_Get(
+    const size_type _row, const size_type _col) const {
+  if (core_traits::core_major == Core::Major::Row) {
+    return _m_data[_row * core_traits::leading_dim + _col];
+  } else {
+    return _m_data[_col * core_traits::leading_dim + _row];
+  }
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/DenseAligned.tpp
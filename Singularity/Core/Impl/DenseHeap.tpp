@@ -0,0 +1,239 @@
+#pragma once
+
+#include "../DenseHeap.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::DenseHeap()
+    : DenseHeap(allocator_type()) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::DenseHeap(
+    const allocator_type& alloc)
+    : _m_alloc(alloc) {
+  static_assert(
+      std::is_same_v<typename _m_alloc_traits::pointer, pointer>,
+      "Error: `_Alloc` must allocate raw pointers to `value_type`.");
+
+  _m_Allocate();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::DenseHeap(value_type val)
+    : DenseHeap() {
+  for (size_type i = 0; i < _m_size; i++) {
+    _m_data[i] = val;
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::DenseHeap(
+    const DenseHeap& _other)
+    : DenseHeap(_m_alloc_traits::select_on_container_copy_construction(
+          _other._m_alloc)) {
+  for (size_type i = 0; i < _m_size; i++) {
+    _m_data[i] = _other._m_data[i];
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::DenseHeap(
+    DenseHeap&& _other) noexcept
+    : _m_alloc(std::move(_other._m_alloc)),
+      _m_data(std::exchange(_other._m_data, nullptr)) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>&
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::operator=(
+    const DenseHeap& _other) {
+  if (this == &_other) {
+    return *this;
+  }
+  if (_m_data == nullptr) {
+    // Moved-from: storage has to be recreated before copying into it.
+    _m_Allocate();
+  }
+  for (size_type i = 0; i < _m_size; i++) {
+    _m_data[i] = _other._m_data[i];
+  }
+  return *this;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>&
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::operator=(
+    DenseHeap&& _other) noexcept {
+  if (this == &_other) {
+    return *this;
+  }
+  _m_Release();
+  _m_alloc = std::move(_other._m_alloc);
+  _m_data  = std::exchange(_other._m_data, nullptr);
+  return *this;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::~DenseHeap() {
+  _m_Release();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::reference
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::At(const size_type _row,
+                                                      const size_type _col) {
+  return const_cast<reference>(std::as_const(*this).At(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::const_reference
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::At(
+    const size_type _row, const size_type _col) const {
+  return _m_Get(_row, _col);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::pointer
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::Data() {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::const_pointer
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::Data() const {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Simd::Packet<
+    typename DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::value_type>
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::LoadPacket(
+    const size_type _row, const size_type _col) const {
+  return Simd::Packet<value_type>::Load(&_m_Get(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+void DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::StorePacket(
+    const size_type _row,
+    const size_type _col,
+    const Simd::Packet<value_type>& _p) {
+  _p.Store(&_m_Get(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+void DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Allocate() {
+  if (_m_size == 0) {
+    return;
+  }
+  _m_data = _m_alloc_traits::allocate(_m_alloc, _m_size);
+  for (size_type i = 0; i < _m_size; i++) {
+    _m_alloc_traits::construct(_m_alloc, _m_data + i);
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+void DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Release() noexcept {
+  if (_m_data == nullptr) {
+    return;
+  }
+  for (size_type i = 0; i < _m_size; i++) {
+    _m_alloc_traits::destroy(_m_alloc, _m_data + i);
+  }
+  _m_alloc_traits::deallocate(_m_alloc, _m_data, _m_size);
+  _m_data = nullptr;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::reference
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Get(
+    const size_type _row, const size_type _col) {
+  return const_cast<reference>(std::as_const(*this)._m_Get(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::const_reference
+DenseHeap<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Get(
+    const size_type _row, const size_type _col) const {
+  return _m_data[Layout::Offset<_core_major>(_row, _col, _rows, _cols)];
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/DenseHeap.tpp
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "../Dynamic.hpp"
+
+#include <cstddef>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+Dynamic<_Tp, _core_major, _Alloc>::Dynamic(const size_type _rows,
+                                           const size_type _cols)
+    : _m_rows(_rows),
+      _m_cols(_cols),
+      _m_data(Layout::Size<_core_major>(_rows, _cols)) {}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+Dynamic<_Tp, _core_major, _Alloc>::Dynamic(const size_type _rows,
+                                           const size_type _cols,
+                                           value_type val)
+    : _m_rows(_rows),
+      _m_cols(_cols),
+      _m_data(Layout::Size<_core_major>(_rows, _cols), val) {}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+typename Dynamic<_Tp, _core_major, _Alloc>::size_type
+Dynamic<_Tp, _core_major, _Alloc>::Rows() const {
+  return _m_rows;
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+typename Dynamic<_Tp, _core_major, _Alloc>::size_type
+Dynamic<_Tp, _core_major, _Alloc>::Cols() const {
+  return _m_cols;
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+void Dynamic<_Tp, _core_major, _Alloc>::Resize(const size_type _rows,
+                                               const size_type _cols) {
+  if (_rows == _m_rows && _cols == _m_cols) {
+    return;
+  }
+  _m_data.assign(Layout::Size<_core_major>(_rows, _cols), value_type());
+  _m_rows = _rows;
+  _m_cols = _cols;
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+typename Dynamic<_Tp, _core_major, _Alloc>::reference
+Dynamic<_Tp, _core_major, _Alloc>::At(const size_type _row,
+                                      const size_type _col) {
+  return const_cast<reference>(std::as_const(*this).At(_row, _col));
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+typename Dynamic<_Tp, _core_major, _Alloc>::const_reference
+Dynamic<_Tp, _core_major, _Alloc>::At(const size_type _row,
+                                      const size_type _col) const {
+  return _m_Get(_row, _col);
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+typename Dynamic<_Tp, _core_major, _Alloc>::pointer
+Dynamic<_Tp, _core_major, _Alloc>::Data() {
+  return _m_data.data();
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+typename Dynamic<_Tp, _core_major, _Alloc>::const_pointer
+Dynamic<_Tp, _core_major, _Alloc>::Data() const {
+  return _m_data.data();
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+Simd::Packet<typename Dynamic<_Tp, _core_major, _Alloc>::value_type>
+Dynamic<_Tp, _core_major, _Alloc>::LoadPacket(const size_type _row,
+                                              const size_type _col) const {
+  return Simd::Packet<value_type>::Load(&_m_Get(_row, _col));
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+void Dynamic<_Tp, _core_major, _Alloc>::StorePacket(
+    const size_type _row,
+    const size_type _col,
+    const Simd::Packet<value_type>& _p) {
+  _p.Store(&_m_Get(_row, _col));
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+typename Dynamic<_Tp, _core_major, _Alloc>::reference
+Dynamic<_Tp, _core_major, _Alloc>::_m_Get(const size_type _row,
+                                          const size_type _col) {
+  return const_cast<reference>(std::as_const(*this)._m_Get(_row, _col));
+}
+
+template <typename _Tp, Core::Major _core_major, typename _Alloc>
+typename Dynamic<_Tp, _core_major, _Alloc>::const_reference
+Dynamic<_Tp, _core_major, _Alloc>::_m_Get(const size_type _row,
+                                          const size_type _col) const {
+  return _m_data[Layout::Offset<_core_major>(_row, _col, _m_rows, _m_cols)];
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Dynamic.tpp
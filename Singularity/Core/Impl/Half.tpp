@@ -0,0 +1,120 @@
+#pragma once
+
+#include "../Half.hpp"
+
+#include <cstdint>
+
+#include "../../Config.hpp"
+
+namespace Sglty::Core {
+
+namespace Impl {
+
+constexpr std::uint16_t BFloat16Bits(float _value) noexcept {
+  std::uint32_t x = Config::BitCast<std::uint32_t>(_value);
+
+  if ((x & 0x7FFFFFFFu) > 0x7F800000u) {
+    return static_cast<std::uint16_t>((x >> 16) | 0x0040u);  // quiet NaN
+  }
+  // Adding just below half of the dropped bits, plus the lowest kept bit,
+  // rounds to nearest with ties to even.
+  x += 0x7FFFu + ((x >> 16) & 1u);
+  return static_cast<std::uint16_t>(x >> 16);
+}
+
+constexpr std::uint16_t Float16Bits(float _value) noexcept {
+  std::uint32_t       x    = Config::BitCast<std::uint32_t>(_value);
+  const std::uint32_t sign = (x >> 16) & 0x8000u;
+  x &= 0x7FFFFFFFu;
+
+  if (x >= 0x7F800000u) {  // infinity or NaN
+    return static_cast<std::uint16_t>(sign |
+                                      (x > 0x7F800000u ? 0x7E00u : 0x7C00u));
+  }
+  if (x >= 0x477FF000u) {  // rounds past 65504
+    return static_cast<std::uint16_t>(sign | 0x7C00u);
+  }
+  if (x < 0x33000000u) {  // rounds to zero
+    return static_cast<std::uint16_t>(sign);
+  }
+
+  // Normal results keep the exponent bits and drop 13 mantissa bits;
+  // subnormal ones shift the mantissa with its implicit bit further.
+  const std::uint32_t exp    = x >> 23;
+  const bool          normal = exp >= 113;
+  const std::uint32_t shift  = normal ? 13 : 126 - exp;
+  const std::uint32_t mant   = normal ? x : (x & 0x7FFFFFu) | 0x800000u;
+  const std::uint32_t rest   = mant & ((1u << shift) - 1);
+  const std::uint32_t half   = 1u << (shift - 1);
+
+  std::uint32_t bits = mant >> shift;
+  if (normal) {
+    bits -= 112u << 10;  // rebias the exponent from 127 to 15
+  }
+  // A carry out of the mantissa moves to the next exponent, as it should.
+  if (rest > half || (rest == half && (bits & 1u))) {
+    bits++;
+  }
+  return static_cast<std::uint16_t>(sign | bits);
+}
+
+}  // namespace Impl
+
+constexpr BFloat16::BFloat16(float _value) noexcept
+    : _m_bits(Impl::BFloat16Bits(_value)) {}
+
+constexpr BFloat16::operator float() const noexcept {
+  return Config::BitCast<float>(static_cast<std::uint32_t>(_m_bits) << 16);
+}
+
+constexpr BFloat16 BFloat16::FromBits(std::uint16_t _bits) noexcept {
+  BFloat16 result;
+  result._m_bits = _bits;
+  return result;
+}
+
+constexpr std::uint16_t BFloat16::Bits() const noexcept {
+  return _m_bits;
+}
+
+constexpr Float16::Float16(float _value) noexcept
+    : _m_bits(Impl::Float16Bits(_value)) {}
+
+constexpr Float16::operator float() const noexcept {
+  const std::uint32_t sign = static_cast<std::uint32_t>(_m_bits & 0x8000u)
+                             << 16;
+  std::uint32_t exp  = (_m_bits >> 10) & 0x1Fu;
+  std::uint32_t mant = _m_bits & 0x3FFu;
+
+  if (exp == 0x1Fu) {  // infinity or NaN
+    return Config::BitCast<float>(sign | 0x7F800000u | (mant << 13));
+  }
+  if (exp == 0) {
+    if (mant == 0) {
+      return Config::BitCast<float>(sign);
+    }
+    // Subnormal: shift the leading one into the implicit bit.
+    exp = 113;
+    while ((mant & 0x400u) == 0) {
+      mant <<= 1;
+      exp--;
+    }
+    mant &= 0x3FFu;
+    return Config::BitCast<float>(sign | (exp << 23) | (mant << 13));
+  }
+  return Config::BitCast<float>(sign | ((exp + 112) << 23) | (mant << 13));
+}
+
+constexpr Float16 Float16::FromBits(std::uint16_t _bits) noexcept {
+  Float16 result;
+  result._m_bits = _bits;
+  return result;
+}
+
+constexpr std::uint16_t Float16::Bits() const noexcept {
+  return _m_bits;
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Half.tpp
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../Identity.hpp"
+
+#include <cstddef>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp, std::size_t _size>
+constexpr typename Identity<_Tp, _size>::reference
+Identity<_Tp, _size>::At(const size_type _row, const size_type _col) {
+  return std::as_const(*this).At(_row, _col);
+}
+
+template <typename _Tp, std::size_t _size>
+constexpr typename Identity<_Tp, _size>::const_reference
+Identity<_Tp, _size>::At(const size_type _row, const size_type _col) const {
+  return _row == _col ? _m_one : _m_zero;
+}
+
+template <typename _Tp, std::size_t _size>
+constexpr typename Identity<_Tp, _size>::pointer Identity<_Tp, _size>::Data() {
+  return nullptr;
+}
+
+template <typename _Tp, std::size_t _size>
+constexpr typename Identity<_Tp, _size>::const_pointer
+Identity<_Tp, _size>::Data() const {
+  return nullptr;
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Identity.tpp
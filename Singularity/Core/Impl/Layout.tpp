@@ -0,0 +1,156 @@
+#pragma once
+
+#include "../Layout.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace Sglty::Core::Layout {
+
+namespace Impl {
+
+// Largest extent of a Morton core: block offsets then fit in a `size_t`.
+constexpr inline std::size_t max_morton_extent =
+    std::size_t{1} << (std::numeric_limits<std::size_t>::digits / 2 - 1);
+
+// Smallest power of two not below `x`, `1` for `0`.
+constexpr std::size_t NextPow2(std::size_t x) {
+  if (x <= 1) {
+    return 1;
+  }
+  x--;
+  for (int s = 1; s < std::numeric_limits<std::size_t>::digits; s <<= 1) {
+    x |= x >> s;
+  }
+  return x + 1;
+}
+
+// Spreads the low 32 bits of `x` to the even bit positions.
+constexpr std::uint64_t Spread(std::uint64_t x) {
+  x &= 0x00000000FFFFFFFFull;
+  x  = (x | x << 16) & 0x0000FFFF0000FFFFull;
+  x  = (x | x << 8) & 0x00FF00FF00FF00FFull;
+  x  = (x | x << 4) & 0x0F0F0F0F0F0F0F0Full;
+  x  = (x | x << 2) & 0x3333333333333333ull;
+  x  = (x | x << 1) & 0x5555555555555555ull;
+  return x;
+}
+
+}  // namespace Impl
+
+template <Core::Major _major>
+constexpr std::size_t Size(const std::size_t _rows, const std::size_t _cols) {
+  constexpr std::size_t max = std::numeric_limits<std::size_t>::max();
+
+  if constexpr (_major == Core::Major::Tiled) {
+    constexpr std::size_t tile = std::size_t{SGLTY_TILE_EXTENT};
+    static_assert(tile > 0, "Error: `SGLTY_TILE_EXTENT` must be positive.");
+
+    const std::size_t tile_rows = _rows / tile + (_rows % tile != 0);
+    const std::size_t tile_cols = _cols / tile + (_cols % tile != 0);
+    if (tile_rows != 0 && tile_cols > max / (tile * tile) / tile_rows) {
+      throw std::length_error("Error: the tiled matrix is too large.");
+    }
+    return tile_rows * tile_cols * tile * tile;
+  } else if constexpr (_major == Core::Major::Morton) {
+    if (_rows > Impl::max_morton_extent || _cols > Impl::max_morton_extent) {
+      throw std::length_error("Error: the Morton matrix is too large.");
+    }
+
+    const std::size_t side = MortonSide(_rows, _cols);
+    if (side == 0) {
+      return 0;
+    }
+    const std::size_t extent = _rows > _cols ? _rows : _cols;
+    const std::size_t blocks = extent / side + (extent % side != 0);
+    if (blocks > max / (side * side)) {
+      throw std::length_error("Error: the Morton matrix is too large.");
+    }
+    return blocks * side * side;
+  } else {
+    return _rows * _cols;
+  }
+}
+
+template <Core::Major _major>
+constexpr std::size_t Offset(const std::size_t _row,
+                             const std::size_t _col,
+                             const std::size_t _rows,
+                             const std::size_t _cols) {
+  if constexpr (_major == Core::Major::Row) {
+    return _row * _cols + _col;
+  } else if constexpr (_major == Core::Major::Col) {
+    return _col * _rows + _row;
+  } else if constexpr (_major == Core::Major::Tiled) {
+    return TiledOffset<Core::Major::Row, std::size_t{SGLTY_TILE_EXTENT}>(
+        _row, _col, _rows, _cols);
+  } else {
+    static_assert(_major == Core::Major::Morton,
+                  "Error: `_major` has no storage order.");
+
+    // Blocks follow each other along one extent only, so the index along
+    // the other one is below `side`.
+    const std::size_t side = MortonSide(_rows, _cols);
+    const std::size_t mask = side - 1;
+    const std::size_t z    = static_cast<std::size_t>(
+        Impl::Spread(_row & mask) << 1 | Impl::Spread(_col & mask));
+    return (_row / side + _col / side) * side * side + z;
+  }
+}
+
+template <Core::Major _major, std::size_t _tile>
+constexpr std::size_t TiledOffset(const std::size_t _row,
+                                  const std::size_t _col,
+                                  const std::size_t _rows,
+                                  const std::size_t _cols) {
+  static_assert(_major == Core::Major::Row || _major == Core::Major::Col,
+                "Error: tiles are ordered `Row` or `Col`.");
+
+  constexpr bool row = _major == Core::Major::Row;
+
+  const std::size_t o     = row ? _row : _col;
+  const std::size_t n     = row ? _col : _row;
+  const std::size_t inner = row ? _cols : _rows;
+  const std::size_t tiles = inner / _tile + (inner % _tile != 0);
+  return (o / _tile * tiles + n / _tile) * _tile * _tile + o % _tile * _tile +
+         n % _tile;
+}
+
+constexpr std::size_t MortonSide(const std::size_t _rows,
+                                 const std::size_t _cols) {
+  if (_rows == 0 || _cols == 0) {
+    return 0;
+  }
+  const std::size_t rows = Impl::NextPow2(_rows);
+  const std::size_t cols = Impl::NextPow2(_cols);
+  return rows < cols ? rows : cols;
+}
+
+constexpr std::size_t BandOffset(const std::size_t _row,
+                                 const std::size_t _rows,
+                                 const std::size_t _cols,
+                                 const std::size_t _lower,
+                                 const std::size_t _upper) {
+  // Rows from `_cols + _lower` on hold nothing; before that, each row holds
+  // the columns from `max(0, i - _lower)` to `min(_cols, i + _upper + 1)`.
+  const std::size_t last = _rows < _cols + _lower ? _rows : _cols + _lower;
+  const std::size_t m    = _row < last ? _row : last;
+  if (m == 0) {
+    return 0;
+  }
+
+  // Rows below `_cols - _upper` end within the matrix.
+  const std::size_t a  = m < _cols - _upper ? m : _cols - _upper;
+  const std::size_t hi = a * (a - 1) / 2 + a * (_upper + 1) + (m - a) * _cols;
+
+  // Rows past `_lower` start after the first column.
+  const std::size_t b  = m > _lower + 1 ? m - _lower - 1 : 0;
+  const std::size_t lo = b * (b + 1) / 2;
+  return hi - lo;
+}
+
+}  // namespace Sglty::Core::Layout
+
+// Singularity/Core/Impl/Layout.tpp
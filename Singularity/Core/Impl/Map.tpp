@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../Map.hpp"
+
+#include <cstddef>
+
+namespace Sglty::Core {
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr Map<_Tp, _rows, _cols, _core_major>::Map(pointer _data)
+    : _m_data(_data) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename Map<_Tp, _rows, _cols, _core_major>::reference
+Map<_Tp, _rows, _cols, _core_major>::At(const size_type _row,
+                                        const size_type _col) {
+  return _m_data[_m_Offset(_row, _col)];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename Map<_Tp, _rows, _cols, _core_major>::const_reference
+Map<_Tp, _rows, _cols, _core_major>::At(const size_type _row,
+                                        const size_type _col) const {
+  return _m_data[_m_Offset(_row, _col)];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename Map<_Tp, _rows, _cols, _core_major>::pointer
+Map<_Tp, _rows, _cols, _core_major>::Data() {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename Map<_Tp, _rows, _cols, _core_major>::const_pointer
+Map<_Tp, _rows, _cols, _core_major>::Data() const {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+Simd::Packet<typename Map<_Tp, _rows, _cols, _core_major>::value_type>
+Map<_Tp, _rows, _cols, _core_major>::LoadPacket(const size_type _row,
+                                                const size_type _col) const {
+  return Simd::Packet<value_type>::Load(_m_data + _m_Offset(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+void Map<_Tp, _rows, _cols, _core_major>::StorePacket(
+    const size_type _row,
+    const size_type _col,
+    const Simd::Packet<value_type>& _p) {
+  _p.Store(_m_data + _m_Offset(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename Map<_Tp, _rows, _cols, _core_major>::size_type
+Map<_Tp, _rows, _cols, _core_major>::_m_Offset(const size_type _row,
+                                               const size_type _col) const {
+  if (core_traits::core_major == Core::Major::Row) {
+    return _row * _cols + _col;
+  } else {
+    return _col * _rows + _row;
+  }
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Map.tpp
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../MapStrided.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace Sglty::Core {
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr MapStrided<_Tp, _rows, _cols, _core_major>::MapStrided(
+    pointer _data, const size_type _outer_stride)
+    : _m_data(_data), _m_outer_stride(_outer_stride) {
+  if (_outer_stride < (_core_major == Core::Major::Row ? _cols : _rows)) {
+    throw std::invalid_argument(
+        "Error: `_outer_stride` is smaller than the major extent.");
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename MapStrided<_Tp, _rows, _cols, _core_major>::size_type
+MapStrided<_Tp, _rows, _cols, _core_major>::OuterStride() const {
+  return _m_outer_stride;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename MapStrided<_Tp, _rows, _cols, _core_major>::reference
+MapStrided<_Tp, _rows, _cols, _core_major>::At(const size_type _row,
+                                               const size_type _col) {
+  return _m_data[_m_Offset(_row, _col)];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename MapStrided<_Tp, _rows, _cols, _core_major>::
+    const_reference
+    MapStrided<_Tp, _rows, _cols, _core_major>::At(
+        const size_type _row, const size_type _col) const {
+  return _m_data[_m_Offset(_row, _col)];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename MapStrided<_Tp, _rows, _cols, _core_major>::pointer
+MapStrided<_Tp, _rows, _cols, _core_major>::Data() {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename MapStrided<_Tp, _rows, _cols, _core_major>::const_pointer
+MapStrided<_Tp, _rows, _cols, _core_major>::Data() const {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+Simd::Packet<typename MapStrided<_Tp, _rows, _cols, _core_major>::value_type>
+MapStrided<_Tp, _rows, _cols, _core_major>::LoadPacket(
+    const size_type _row, const size_type _col) const {
+  return Simd::Packet<value_type>::Load(_m_data + _m_Offset(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+void MapStrided<_Tp, _rows, _cols, _core_major>::StorePacket(
+    const size_type _row,
+    const size_type _col,
+    const Simd::Packet<value_type>& _p) {
+  _p.Store(_m_data + _m_Offset(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+constexpr typename MapStrided<_Tp, _rows, _cols, _core_major>::size_type
+MapStrided<_Tp, _rows, _cols, _core_major>::_m_Offset(
+    const size_type _row, const size_type _col) const {
+  if (core_traits::core_major == Core::Major::Row) {
+    return _row * _m_outer_stride + _col;
+  } else {
+    return _col * _m_outer_stride + _row;
+  }
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/MapStrided.tpp
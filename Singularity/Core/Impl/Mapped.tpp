@@ -0,0 +1,300 @@
+#pragma once
+
+#include "../Mapped.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+typename Mapped<_Tp, _core_major, _tile>::size_type
+Mapped<_Tp, _core_major, _tile>::Bytes(const size_type _rows,
+                                       const size_type _cols) {
+  constexpr size_type max  = std::numeric_limits<size_type>::max();
+  constexpr size_type tile = _m_tile_size * sizeof(value_type);
+
+  const size_type tile_rows = _rows / _tile + (_rows % _tile != 0);
+  const size_type tile_cols = _cols / _tile + (_cols % _tile != 0);
+  if (tile_rows != 0 && tile_cols > max / tile / tile_rows) {
+    throw std::length_error("Error: the mapped matrix is too large.");
+  }
+  return tile_rows * tile_cols * tile;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Mapped<_Tp, _core_major, _tile>::Mapped(const size_type _rows,
+                                        const size_type _cols) {
+  _m_Map(_rows, _cols);
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Mapped<_Tp, _core_major, _tile>::Mapped(const size_type _rows,
+                                        const size_type _cols,
+                                        value_type val)
+    : Mapped(_rows, _cols) {
+  const size_type size = _m_bytes / sizeof(value_type);
+  for (size_type k = 0; k < size; k++) {
+    _m_data[k] = val;
+  }
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Mapped<_Tp, _core_major, _tile>::Mapped(const char* _path,
+                                        const size_type _rows,
+                                        const size_type _cols) {
+  const size_type bytes = Bytes(_rows, _cols);
+
+  _m_fd = ::open(_path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (_m_fd < 0) {
+    throw std::system_error(errno, std::generic_category());
+  }
+  try {
+    struct ::stat st;
+    if (::fstat(_m_fd, &st) != 0) {
+      throw std::system_error(errno, std::generic_category());
+    }
+    // Only a new (empty) file is sized, never one holding other data.
+    const auto size = static_cast<size_type>(st.st_size);
+    if (size != 0 && size != bytes) {
+      throw std::invalid_argument(
+          "Error: the file does not hold a matrix of this shape.");
+    }
+    _m_Map(_rows, _cols);
+  } catch (...) {
+    ::close(_m_fd);
+    throw;
+  }
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Mapped<_Tp, _core_major, _tile>::Mapped(const Mapped& _other)
+    : Mapped(_other._m_rows, _other._m_cols) {
+  if (_m_bytes != 0) {
+    std::memcpy(_m_data, _other._m_data, _m_bytes);
+  }
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Mapped<_Tp, _core_major, _tile>::Mapped(Mapped&& _other) noexcept
+    : _m_rows(std::exchange(_other._m_rows, 0)),
+      _m_cols(std::exchange(_other._m_cols, 0)),
+      _m_data(std::exchange(_other._m_data, nullptr)),
+      _m_bytes(std::exchange(_other._m_bytes, 0)),
+      _m_fd(std::exchange(_other._m_fd, -1)) {}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Mapped<_Tp, _core_major, _tile>& Mapped<_Tp, _core_major, _tile>::operator=(
+    const Mapped& _other) {
+  if (this != &_other) {
+    Resize(_other._m_rows, _other._m_cols);
+    if (_m_bytes != 0) {
+      std::memcpy(_m_data, _other._m_data, _m_bytes);
+    }
+  }
+  return *this;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Mapped<_Tp, _core_major, _tile>& Mapped<_Tp, _core_major, _tile>::operator=(
+    Mapped&& _other) {
+  if (_m_fd >= 0) {
+    // The file keeps the elements; throws if the shapes differ.
+    return *this = std::as_const(_other);
+  }
+  if (this != &_other) {
+    _m_Unmap();
+    _m_rows  = std::exchange(_other._m_rows, 0);
+    _m_cols  = std::exchange(_other._m_cols, 0);
+    _m_data  = std::exchange(_other._m_data, nullptr);
+    _m_bytes = std::exchange(_other._m_bytes, 0);
+    _m_fd    = std::exchange(_other._m_fd, -1);
+  }
+  return *this;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Mapped<_Tp, _core_major, _tile>::~Mapped() {
+  _m_Unmap();
+  if (_m_fd >= 0) {
+    ::close(_m_fd);
+  }
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+typename Mapped<_Tp, _core_major, _tile>::size_type
+Mapped<_Tp, _core_major, _tile>::Rows() const {
+  return _m_rows;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+typename Mapped<_Tp, _core_major, _tile>::size_type
+Mapped<_Tp, _core_major, _tile>::Cols() const {
+  return _m_cols;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+void Mapped<_Tp, _core_major, _tile>::Resize(const size_type _rows,
+                                             const size_type _cols) {
+  if (_rows == _m_rows && _cols == _m_cols) {
+    return;
+  }
+  if (_m_fd >= 0) {
+    throw std::invalid_argument(
+        "Error: a matrix mapping a file cannot be resized.");
+  }
+  _m_Unmap();
+  _m_Map(_rows, _cols);
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+typename Mapped<_Tp, _core_major, _tile>::reference
+Mapped<_Tp, _core_major, _tile>::At(const size_type _row,
+                                    const size_type _col) {
+  return _m_data[_m_Offset(_row, _col)];
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+typename Mapped<_Tp, _core_major, _tile>::const_reference
+Mapped<_Tp, _core_major, _tile>::At(const size_type _row,
+                                    const size_type _col) const {
+  return _m_data[_m_Offset(_row, _col)];
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+typename Mapped<_Tp, _core_major, _tile>::pointer
+Mapped<_Tp, _core_major, _tile>::Data() {
+  return _m_data;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+typename Mapped<_Tp, _core_major, _tile>::const_pointer
+Mapped<_Tp, _core_major, _tile>::Data() const {
+  return _m_data;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+Simd::Packet<typename Mapped<_Tp, _core_major, _tile>::value_type>
+Mapped<_Tp, _core_major, _tile>::LoadPacket(const size_type _row,
+                                            const size_type _col) const {
+  static_assert(_tile % Simd::Packet<value_type>::size == 0,
+                "Error: packets would cross tiles of `_tile` elements.");
+
+  return Simd::Packet<value_type>::Load(_m_data + _m_Offset(_row, _col));
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+void Mapped<_Tp, _core_major, _tile>::StorePacket(
+    const size_type _row,
+    const size_type _col,
+    const Simd::Packet<value_type>& _p) {
+  static_assert(_tile % Simd::Packet<value_type>::size == 0,
+                "Error: packets would cross tiles of `_tile` elements.");
+
+  _p.Store(_m_data + _m_Offset(_row, _col));
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+void Mapped<_Tp, _core_major, _tile>::Advise(
+    const size_type _row,
+    const size_type _col,
+    const size_type _rows,
+    const size_type _cols,
+    const Core::Advice _advice) const {
+  constexpr bool row       = _core_major == Core::Major::Row;
+  constexpr size_type tile = _m_tile_size * sizeof(value_type);
+
+  int advice = MADV_WILLNEED;
+  if (_advice == Core::Advice::Cold) {
+#ifdef MADV_COLD
+    advice = MADV_COLD;
+#else
+    return;
+#endif
+  }
+  if (_m_data == nullptr || _rows == 0 || _cols == 0) {
+    return;
+  }
+
+  static const auto page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+
+  const size_type o0    = row ? _row : _col;
+  const size_type o1    = row ? _row + _rows : _col + _cols;
+  const size_type n0    = row ? _col : _row;
+  const size_type n1    = row ? _col + _cols : _row + _rows;
+  const size_type inner = row ? _m_cols : _m_rows;
+  const size_type tiles = inner / _tile + (inner % _tile != 0);
+
+  auto* const base = reinterpret_cast<char*>(const_cast<pointer>(_m_data));
+  for (size_type t = o0 / _tile; t <= (o1 - 1) / _tile; t++) {
+    // The tiles of one strip covering the region are contiguous.
+    const size_type first = (t * tiles + n0 / _tile) * tile;
+    const size_type last  = (t * tiles + (n1 - 1) / _tile + 1) * tile;
+    const size_type begin = first - first % page;
+    ::madvise(base + begin, last - begin, advice);
+  }
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+void Mapped<_Tp, _core_major, _tile>::_m_Map(const size_type _rows,
+                                             const size_type _cols) {
+  const size_type bytes = Bytes(_rows, _cols);
+
+  if (bytes != 0) {
+    if (_m_fd >= 0 && ::ftruncate(_m_fd, static_cast<::off_t>(bytes)) != 0) {
+      throw std::system_error(errno, std::generic_category());
+    }
+    void* p = _m_fd >= 0
+                  ? ::mmap(nullptr,
+                           bytes,
+                           PROT_READ | PROT_WRITE,
+                           MAP_SHARED,
+                           _m_fd,
+                           0)
+                  : ::mmap(nullptr,
+                           bytes,
+                           PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                           -1,
+                           0);
+    if (p == MAP_FAILED) {
+      throw std::system_error(errno, std::generic_category());
+    }
+    _m_data = static_cast<pointer>(p);
+  }
+  _m_rows  = _rows;
+  _m_cols  = _cols;
+  _m_bytes = bytes;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+void Mapped<_Tp, _core_major, _tile>::_m_Unmap() {
+  if (_m_data != nullptr) {
+    ::munmap(_m_data, _m_bytes);
+  }
+  _m_rows  = 0;
+  _m_cols  = 0;
+  _m_data  = nullptr;
+  _m_bytes = 0;
+}
+
+template <typename _Tp, Core::Major _core_major, std::size_t _tile>
+typename Mapped<_Tp, _core_major, _tile>::size_type
+Mapped<_Tp, _core_major, _tile>::_m_Offset(const size_type _row,
+                                           const size_type _col) const {
+  return Layout::TiledOffset<_core_major, _tile>(_row, _col, _m_rows, _m_cols);
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Mapped.tpp
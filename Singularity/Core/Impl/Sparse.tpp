@@ -0,0 +1,158 @@
+#pragma once
+
+#include "../Sparse.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace Sglty::Core {
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::reference
+Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::At(const size_type _row,
+                                                     const size_type _col) {
+  const size_type outer = _core_major == Core::Major::Row ? _row : _col;
+  const size_type inner = _core_major == Core::Major::Row ? _col : _row;
+  const size_type pos   = _m_Find(outer, inner);
+
+  if (pos < _m_outer[outer + 1] && _m_inner[pos] == inner) {
+    return _m_values[pos];
+  }
+
+  const size_type nnz = NonZeros();
+  if (nnz == _max_nnz) {
+    throw std::length_error("Error: sparse core capacity exceeded.");
+  }
+  for (size_type k = nnz; k > pos; k--) {
+    _m_inner[k]  = _m_inner[k - 1];
+    _m_values[k] = _m_values[k - 1];
+  }
+  for (size_type o = outer + 1; o <= _m_outer_size; o++) {
+    _m_outer[o]++;
+  }
+  _m_inner[pos]  = inner;
+  _m_values[pos] = value_type();
+  return _m_values[pos];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::
+    const_reference
+    Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::At(
+        const size_type _row, const size_type _col) const {
+  const size_type outer = _core_major == Core::Major::Row ? _row : _col;
+  const size_type inner = _core_major == Core::Major::Row ? _col : _row;
+  const size_type pos   = _m_Find(outer, inner);
+
+  if (pos < _m_outer[outer + 1] && _m_inner[pos] == inner) {
+    return _m_values[pos];
+  }
+  return _m_zero;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::pointer
+Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::Data() {
+  return _m_values.data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::
+    const_pointer
+    Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::Data() const {
+  return _m_values.data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::size_type
+Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::NonZeros() const {
+  return _m_outer[_m_outer_size];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::size_type*
+Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::OuterIndex() {
+  return _m_outer.data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr const typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::
+    size_type*
+    Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::OuterIndex() const {
+  return _m_outer.data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::size_type*
+Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::InnerIndex() {
+  return _m_inner.data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr const typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::
+    size_type*
+    Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::InnerIndex() const {
+  return _m_inner.data();
+}
+
+// Position of `_inner` within `_outer`, or where it would be inserted.
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+constexpr typename Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::size_type
+Sparse<_Tp, _rows, _cols, _core_major, _max_nnz>::_m_Find(
+    const size_type _outer, const size_type _inner) const {
+  size_type lo = _m_outer[_outer];
+  size_type hi = _m_outer[_outer + 1];
+  while (lo < hi) {
+    const size_type mid = lo + (hi - lo) / 2;
+    if (_m_inner[mid] < _inner) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Sparse.tpp
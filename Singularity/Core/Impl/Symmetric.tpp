@@ -0,0 +1,46 @@
+#pragma once
+
+#include "../Symmetric.hpp"
+
+#include <cstddef>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp, std::size_t _size>
+constexpr Symmetric<_Tp, _size>::Symmetric(value_type val) : _m_data() {
+  for (size_type k = 0; k < _m_data.size(); k++) {
+    _m_data[k] = val;
+  }
+}
+
+template <typename _Tp, std::size_t _size>
+constexpr typename Symmetric<_Tp, _size>::reference
+Symmetric<_Tp, _size>::At(const size_type _row, const size_type _col) {
+  return const_cast<reference>(std::as_const(*this).At(_row, _col));
+}
+
+template <typename _Tp, std::size_t _size>
+constexpr typename Symmetric<_Tp, _size>::const_reference
+Symmetric<_Tp, _size>::At(const size_type _row, const size_type _col) const {
+  const size_type i = _row < _col ? _row : _col;
+  const size_type j = _row < _col ? _col : _row;
+  // Rows before `i` hold `_size`, `_size - 1`, ... elements.
+  return _m_data[i * _size - i * (i - 1) / 2 + j - i];
+}
+
+template <typename _Tp, std::size_t _size>
+constexpr typename Symmetric<_Tp, _size>::pointer
+Symmetric<_Tp, _size>::Data() {
+  return _m_data.data();
+}
+
+template <typename _Tp, std::size_t _size>
+constexpr typename Symmetric<_Tp, _size>::const_pointer
+Symmetric<_Tp, _size>::Data() const {
+  return _m_data.data();
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Symmetric.tpp
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Enums.hpp"
+#include "../Config.hpp"
+
+namespace Sglty::Core::Layout {
+
+/**
+ * @brief Number of elements a `_rows` x `_cols` core stored in `_major`
+ * order holds, padding included.
+ *
+ * - `Row` / `Col`: `_rows * _cols`
+ *
+ * - `Tiled`: every `SGLTY_TILE_EXTENT` x `SGLTY_TILE_EXTENT` tile covering
+ *   the matrix, edge tiles padded to the full extent
+ *
+ * - `Morton`: the matrix is covered by square blocks whose side is the
+ *   smaller of both extents rounded up to a power of two, placed one after
+ *   the other along the longer extent; each block is stored in Z-order
+ *
+ * @tparam _major The storage order.
+ * @param _rows   The number of rows.
+ * @param _cols   The number of columns.
+ * @return The number of elements to allocate.
+ * @throws std::length_error if a padded size is not representable.
+ */
+template <Core::Major _major>
+constexpr std::size_t Size(const std::size_t _rows, const std::size_t _cols);
+
+/**
+ * @brief Position of element (_row, _col) of a `_rows` x `_cols` core
+ * stored in `_major` order, within storage of `Size<_major>(_rows, _cols)`
+ * elements.
+ *
+ * @tparam _major The storage order.
+ * @param _row    The row index (zero-based).
+ * @param _col    The column index (zero-based).
+ * @param _rows   The number of rows.
+ * @param _cols   The number of columns.
+ * @return The offset of the element.
+ */
+template <Core::Major _major>
+constexpr std::size_t Offset(const std::size_t _row,
+                             const std::size_t _col,
+                             const std::size_t _rows,
+                             const std::size_t _cols);
+
+/**
+ * @brief Position of element (_row, _col) in `_tile` x `_tile` tiles, tiles
+ * and the elements within each in `_major` (`Row` or `Col`) order.
+ *
+ * Shared by `Major::Tiled` and `Sglty::Core::Mapped`.
+ *
+ * @tparam _major The order of tiles and of elements within a tile.
+ * @tparam _tile  The extent of a tile.
+ * @param _row    The row index (zero-based).
+ * @param _col    The column index (zero-based).
+ * @param _rows   The number of rows.
+ * @param _cols   The number of columns.
+ * @return The offset of the element.
+ */
+template <Core::Major _major, std::size_t _tile>
+constexpr std::size_t TiledOffset(const std::size_t _row,
+                                  const std::size_t _col,
+                                  const std::size_t _rows,
+                                  const std::size_t _cols);
+
+/**
+ * @brief Side of the square Z-ordered blocks of a `_rows` x `_cols` core
+ * stored `Major::Morton`, `0` when it is empty.
+ *
+ * @param _rows The number of rows.
+ * @param _cols The number of columns.
+ * @return A power of two, or `0`.
+ */
+constexpr std::size_t MortonSide(const std::size_t _rows,
+                                 const std::size_t _cols);
+
+/**
+ * @brief Position of the first element of row `_row` of a `_rows` x `_cols`
+ * band of `_lower` sub- and `_upper` super-diagonals, stored row after row
+ * without padding (see `Sglty::Core::Banded`).
+ *
+ * Row `i` holds columns `i - _lower` up to `i + _upper`, clipped to the
+ * matrix. `BandOffset(_rows, ...)` is the number of stored elements.
+ *
+ * @param _row   The row index (zero-based), at most `_rows`.
+ * @param _rows  The number of rows.
+ * @param _cols  The number of columns.
+ * @param _lower The number of sub-diagonals, below `_rows`.
+ * @param _upper The number of super-diagonals, below `_cols`.
+ * @return The offset of the row.
+ */
+constexpr std::size_t BandOffset(const std::size_t _row,
+                                 const std::size_t _rows,
+                                 const std::size_t _cols,
+                                 const std::size_t _lower,
+                                 const std::size_t _upper);
+
+}  // namespace Sglty::Core::Layout
+
+#include "Impl/Layout.tpp"
+
+// Singularity/Core/Layout.hpp
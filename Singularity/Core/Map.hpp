@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Enums.hpp"
+#include "Dense.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+#include "../Simd/Packet.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Fixed-size dense view over an external, tightly packed buffer.
+ *
+ * `Map` holds nothing but a pointer to `_rows * _cols` elements laid out like
+ * those of a `Dense` core with the same major, so memory owned elsewhere
+ * (network payloads, mapped files, arrays of other libraries) can be used as
+ * a `Matrix` operand or assignment target without copying:
+ *
+ * ```
+ * float buf[12];
+ * Sglty::MapMat<float, 3, 4> m(buf);
+ * m = a + b;  // written straight into `buf`
+ * ```
+ *
+ * - The buffer must outlive the view; a default-constructed view refers to
+ *   no storage and may only be destroyed
+ *
+ * - Copy-constructing a `Matrix` of the view copies the pointer; every
+ *   assignment to it, from an expression, another matrix or another view of
+ *   the same type, copies elements into the buffer and never rebinds it
+ *
+ * - `_Tp` may be `const`-qualified for read-only buffers
+ *
+ * - All `core_rebind_*` aliases and `core_base` name `Dense` cores, so
+ *   expressions over views evaluate into owning matrices and mix freely with
+ *   `Dense` operands
+ *
+ * @tparam _Tp         The scalar element type, optionally `const`.
+ * @tparam _rows       The number of rows in the matrix.
+ * @tparam _cols       The number of columns in the matrix.
+ * @tparam _core_major The memory layout (row-major or column-major).
+ *
+ * @see Sglty::Core::MapStrided
+ * @see Sglty::Traits::Core::is_view_v
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+class Map {
+  static_assert(_core_major == Core::Major::Row ||
+                    _core_major == Core::Major::Col,
+                "Error: `_core_major` must be `Row` or `Col`.");
+
+  using _m_value = std::remove_const_t<_Tp>;
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout, view semantics and type identity.
+  using core_traits =
+      Traits::Core::GetView<Core::Type::Dense,
+                            _core_major,
+                            _core_major == Core::Major::Row ? _cols : _rows>;
+
+  /**
+   * @brief Rebinds the core to an owning `Dense` core of a new size.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size =
+      Dense<_m_value, _rebind_rows, _rebind_cols, _core_major>;
+
+  /**
+   * @brief Rebinds the core to an owning `Dense` core of a new value type.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = Dense<_rebind_value, _rows, _cols, _core_major>;
+
+  /**
+   * @brief Rebinds the core to an owning `Dense` core of a different memory
+   * layout.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Dense<_m_value, _rows, _cols, _rebind_major>;
+
+  /**
+   * @brief Alias to the zero-sized `Dense` base with the same layout.
+   */
+  using core_base = Dense<_m_value, 0, 0, _core_major>;
+
+  /**
+   * @brief Constructs a view that refers to no storage.
+   */
+  constexpr Map() = default;
+
+  /**
+   * @brief Constructs a view over `_rows * _cols` elements starting at
+   * `_data`.
+   *
+   * @param _data Pointer to the first element of the external buffer.
+   */
+  constexpr explicit Map(pointer _data);
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns the pointer to the viewed buffer.
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns the pointer to the viewed buffer.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  constexpr const_pointer Data() const;
+
+  /**
+   * @brief Loads a SIMD packet starting at (_row, _col).
+   *
+   * Reads `Simd::Packet<value_type>::size` consecutive elements along the
+   * major axis, without assuming any alignment of the buffer. Only available
+   * for vectorizable value types.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return The loaded packet.
+   */
+  Simd::Packet<value_type> LoadPacket(const size_type _row,
+                                      const size_type _col) const;
+
+  /**
+   * @brief Stores a SIMD packet starting at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @param _p   The packet to store.
+   */
+  void StorePacket(const size_type _row,
+                   const size_type _col,
+                   const Simd::Packet<value_type>& _p);
+
+ private:
+  pointer _m_data = nullptr;
+
+  constexpr size_type _m_Offset(const size_type _row,
+                                const size_type _col) const;
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Map.tpp"
+
+// Singularity/Core/Map.hpp
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Enums.hpp"
+#include "Dense.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+#include "../Simd/Packet.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Fixed-size dense view over an external buffer with a runtime leading
+ * dimension.
+ *
+ * Same as `Map`, except that consecutive rows (row-major) or columns
+ * (column-major) start `OuterStride()` elements apart instead of being
+ * tightly packed; elements along the major axis stay contiguous. This covers
+ * padded rows, a panel of a larger buffer, or BLAS-style `lda` arguments:
+ *
+ * ```
+ * double big[100 * 64];
+ * Sglty::MapStridedMat<double, 8, 8> tile(big + 16 * 64 + 8, 64);
+ * ```
+ *
+ * The leading dimension is published as `Sglty::Traits::Size::dynamic` in
+ * `core_traits` and read through `OuterStride()`. As for `Map`, copies of a
+ * `Matrix` of the view share the buffer, and assignments copy elements into
+ * it.
+ *
+ * @tparam _Tp         The scalar element type, optionally `const`.
+ * @tparam _rows       The number of rows in the matrix.
+ * @tparam _cols       The number of columns in the matrix.
+ * @tparam _core_major The memory layout (row-major or column-major).
+ *
+ * @see Sglty::Core::Map
+ * @see Sglty::Traits::Core::is_view_v
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+class MapStrided {
+  static_assert(_core_major == Core::Major::Row ||
+                    _core_major == Core::Major::Col,
+                "Error: `_core_major` must be `Row` or `Col`.");
+
+  using _m_value = std::remove_const_t<_Tp>;
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout, view semantics and type identity.
+  using core_traits = Traits::Core::
+      GetView<Core::Type::Dense, _core_major, Traits::Size::dynamic>;
+
+  /**
+   * @brief Rebinds the core to an owning `Dense` core of a new size.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size =
+      Dense<_m_value, _rebind_rows, _rebind_cols, _core_major>;
+
+  /**
+   * @brief Rebinds the core to an owning `Dense` core of a new value type.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = Dense<_rebind_value, _rows, _cols, _core_major>;
+
+  /**
+   * @brief Rebinds the core to an owning `Dense` core of a different memory
+   * layout.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Dense<_m_value, _rows, _cols, _rebind_major>;
+
+  /**
+   * @brief Alias to the zero-sized `Dense` base with the same layout.
+   */
+  using core_base = Dense<_m_value, 0, 0, _core_major>;
+
+  /**
+   * @brief Constructs a view that refers to no storage.
+   */
+  constexpr MapStrided() = default;
+
+  /**
+   * @brief Constructs a view whose rows (row-major) or columns (column-major)
+   * start every `_outer_stride` elements from `_data`.
+   *
+   * Throws `std::invalid_argument` if `_outer_stride` is smaller than the
+   * extent of the major axis, as rows / columns would overlap.
+   *
+   * @param _data         Pointer to the first element of the external buffer.
+   * @param _outer_stride Elements between consecutive rows / columns.
+   */
+  constexpr MapStrided(pointer _data, const size_type _outer_stride);
+
+  /**
+   * @brief Returns the distance in elements between consecutive rows
+   * (row-major) or columns (column-major).
+   */
+  constexpr size_type OuterStride() const;
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns the pointer to the first viewed element.
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns the pointer to the first viewed element.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  constexpr const_pointer Data() const;
+
+  /**
+   * @brief Loads a SIMD packet starting at (_row, _col).
+   *
+   * Reads `Simd::Packet<value_type>::size` consecutive elements along the
+   * major axis, without assuming any alignment of the buffer. Only available
+   * for vectorizable value types.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return The loaded packet.
+   */
+  Simd::Packet<value_type> LoadPacket(const size_type _row,
+                                      const size_type _col) const;
+
+  /**
+   * @brief Stores a SIMD packet starting at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @param _p   The packet to store.
+   */
+  void StorePacket(const size_type _row,
+                   const size_type _col,
+                   const Simd::Packet<value_type>& _p);
+
+ private:
+  pointer _m_data           = nullptr;
+  size_type _m_outer_stride = 0;
+
+  constexpr size_type _m_Offset(const size_type _row,
+                                const size_type _col) const;
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/MapStrided.tpp"
+
+// Singularity/Core/MapStrided.hpp
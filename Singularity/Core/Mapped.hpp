@@ -0,0 +1,320 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Enums.hpp"
+#include "Layout.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+#include "../Simd/Packet.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Runtime-sized dense matrix core stored in a memory mapping, for
+ * matrices larger than RAM.
+ *
+ * Elements are stored in `_tile` x `_tile` tiles (see
+ * `Sglty::Traits::Core::GetTiled`): tiles follow each other in `_core_major`
+ * order, and so do the elements within a tile. Edge tiles are padded to the
+ * full size, so every tile is one contiguous, equally sized run of bytes and
+ * starts page-aligned whenever a tile spans whole pages (e.g. 64 x 64
+ * elements of 1 to 8 bytes). A block of rows and columns is then a few
+ * contiguous runs of pages, whatever the major it is read in.
+ *
+ * The mapping is either anonymous, paged out to swap under memory pressure,
+ * or a shared mapping of a file, paged out to the file and kept there:
+ * ```
+ * #include "Singularity/Core/Mapped.hpp"
+ *
+ * Sglty::MappedMat<float> x("features.bin", rows, cols);  // file-backed
+ * Sglty::MappedMat<float> y(rows, cols);                  // anonymous
+ * y = x * 2.0f + y;  // evaluated one strip of tiles at a time
+ * ```
+ *
+ * - Assignments to a `Mapped` matrix are evaluated tile by tile, in strips of
+ *   one row (or column) of tiles; before a strip is evaluated the next one of
+ *   every `Mapped` operand read element-wise is prefetched, and once done
+ *   its pages are marked to be reclaimed first (see `Core::Advice`)
+ *
+ * - Copies are anonymous mappings holding a copy of every element; moves
+ *   steal the mapping, and the moved-from core is 0 x 0. Assigning to a core
+ *   mapping a file always copies into the file, so results of expressions
+ *   reach it, and throws `std::invalid_argument` for another shape
+ *
+ * - Resizing an anonymous mapping clears the elements; a core mapping a file
+ *   keeps the shape it was opened with and refuses to resize, so the data in
+ *   the file is never truncated
+ *
+ * - Dense kernels reading `Data()` with strides (products, `Block()`, ...) do
+ *   not apply; products over `Mapped` operands are evaluated element by
+ *   element, so copy the blocks to multiply into a `Dynamic` first
+ *
+ * Requires POSIX `mmap()`, so it is not included by `Lib.hpp`. Not usable in
+ * constant expressions.
+ *
+ * @tparam _Tp         The scalar element type, trivially copyable.
+ * @tparam _core_major The order of tiles and of elements within a tile.
+ * @tparam _tile       The extent of a tile.
+ */
+template <typename _Tp,
+          Core::Major _core_major = Core::Major::Row,
+          std::size_t _tile       = 64>
+class Mapped {
+  static_assert(std::is_trivially_copyable_v<_Tp>,
+                "Error: `_Tp` must be trivially copyable.");
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits, both extents are `Traits::Size::dynamic`.
+  using size_traits = Traits::Size::
+      Get<Traits::Size::dynamic, Traits::Size::dynamic, size_type>;
+
+  /// Core trait describing layout, tile size and type identity.
+  using core_traits =
+      Traits::Core::GetTiled<Core::Type::Dense, _core_major, _tile>;
+
+  /**
+   * @brief Rebinds the core to a new size; the result stays runtime-sized.
+   *
+   * @tparam _rebind_rows New row count (ignored).
+   * @tparam _rebind_cols New column count (ignored).
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size = Mapped<_Tp, _core_major, _tile>;
+
+  /**
+   * @brief Rebinds the core to a new value type, keeping the tiling.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = Mapped<_rebind_value, _core_major, _tile>;
+
+  /**
+   * @brief Rebinds the core to a different order, keeping the tiling.
+   *
+   * @tparam _rebind_major The new order.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Mapped<_Tp, _rebind_major, _tile>;
+
+  /**
+   * @brief Alias to the base version with the same layout.
+   */
+  using core_base = Mapped<_Tp, _core_major, _tile>;
+
+  /**
+   * @brief Number of bytes a `_rows` x `_cols` core maps: every tile covering
+   * it, padding included.
+   *
+   * @param _rows The number of rows.
+   * @param _cols The number of columns.
+   * @return The size of the mapping.
+   */
+  static size_type Bytes(const size_type _rows, const size_type _cols);
+
+  /**
+   * @brief Constructs an empty (0 x 0) core, mapping nothing.
+   */
+  Mapped() = default;
+
+  /**
+   * @brief Constructs a `_rows` x `_cols` core in an anonymous mapping, with
+   * every element zero.
+   *
+   * @param _rows The number of rows.
+   * @param _cols The number of columns.
+   * @throws std::system_error if the mapping cannot be created.
+   */
+  Mapped(const size_type _rows, const size_type _cols);
+
+  /**
+   * @brief Constructs a `_rows` x `_cols` core in an anonymous mapping, with
+   * all elements initialized to a value.
+   *
+   * @param _rows The number of rows.
+   * @param _cols The number of columns.
+   * @param val   The value to fill every element with.
+   * @throws std::system_error if the mapping cannot be created.
+   */
+  Mapped(const size_type _rows, const size_type _cols, value_type val);
+
+  /**
+   * @brief Maps the file at `_path` as a `_rows` x `_cols` core.
+   *
+   * The file is created if missing. A file of exactly `Bytes(_rows, _cols)`
+   * keeps its contents, so a matrix written earlier with the same shape,
+   * element type, major and tile size is read back as is; a new (empty)
+   * file is sized to it, with every element zero. Writes reach the file as
+   * pages are written back.
+   *
+   * @param _path The path of the file.
+   * @param _rows The number of rows.
+   * @param _cols The number of columns.
+   * @throws std::invalid_argument if the file is neither empty nor of
+   * `Bytes(_rows, _cols)`; it is left untouched.
+   * @throws std::system_error if the file cannot be opened, sized or mapped.
+   */
+  Mapped(const char* _path, const size_type _rows, const size_type _cols);
+
+  Mapped(const Mapped& _other);
+  Mapped(Mapped&& _other) noexcept;
+
+  /**
+   * @brief Copies the shape and elements of `_other`, into the file if this
+   * core maps one.
+   *
+   * @throws std::invalid_argument if this core maps a file and `_other` has
+   * another shape (see `Resize()`).
+   */
+  Mapped& operator=(const Mapped& _other);
+
+  /**
+   * @brief Takes the mapping of `_other`, releasing the current one, or
+   * copies it as by `operator=(const Mapped&)` if this core maps a file.
+   *
+   * Not `noexcept`, unlike the move constructor: copying into a file throws
+   * `std::invalid_argument` when the shapes differ, leaving the file as is.
+   */
+  Mapped& operator=(Mapped&& _other);
+
+  ~Mapped();
+
+  /**
+   * @brief Returns the current number of rows.
+   */
+  size_type Rows() const;
+
+  /**
+   * @brief Returns the current number of columns.
+   */
+  size_type Cols() const;
+
+  /**
+   * @brief Changes the shape of the core.
+   *
+   * Every element is zero afterwards. Does nothing if the shape is
+   * unchanged.
+   *
+   * @param _rows The new number of rows.
+   * @param _cols The new number of columns.
+   * @throws std::invalid_argument if the shape changes and this core maps a
+   * file, which is never truncated.
+   * @throws std::system_error if the mapping cannot be created.
+   */
+  void Resize(const size_type _rows, const size_type _cols);
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  const_reference At(const size_type _row, const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the first tile.
+   *
+   * @return Mutable pointer to the mapping, `nullptr` when empty.
+   */
+  pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the first tile.
+   *
+   * @return Const pointer to the mapping, `nullptr` when empty.
+   */
+  const_pointer Data() const;
+
+  /**
+   * @brief Loads a SIMD packet starting at (_row, _col).
+   *
+   * Reads `Simd::Packet<value_type>::size` consecutive elements along the
+   * major axis, which must not cross a tile: `_col` (row-major) or `_row`
+   * (column-major) is a multiple of the packet size, as in
+   * `Sglty::Types::TraversePacket`. Only available for vectorizable value
+   * types whose packet size divides `_tile`.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return The loaded packet.
+   */
+  Simd::Packet<value_type> LoadPacket(const size_type _row,
+                                      const size_type _col) const;
+
+  /**
+   * @brief Stores a SIMD packet starting at (_row, _col).
+   *
+   * Same requirements as `LoadPacket()`.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @param _p   The packet to store.
+   */
+  void StorePacket(const size_type _row,
+                   const size_type _col,
+                   const Simd::Packet<value_type>& _p);
+
+  /**
+   * @brief Passes an access hint for the tiles covering a region to the
+   * kernel (`madvise()`).
+   *
+   * Hints are best effort and never change element values; `Advice::Cold`
+   * does nothing where the kernel lacks `MADV_COLD`.
+   *
+   * @param _row    The first row of the region.
+   * @param _col    The first column of the region.
+   * @param _rows   The number of rows of the region.
+   * @param _cols   The number of columns of the region.
+   * @param _advice The hint.
+   */
+  void Advise(const size_type _row,
+              const size_type _col,
+              const size_type _rows,
+              const size_type _cols,
+              const Core::Advice _advice) const;
+
+ private:
+  static constexpr size_type _m_tile_size = _tile * _tile;
+
+  size_type _m_rows = 0;
+  size_type _m_cols = 0;
+
+  pointer _m_data    = nullptr;
+  size_type _m_bytes = 0;
+  int _m_fd          = -1;
+
+  void _m_Map(const size_type _rows, const size_type _cols);
+  void _m_Unmap();
+
+  size_type _m_Offset(const size_type _row, const size_type _col) const;
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Mapped.tpp"
+
+// Singularity/Core/Mapped.hpp
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+
+#include "Enums.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Fixed-size compressed sparse matrix core (CSR / CSC).
+ *
+ * Stores at most `_max_nnz` explicit entries in compressed form, along the
+ * major axis given by `_core_major`:
+ *
+ * - `Major::Row` is compressed sparse row (CSR): row `i` owns the entries
+ *   `OuterIndex()[i]` up to `OuterIndex()[i + 1]`
+ *
+ * - `Major::Col` is compressed sparse column (CSC), the same with columns
+ *
+ * Within one row (or column) the entries are sorted by their inner index
+ * (`InnerIndex()`), and their values are stored contiguously in `Data()`.
+ * All three buffers are fixed-size arrays, so the core is usable in constant
+ * expressions and never allocates.
+ *
+ * Element access follows the usual core interface:
+ *
+ * - the const `At()` returns a reference to a shared zero for entries that
+ *   are not stored
+ *
+ * - the mutable `At()` inserts the entry (as zero) if it is not stored yet.
+ *   Inserting in storage order, as `Sglty::Types::Traverse` does, only ever
+ *   appends. Exceeding `_max_nnz` throws `std::length_error`
+ *
+ * `Sglty::Expr::Assign` only stores non-zero results into a sparse matrix,
+ * and evaluates sums and products of sparse operands over their stored
+ * entries only (see `Sglty::Kernel::SparseDense`, `SparseSparse` and
+ * `SparseMerge`).
+ *
+ * @tparam _Tp         The scalar element type.
+ * @tparam _rows       The number of rows in the matrix.
+ * @tparam _cols       The number of columns in the matrix.
+ * @tparam _core_major The compressed axis (`Row` for CSR, `Col` for CSC).
+ * @tparam _max_nnz    Maximum number of explicitly stored entries.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _max_nnz>
+class Sparse {
+  static_assert(_core_major == Core::Major::Row ||
+                    _core_major == Core::Major::Col,
+                "Error: `_core_major` must be `Row` (CSR) or `Col` (CSC).");
+
+  static constexpr std::size_t _m_outer_size =
+      _core_major == Core::Major::Row ? _rows : _cols;
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing the compressed axis and type identity.
+  using core_traits = Traits::Core::Get<Core::Type::Sparse, _core_major>;
+
+  /// Maximum number of explicitly stored entries.
+  static constexpr size_type capacity = _max_nnz;
+
+  /**
+   * @brief Rebinds the core to a new size, keeping the entry capacity.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size =
+      Sparse<_Tp, _rebind_rows, _rebind_cols, _core_major, _max_nnz>;
+
+  /**
+   * @brief Rebinds the core to a new value type.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value =
+      Sparse<_rebind_value, _rows, _cols, _core_major, _max_nnz>;
+
+  /**
+   * @brief Rebinds the core to the other compressed axis (CSR <-> CSC).
+   *
+   * @tparam _rebind_major The new compressed axis.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major =
+      Sparse<_Tp, _rows, _cols, _rebind_major, _max_nnz>;
+
+  /**
+   * @brief Alias to a zero-sized base version with the same layout and
+   * capacity.
+   */
+  using core_base = Sparse<_Tp, 0, 0, _core_major, _max_nnz>;
+
+  /**
+   * @brief Constructs an empty core (all elements zero).
+   */
+  constexpr Sparse() = default;
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * Inserts a zero entry first if the element is not stored yet.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the stored element.
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the stored element, or to zero.
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the values of the stored entries.
+   *
+   * @return Mutable pointer to the first of `NonZeros()` values.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the values of the stored entries.
+   *
+   * @return Const pointer to the first of `NonZeros()` values.
+   */
+  constexpr const_pointer Data() const;
+
+  /**
+   * @brief Returns the number of explicitly stored entries.
+   */
+  constexpr size_type NonZeros() const;
+
+  /**
+   * @brief Returns the offsets of each row (CSR) or column (CSC).
+   *
+   * Holds `outer size + 1` monotonic offsets into `InnerIndex()` and
+   * `Data()`, the last one being `NonZeros()`.
+   *
+   * @return Mutable pointer to the first offset.
+   */
+  constexpr size_type* OuterIndex();
+
+  /**
+   * @brief Returns the offsets of each row (CSR) or column (CSC).
+   *
+   * @return Const pointer to the first offset.
+   */
+  constexpr const size_type* OuterIndex() const;
+
+  /**
+   * @brief Returns the column (CSR) or row (CSC) index of each stored entry.
+   *
+   * @return Mutable pointer to the first of `NonZeros()` indices.
+   */
+  constexpr size_type* InnerIndex();
+
+  /**
+   * @brief Returns the column (CSR) or row (CSC) index of each stored entry.
+   *
+   * @return Const pointer to the first of `NonZeros()` indices.
+   */
+  constexpr const size_type* InnerIndex() const;
+
+ private:
+  static constexpr value_type _m_zero{};
+
+  std::array<size_type, _m_outer_size + 1> _m_outer{};
+  std::array<size_type, _max_nnz> _m_inner{};
+  std::array<_Tp, _max_nnz> _m_values{};
+
+  constexpr size_type _m_Find(const size_type _outer,
+                              const size_type _inner) const;
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Sparse.tpp"
+
+// Singularity/Core/Sparse.hpp
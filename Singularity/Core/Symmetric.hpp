@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <type_traits>
+
+#include "Enums.hpp"
+#include "Dense.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Fixed-size symmetric matrix core in packed storage.
+ *
+ * Element (i, j) equals element (j, i), so only the upper triangle is
+ * stored, `_size * (_size + 1) / 2` elements row after row (row `i` from
+ * column `i` on):
+ *
+ * - both `At()` map an element below the diagonal to its mirror, so writing
+ *   one writes both
+ *
+ * - `Sglty::Types::Traverse` only visits the upper triangle, so assigning an
+ *   expression reads its upper triangle
+ *
+ * A symmetric matrix is its own transpose. Sums of symmetric matrices stay
+ * symmetric; products, and sums with other cores, are dense (see
+ * `Sglty::Traits::Core::sum_t` and `product_t`).
+ *
+ * @tparam _Tp   The scalar element type.
+ * @tparam _size The number of rows and columns in the matrix.
+ */
+template <typename _Tp, std::size_t _size>
+class Symmetric {
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_size, _size, size_type>;
+
+  /// Core trait describing the symmetry and type identity.
+  using core_traits = Traits::Core::
+      GetStructured<Traits::Size::dynamic, Traits::Size::dynamic, true>;
+
+  /**
+   * @brief Rebinds the core to a new size; only square shapes stay
+   * symmetric, others rebind to a dense core.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size =
+      std::conditional_t<_rebind_rows == _rebind_cols,
+                         Symmetric<_Tp, _rebind_rows>,
+                         Dense<_Tp, _rebind_rows, _rebind_cols, Major::Row>>;
+
+  /**
+   * @brief Rebinds the core to a new value type.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value = Symmetric<_rebind_value, _size>;
+
+  /**
+   * @brief Rebinds the core to a dense one of the same shape.
+   *
+   * @tparam _rebind_major The layout of the dense core.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Dense<_Tp, _size, _size, _rebind_major>;
+
+  /**
+   * @brief The core of the transpose, the same core.
+   */
+  using core_transpose = Symmetric<_Tp, _size>;
+
+  /**
+   * @brief Alias to a zero-sized base version.
+   */
+  using core_base = Symmetric<_Tp, 0>;
+
+  /**
+   * @brief Constructs a core with every element zero.
+   */
+  constexpr Symmetric() = default;
+
+  /**
+   * @brief Constructs a core with all elements initialized to a value.
+   *
+   * @param val The value to fill every element with.
+   */
+  constexpr Symmetric(value_type val);
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the stored element, shared with (_col, _row).
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the stored element, shared with (_col, _row).
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the stored elements.
+   *
+   * @return Mutable pointer to the upper triangle, row after row.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the stored elements.
+   *
+   * @return Const pointer to the upper triangle, row after row.
+   */
+  constexpr const_pointer Data() const;
+
+ private:
+  std::array<_Tp, _size * (_size + 1) / 2> _m_data{};
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Symmetric.tpp"
+
+// Singularity/Core/Symmetric.hpp
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "../Config.hpp"
+
+namespace Sglty::Exec {
+
+/**
+ * @brief A unit of parallel work, called with the index of a panel.
+ */
+using Task = std::function<void(std::size_t)>;
+
+/**
+ * @brief Type-erased executor used for parallel evaluation.
+ *
+ * `executor(tasks, fn)` must call `fn(t)` exactly once for every `t` in
+ * `[0, tasks)`, in any order and on any threads, and only return once every
+ * call has finished. An exception thrown by `fn` should be rethrown to the
+ * caller. Any callable with that behaviour can be installed through
+ * `SetExecutor()`, e.g. `Serial`, a `ThreadPool` (through `std::ref`), a
+ * `Policy` over a `std::execution` policy or an adapter to another pool.
+ */
+using Executor = std::function<void(std::size_t, const Task&)>;
+
+/**
+ * @brief Executor running every task on the calling thread, in order.
+ */
+struct Serial {
+  /**
+   * @brief Calls `_fn(0)`, ..., `_fn(_tasks - 1)`.
+   *
+   * @param _tasks The number of tasks.
+   * @param _fn    The task to run.
+   */
+  void operator()(std::size_t _tasks, const Task& _fn) const;
+};
+
+/**
+ * @brief Returns the executor used for parallel evaluation.
+ *
+ * Defaults to the process-wide `ThreadPool::Global()`, which is only started
+ * on first use.
+ *
+ * @return The current executor.
+ */
+const Executor& GetExecutor();
+
+/**
+ * @brief Replaces the executor used for parallel evaluation.
+ *
+ * Must not be called while another thread is evaluating an expression.
+ *
+ * @param _executor The new executor. Must not be empty.
+ * @return The previous executor.
+ */
+Executor SetExecutor(Executor _executor);
+
+/**
+ * @brief Number of consecutive indices of an axis handled by one panel.
+ *
+ * Chosen so that a panel performs about `SGLTY_PARALLEL_GRAIN` scalar
+ * operations, rounded up to a multiple of `_multiple` and clamped to
+ * `_extent`. The result only depends on the arguments, so panels, and
+ * therefore the operations each output element goes through, are the same
+ * for every executor and thread count.
+ *
+ * @param _extent   The number of indices along the split axis.
+ * @param _work     Estimated scalar operations per index.
+ * @param _multiple Granularity of panel boundaries.
+ * @return The panel length, at least 1 unless `_extent` is 0.
+ */
+constexpr std::size_t PanelSize(std::size_t _extent,
+                                std::size_t _work,
+                                std::size_t _multiple = 1);
+
+/**
+ * @brief Checks whether `ParallelFor()` would hand work to the executor.
+ *
+ * False during constant evaluation, below `SGLTY_PARALLEL_THRESHOLD`, for a
+ * single task, and from inside a task already running in parallel (nested
+ * evaluations stay on their thread instead of waiting on the executor).
+ *
+ * @param _work  Estimated scalar operations of the whole evaluation.
+ * @param _tasks The number of panels.
+ * @return `true` if the panels would run in parallel.
+ */
+bool IsParallel(std::size_t _work, std::size_t _tasks);
+
+/**
+ * @brief Runs `_fn(0)`, ..., `_fn(_tasks - 1)`, in parallel if `IsParallel()`
+ * holds and in order on the calling thread otherwise.
+ *
+ * Tasks must write disjoint outputs. Callers that combine per-task results
+ * (e.g. partial sums) should do so in task order after this returns, which
+ * keeps the result independent of scheduling.
+ *
+ * `_fn` is handed to the executor by reference, so no `Task` owning a copy
+ * of it is allocated.
+ *
+ * @tparam _func A callable taking the index of a panel.
+ * @param _work  Estimated scalar operations of the whole evaluation.
+ * @param _tasks The number of panels.
+ * @param _fn    The task to run.
+ */
+template <typename _func>
+void ParallelFor(std::size_t _work, std::size_t _tasks, const _func& _fn);
+
+}  // namespace Sglty::Exec
+
+#include "Impl/Executor.tpp"
+
+// Singularity/Exec/Executor.hpp
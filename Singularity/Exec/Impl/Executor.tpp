@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../Executor.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#include "../ThreadPool.hpp"
+
+namespace Sglty::Exec {
+
+namespace Impl {
+
+inline Executor& Current() {
+  static Executor executor = [](std::size_t tasks, const Task& fn) {
+    ThreadPool::Global()(tasks, fn);
+  };
+  return executor;
+}
+
+// Set while the current thread runs a task of `ParallelFor()`.
+inline bool& InTask() {
+  thread_local bool in_task = false;
+  return in_task;
+}
+
+}  // namespace Impl
+
+inline void Serial::operator()(std::size_t _tasks, const Task& _fn) const {
+  for (std::size_t t = 0; t < _tasks; t++) {
+    _fn(t);
+  }
+}
+
+inline const Executor& GetExecutor() {
+  return Impl::Current();
+}
+
+inline Executor SetExecutor(Executor _executor) {
+  return std::exchange(Impl::Current(), std::move(_executor));
+}
+
+constexpr std::size_t PanelSize(std::size_t _extent,
+                                std::size_t _work,
+                                std::size_t _multiple) {
+  if (_extent == 0) {
+    return 0;
+  }
+  const std::size_t work = _work == 0 ? 1 : _work;
+  // Saturated estimates must not wrap around to an empty panel.
+  std::size_t panel = work >= std::size_t{SGLTY_PARALLEL_GRAIN}
+                          ? 1
+                          : (SGLTY_PARALLEL_GRAIN + work - 1) / work;
+  panel = (panel + _multiple - 1) / _multiple * _multiple;
+  return panel < _extent ? panel : _extent;
+}
+
+inline bool IsParallel(std::size_t _work, std::size_t _tasks) {
+  return SGLTY_PARALLEL_THRESHOLD != 0 && _tasks > 1 &&
+         _work >= std::size_t{SGLTY_PARALLEL_THRESHOLD} && !Impl::InTask();
+}
+
+template <typename _func>
+void ParallelFor(std::size_t _work, std::size_t _tasks, const _func& _fn) {
+  if (!IsParallel(_work, _tasks)) {
+    for (std::size_t t = 0; t < _tasks; t++) {
+      _fn(t);
+    }
+    return;
+  }
+
+  // A single reference fits the small-object buffer of `Task`.
+  GetExecutor()(_tasks, [&_fn](std::size_t t) {
+    bool& in_task    = Impl::InTask();
+    const bool outer = std::exchange(in_task, true);
+    struct Restore {
+      bool& flag;
+      bool value;
+      ~Restore() { flag = value; }
+    } restore{in_task, outer};
+
+    _fn(t);
+  });
+}
+
+}  // namespace Sglty::Exec
+
+// Singularity/Exec/Impl/Executor.tpp
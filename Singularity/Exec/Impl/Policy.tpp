@@ -0,0 +1,26 @@
+#pragma once
+
+#include "../Policy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace Sglty::Exec {
+
+template <typename _policy>
+Policy<_policy>::Policy(_policy _p) : _m_policy(_p) {}
+
+template <typename _policy>
+void Policy<_policy>::operator()(std::size_t _tasks, const Task& _fn) const {
+  std::vector<std::size_t> tasks(_tasks);
+  std::iota(tasks.begin(), tasks.end(), std::size_t{0});
+
+  std::for_each(
+      _m_policy, tasks.begin(), tasks.end(), [&](std::size_t t) { _fn(t); });
+}
+
+}  // namespace Sglty::Exec
+
+// Singularity/Exec/Impl/Policy.tpp
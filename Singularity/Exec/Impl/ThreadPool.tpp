@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../ThreadPool.hpp"
+
+#include <cstddef>
+
+namespace Sglty::Exec {
+
+inline ThreadPool::ThreadPool(std::size_t _threads) {
+  const std::size_t workers = _threads > 1 ? _threads - 1 : 0;
+
+  _m_workers.reserve(workers);
+  for (std::size_t w = 0; w < workers; w++) {
+    _m_workers.emplace_back([this] { _m_Work(); });
+  }
+}
+
+inline ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(_m_mutex);
+    _m_stop = true;
+  }
+  _m_wake.notify_all();
+  for (std::thread& worker : _m_workers) {
+    worker.join();
+  }
+}
+
+inline std::size_t ThreadPool::Size() const {
+  return _m_workers.size() + 1;
+}
+
+inline void ThreadPool::operator()(std::size_t _tasks, const Task& _fn) {
+  if (_m_workers.empty() || _tasks <= 1) {
+    Serial{}(_tasks, _fn);
+    return;
+  }
+
+  std::lock_guard<std::mutex> submit(_m_submit);
+  {
+    std::lock_guard<std::mutex> lock(_m_mutex);
+    _m_task  = &_fn;
+    _m_tasks = _tasks;
+    _m_error = nullptr;
+    _m_next.store(0, std::memory_order_relaxed);
+    _m_busy = _m_workers.size();
+    _m_batch++;
+  }
+  _m_wake.notify_all();
+
+  _m_Drain(_fn, _tasks);
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(_m_mutex);
+    _m_done.wait(lock, [this] { return _m_busy == 0; });
+    _m_task = nullptr;
+    error   = std::exchange(_m_error, nullptr);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+inline ThreadPool& ThreadPool::Global() {
+  static ThreadPool pool;
+  return pool;
+}
+
+inline void ThreadPool::_m_Work() {
+  std::size_t seen = 0;
+
+  for (;;) {
+    const Task* task  = nullptr;
+    std::size_t tasks = 0;
+    {
+      std::unique_lock<std::mutex> lock(_m_mutex);
+      _m_wake.wait(lock, [&] { return _m_stop || _m_batch != seen; });
+      if (_m_stop) {
+        return;
+      }
+      seen  = _m_batch;
+      task  = _m_task;
+      tasks = _m_tasks;
+    }
+
+    _m_Drain(*task, tasks);
+
+    {
+      std::lock_guard<std::mutex> lock(_m_mutex);
+      _m_busy--;
+    }
+    _m_done.notify_one();
+  }
+}
+
+inline void ThreadPool::_m_Drain(const Task& _fn, std::size_t _tasks) {
+  for (;;) {
+    const std::size_t t = _m_next.fetch_add(1, std::memory_order_relaxed);
+    if (t >= _tasks) {
+      return;
+    }
+    try {
+      _fn(t);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(_m_mutex);
+      if (!_m_error) {
+        _m_error = std::current_exception();
+      }
+    }
+  }
+}
+
+}  // namespace Sglty::Exec
+
+// Singularity/Exec/Impl/ThreadPool.tpp
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <execution>
+#include <type_traits>
+
+#include "Executor.hpp"
+
+namespace Sglty::Exec {
+
+/**
+ * @brief Adapts a standard execution policy into an `Executor`.
+ *
+ * Runs the tasks through `std::for_each(policy, ...)` over their indices:
+ * ```
+ * #include <execution>
+ * #include "Singularity/Exec/Policy.hpp"
+ *
+ * Sglty::Exec::SetExecutor(Sglty::Exec::Policy(std::execution::par));
+ * ```
+ * Not included by `Lib.hpp`, so that `<execution>` is only pulled in where
+ * needed. As with every standard parallel algorithm, an exception escaping a
+ * task calls `std::terminate()` for the parallel policies.
+ *
+ * @tparam _policy A type satisfying `std::is_execution_policy`.
+ */
+template <typename _policy>
+class Policy {
+  static_assert(std::is_execution_policy_v<_policy>,
+                "Error: `_policy` is not an execution policy.");
+
+ public:
+  /**
+   * @brief Stores the policy to run tasks with.
+   *
+   * @param _p The execution policy.
+   */
+  explicit Policy(_policy _p);
+
+  /**
+   * @brief Runs `_fn(0)`, ..., `_fn(_tasks - 1)` under the stored policy.
+   *
+   * @param _tasks The number of tasks.
+   * @param _fn    The task to run.
+   */
+  void operator()(std::size_t _tasks, const Task& _fn) const;
+
+ private:
+  _policy _m_policy;
+};
+
+}  // namespace Sglty::Exec
+
+#include "Impl/Policy.tpp"
+
+// Singularity/Exec/Policy.hpp
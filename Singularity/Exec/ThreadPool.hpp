@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Executor.hpp"
+
+namespace Sglty::Exec {
+
+/**
+ * @brief Fixed-size pool of worker threads usable as an `Executor`.
+ *
+ * A call `pool(tasks, fn)` publishes the batch, lets the workers and the
+ * calling thread pick task indices from a shared counter until none are
+ * left, and returns once every task has finished. Batches from concurrent
+ * callers are run one after another.
+ *
+ * The first exception thrown by a task is rethrown to the caller once the
+ * batch has finished; the remaining tasks still run.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief Starts `_threads - 1` workers; the calling thread of each batch
+   * is the remaining one.
+   *
+   * @param _threads Total number of threads running a batch, at least 1.
+   */
+  explicit ThreadPool(
+      std::size_t _threads = std::thread::hardware_concurrency());
+
+  ThreadPool(const ThreadPool&)            = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * @brief Stops and joins every worker.
+   */
+  ~ThreadPool();
+
+  /**
+   * @brief Returns the number of threads running a batch.
+   */
+  std::size_t Size() const;
+
+  /**
+   * @brief Runs `_fn(0)`, ..., `_fn(_tasks - 1)` over the pool.
+   *
+   * @param _tasks The number of tasks.
+   * @param _fn    The task to run.
+   */
+  void operator()(std::size_t _tasks, const Task& _fn);
+
+  /**
+   * @brief Returns the process-wide pool, sized to the hardware concurrency.
+   *
+   * Started on first call.
+   */
+  static ThreadPool& Global();
+
+ private:
+  std::vector<std::thread> _m_workers;
+
+  std::mutex _m_submit;  // serializes batches
+  std::mutex _m_mutex;   // guards the fields below
+  std::condition_variable _m_wake;
+  std::condition_variable _m_done;
+
+  const Task* _m_task = nullptr;
+  std::size_t _m_tasks = 0;
+  std::size_t _m_batch = 0;
+  std::size_t _m_busy  = 0;
+  bool _m_stop         = false;
+
+  std::atomic<std::size_t> _m_next{0};
+  std::exception_ptr _m_error;
+
+  void _m_Work();
+  void _m_Drain(const Task& _fn, std::size_t _tasks);
+};
+
+}  // namespace Sglty::Exec
+
+#include "Impl/ThreadPool.tpp"
+
+// Singularity/Exec/ThreadPool.hpp
@@ -0,0 +1,118 @@
+#pragma once
+
+namespace Sglty::Types {
+
+template <typename>
+class Matrix;
+
+}  // namespace Sglty::Types
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Checks whether evaluating `_e` straight into `_dst` could read
+ * elements of `_dst` after they have been overwritten.
+ *
+ * Candidates are found at compile time through
+ * `Sglty::Traits::Expr::may_alias_v`; only those are compared at runtime:
+ *
+ * - `_dst` itself as an operand is safe if every node above it is
+ *   element-wise (see `Sglty::Traits::Op::is_elementwise_v`) and `_dst` is
+ *   not sparse, as in `a = a + b`, `a = -a` or `a = 2 * a`. Anything else, as
+ *   in `a = a * b` or `a = Trp(a)`, aliases
+ *
+ * - Views (see `Sglty::Traits::Core::is_view_v`) alias when their element
+ *   ranges overlap, unless they are read element-wise with exactly the same
+ *   layout as `_dst`. During constant evaluation any view candidate is
+ *   assumed to alias
+ *
+ * - Distinct owning matrices and materialized sub-expressions never alias
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _expr The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v`.
+ * @param _dst The matrix that would be written.
+ * @param _e The expression that would be evaluated.
+ * @return `true` if `Assign()` needs a scratch buffer.
+ */
+template <typename _core_impl, typename _expr>
+constexpr bool Aliases(const Types::Matrix<_core_impl>& _dst,
+                       const _expr& _e);
+
+/**
+ * @brief Evaluates an expression into an existing matrix.
+ *
+ * This is the evaluation entry point shared by `Matrix::operator=()` and the
+ * compound assignment operators. If `Aliases(_dst, _e)` holds, `_e` is first
+ * evaluated into a temporary of `Sglty::Traits::Core::plain_t<_core_impl>`,
+ * which is then moved (or copied, for views) into `_dst`; otherwise this is
+ * `AssignNoAlias(_dst, _e)`. While a workspace is installed (see
+ * `Sglty::Memory::GetWorkspace()`) heap-backed temporaries are drawn from it
+ * and copied into `_dst` instead.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _expr The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v`.
+ * @param _dst The matrix to write into.
+ * @param _e The expression to evaluate.
+ */
+template <typename _core_impl, typename _expr>
+constexpr void Assign(Types::Matrix<_core_impl>& _dst, const _expr& _e);
+
+/**
+ * @brief Evaluates an expression straight into the storage of an existing
+ * matrix, assuming it does not alias.
+ *
+ * Used directly by `Expr::Evaluate()`, `Matrix(const _expr&)` and
+ * `Matrix::NoAlias()`, where `_dst` cannot be (or is promised not to be) read
+ * by `_e`. The result is unspecified if `Aliases(_dst, _e)` would hold.
+ *
+ * By default every element is computed through `_e(i, j)` while traversing
+ * `_dst` in its storage order. At runtime, some expression shapes are routed
+ * to dedicated kernels instead:
+ *
+ * - `Binary<_lhs, _rhs, MulMatrix>` into row- or column-major
+ *   `Core::Type::Dense` storage runs the blocked `Sglty::Kernel::Gemm` over
+ *   the operands' `Data()` buffers. `Matrix` and `Materialized` operands are
+ *   used in place; other operands whose core is dense are evaluated into a
+ *   temporary first
+ *
+ * - Element-wise expressions whose `Sglty::Traits::Expr::access_v` is
+ *   `Access::Strided` because they read the transpose of a dense matrix of
+ *   the destination's major, of at least `SGLTY_STRIDED_THRESHOLD` elements,
+ *   copy those transposes into temporaries through `Sglty::Kernel::Copy` and
+ *   evaluate the remaining contiguous expression
+ *
+ * - Expressions satisfying `Sglty::Traits::Expr::is_vectorizable_v` into a
+ *   destination of the same core are evaluated one `Simd::Packet` at a time
+ *   along the major axis through `TraversePacket()`, with a scalar tail
+ *
+ * At runtime, dense element-wise and packet evaluations above
+ * `SGLTY_PARALLEL_THRESHOLD` estimated scalar operations are split into
+ * panels of whole rows (row-major) or columns (column-major) and run through
+ * `Sglty::Exec::ParallelFor`, as are the panels of large `Kernel::Gemm`
+ * products. Every element is computed exactly as in the serial evaluation,
+ * so results do not depend on the executor or its thread count.
+ *
+ * During constant evaluation the element-wise path is always used.
+ *
+ * Runtime-sized shapes (see `Sglty::Traits::Size::dynamic`) are reconciled
+ * first: a runtime-sized `_dst` of a different shape is resized to the shape
+ * of `_e`, while a fixed-size `_dst` throws
+ * `std::invalid_argument` if a runtime-sized `_e` does not match it.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _expr The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v`.
+ * @param _dst The matrix to write into.
+ * @param _e The expression to evaluate.
+ */
+template <typename _core_impl, typename _expr>
+constexpr void AssignNoAlias(Types::Matrix<_core_impl>& _dst,
+                             const _expr& _e);
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Assign.tpp"
+
+// Singularity/Expr/Assign.hpp
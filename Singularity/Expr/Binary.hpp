@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
 #include "Tag.hpp"
 #include "../Traits/Expr.hpp"
@@ -24,8 +25,12 @@ namespace Sglty::Expr {
  * Used during expression composition and evaluated when passed into a concrete
  * `Matrix`.
  *
- * @tparam _lhs The left-hand side expression type.
- * @tparam _rhs The right-hand side expression type.
+ * Operands are held according to `Sglty::Traits::Expr::nested_t`: `_lhs` and
+ * `_rhs` are either `const T&` (lvalue matrices) or plain value types
+ * (temporaries, sub-expressions and scalars).
+ *
+ * @tparam _lhs The left-hand side operand storage type.
+ * @tparam _rhs The right-hand side operand storage type.
  * @tparam _op The operation defining evaluation and result metadata.
  */
 template <typename _lhs, typename _rhs, typename _op>
@@ -33,17 +38,18 @@ struct Binary : Tag {
   /**
    * @brief The left-hand side expression.
    */
-  using lhs_type = _lhs;
+  using lhs_type = std::remove_cv_t<std::remove_reference_t<_lhs>>;
 
   /**
-   * @brief The right-hand side expression.
+   * @brief The right-hand side expression (or scalar).
    */
-  using rhs_type = _rhs;
+  using rhs_type = std::remove_cv_t<std::remove_reference_t<_rhs>>;
 
   static_assert(Traits::Expr::is_valid_v<lhs_type>,
                 "Error: `_lhs` is not a valid expression type.");
-  static_assert(Traits::Expr::is_valid_v<rhs_type>,
-                "Error: `_rhs` is not a valid expression type.");
+  static_assert(Traits::Expr::is_valid_v<rhs_type> ||
+                    std::is_arithmetic_v<rhs_type>,
+                "Error: `_rhs` is not a valid expression or scalar type.");
 
   /**
    * @brief The operation tag describing evaluation logic.
@@ -81,12 +87,36 @@ struct Binary : Tag {
   /**
    * @brief Constructs a Binary expression from two operands.
    *
-   * The operands must both be valid expression types.
+   * Each stored operand is initialized directly from the forwarded argument,
+   * so rvalue operands are moved in and operands stored as a different node
+   * type (e.g. `Materialized<lhs>`) are converted in place.
+   *
+   * When an operand is runtime-sized (`Sglty::Traits::Expr::is_dynamic_v`),
+   * the shapes are checked here through `op_type::IsValidDimension()` and a
+   * mismatch throws `std::invalid_argument`. Fixed-size operands are only
+   * checked at compile time.
    *
    * @param _l The left-hand expression operand.
    * @param _r The right-hand expression operand.
    */
-  constexpr Binary(const lhs_type& _l, const rhs_type& _r);
+  template <typename _l_arg, typename _r_arg>
+  constexpr Binary(_l_arg&& _l, _r_arg&& _r);
+
+  /**
+   * @brief Returns the number of rows of the expression.
+   *
+   * Equals `rows` unless the expression is runtime-sized, in which case the
+   * extent is computed from the operands by `op_type::Rows()`.
+   */
+  constexpr std::size_t Rows() const;
+
+  /**
+   * @brief Returns the number of columns of the expression.
+   *
+   * Equals `cols` unless the expression is runtime-sized, in which case the
+   * extent is computed from the operands by `op_type::Cols()`.
+   */
+  constexpr std::size_t Cols() const;
 
   /**
    * @brief Evaluates the expression at a given coordinate.
@@ -99,11 +129,24 @@ struct Binary : Tag {
    */
   constexpr auto operator()(std::size_t i, std::size_t j) const;
 
-  /// Left-hand operand (stored by value).
-  const lhs_type _l;
+  /**
+   * @brief Evaluates a SIMD packet of the expression at a given coordinate.
+   *
+   * Only usable when `Sglty::Traits::Expr::is_vectorizable_v` holds for this
+   * expression. Actual evaluation logic is delegated to `op_type::Packet()`.
+   *
+   * @param i The row index of the first lane.
+   * @param j The column index of the first lane.
+   * @return The packet of consecutive results along the major axis.
+   */
+  auto Packet(std::size_t i, std::size_t j) const;
+
+  /// Left-hand operand (by reference for lvalue matrices, by value otherwise).
+  /// Not `const`, so that folds can move it out of a temporary node.
+  _lhs _l;
 
-  /// Right-hand operand (stored by value).
-  const rhs_type _r;
+  /// Right-hand operand (by reference for lvalue matrices, by value otherwise).
+  _rhs _r;
 };
 
 }  // namespace Sglty::Expr
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Tag.hpp"
+#include "Constant.hpp"
+#include "Materialized.hpp"
+#include "../Traits/Core.hpp"
+#include "../Traits/Expr.hpp"
+#include "../Traits/Size.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Expression node repeating a row or a column vector.
+ *
+ * A `1` x `cols` operand is repeated down the rows and a `rows` x `1`
+ * operand across the columns: element (i, j) reads the operand at (0, j) or
+ * (i, 0). Nothing is copied, so e.g. adding a bias row to every row of `a`
+ * reads the bias from cache. Usually built from `Sglty::Broadcast()`, which
+ * takes the shape of the other operand:
+ * ```
+ * Sglty::DenseMat<float, 64, 16> y = x + Sglty::Broadcast(bias);  // 1 x 16
+ * ```
+ *
+ * Operand elements are read for other positions than their own, so
+ * assigning to the operand from an expression broadcasting it goes through
+ * a scratch buffer (see `Sglty::Expr::Aliases`).
+ *
+ * @tparam _operand   The operand storage type (see
+ * `Sglty::Traits::Expr::nested_t`).
+ * @tparam _core_impl The core the expression evaluates into; owning, not
+ * structured, and of the operand's element type.
+ */
+template <typename _operand, typename _core_impl>
+struct Broadcast : Tag {
+  /**
+   * @brief The repeated vector expression.
+   */
+  using operand_type = std::remove_cv_t<std::remove_reference_t<_operand>>;
+
+  /**
+   * @brief The operand as held by the node.
+   */
+  using nested_type = _operand;
+
+  static_assert(Traits::Expr::is_valid_v<operand_type>,
+                "Error: `_operand` is not a valid expression type.");
+
+  /**
+   * @brief The core implementation the expression evaluates into.
+   */
+  using core_impl = _core_impl;
+
+  static_assert(Traits::Core::is_valid_v<core_impl>,
+                "Error: `_core_impl` is not a valid core implementation.");
+  static_assert(!Traits::Core::is_view_v<core_impl> &&
+                    !Traits::Core::is_structured_v<core_impl>,
+                "Error: generated expressions evaluate into owning, "
+                "unstructured cores.");
+  static_assert(std::is_same_v<typename core_impl::value_type,
+                               typename operand_type::core_impl::value_type>,
+                "Error: `_core_impl` has another element type than "
+                "`_operand`.");
+
+  /**
+   * @brief Number of rows in the expression.
+   */
+  constexpr static std::size_t rows = core_impl::size_traits::rows;
+
+  /**
+   * @brief Number of columns in the expression.
+   */
+  constexpr static std::size_t cols = core_impl::size_traits::cols;
+
+  static_assert(
+      (Traits::Size::is_compatible_v<operand_type::rows, 1> &&
+       Traits::Size::is_compatible_v<operand_type::cols, cols>) ||
+          (Traits::Size::is_compatible_v<operand_type::cols, 1> &&
+           Traits::Size::is_compatible_v<operand_type::rows, rows>),
+      "Error: only a row or a column vector of a matching extent can be "
+      "broadcast.");
+
+  /**
+   * @brief Constructs a broadcast of `_o` to a given shape.
+   *
+   * Throws `std::invalid_argument` if a runtime-sized `_o` is neither a row
+   * of `_cols` nor a column of `_rows` elements.
+   *
+   * @param _o The vector to repeat.
+   * @param _rows The row count, ignored unless runtime-sized.
+   * @param _cols The column count, ignored unless runtime-sized.
+   */
+  constexpr Broadcast(const operand_type& _o,
+                      std::size_t _rows,
+                      std::size_t _cols);
+
+  /**
+   * @brief Returns the number of rows of the expression.
+   */
+  constexpr std::size_t Rows() const;
+
+  /**
+   * @brief Returns the number of columns of the expression.
+   */
+  constexpr std::size_t Cols() const;
+
+  /**
+   * @brief Evaluates the expression at a given coordinate.
+   *
+   * @param i The row index.
+   * @param j The column index.
+   * @return The operand element of column `j` (row vectors) or row `i`
+   * (column vectors).
+   */
+  constexpr auto operator()(std::size_t i, std::size_t j) const;
+
+  /// Stored operand (by reference for lvalue matrices, by value otherwise).
+  const _operand _o;
+
+ private:
+  std::size_t _m_rows;
+  std::size_t _m_cols;
+};
+
+/**
+ * @brief Broadcast without a shape, see `Sglty::Broadcast()`.
+ *
+ * @tparam _operand The operand storage type.
+ */
+template <typename _operand>
+struct UnshapedBroadcast : Unshaped {
+  /**
+   * @brief The broadcast in the shape and core of `_e`, with the elements
+   * of the operand.
+   *
+   * @param _e The other operand.
+   */
+  template <typename _expr>
+  constexpr auto Shape(const _expr& _e) const;
+
+  /// Stored operand (by reference for lvalue matrices, by value otherwise).
+  const _operand _o;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty {
+
+/**
+ * @brief A row or column vector repeated to the shape of the other operand.
+ *
+ * `a + Sglty::Broadcast(row)` adds the `1` x `cols` vector `row` to every row
+ * of `a`, and `a - Sglty::Broadcast(col)` subtracts the `rows` x `1` vector
+ * `col` from every column, through an `Expr::Broadcast` node. Vectors still
+ * containing a product are evaluated once, into an `Expr::Materialized`.
+ *
+ * @tparam _operand The vector expression type.
+ * @param _o The vector to repeat.
+ */
+template <typename _operand>
+constexpr auto Broadcast(_operand&& _o);
+
+}  // namespace Sglty
+
+#include "Impl/Broadcast.tpp"
+
+// Singularity/Expr/Broadcast.hpp
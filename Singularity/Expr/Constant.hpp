@@ -0,0 +1,373 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Tag.hpp"
+#include "../Core/Enums.hpp"
+#include "../Traits/Core.hpp"
+#include "../Traits/Expr.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Type.hpp"
+
+namespace Sglty::Core {
+
+template <typename, std::size_t>
+class Identity;  // forward declaration
+
+}  // namespace Sglty::Core
+
+namespace Sglty::Types {
+
+template <typename>
+class Matrix;  // forward declaration
+
+}  // namespace Sglty::Types
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+/**
+ * @brief Shape and core shared by the expression nodes that read no
+ * operand.
+ *
+ * Holds the runtime extents of runtime-sized cores; fixed extents come from
+ * the core, as for `Matrix`.
+ *
+ * @tparam _core_impl The core the expression evaluates into.
+ */
+template <typename _core_impl>
+struct Generated : Tag {
+  /**
+   * @brief The core implementation the expression evaluates into.
+   */
+  using core_impl = _core_impl;
+
+  static_assert(Traits::Core::is_valid_v<core_impl>,
+                "Error: `_core_impl` is not a valid core implementation.");
+  static_assert(!Traits::Core::is_view_v<core_impl> &&
+                    !Traits::Core::is_structured_v<core_impl>,
+                "Error: generated expressions evaluate into owning, "
+                "unstructured cores.");
+
+  /**
+   * @brief The type of the generated elements.
+   */
+  using value_type = typename core_impl::value_type;
+
+  /**
+   * @brief Number of rows in the expression.
+   */
+  constexpr static std::size_t rows = core_impl::size_traits::rows;
+
+  /**
+   * @brief Number of columns in the expression.
+   */
+  constexpr static std::size_t cols = core_impl::size_traits::cols;
+
+  /**
+   * @brief Constructs the shape of the expression.
+   *
+   * @param _rows The row count, ignored unless runtime-sized.
+   * @param _cols The column count, ignored unless runtime-sized.
+   */
+  constexpr Generated(std::size_t _rows, std::size_t _cols);
+
+  /**
+   * @brief Returns the number of rows of the expression.
+   */
+  constexpr std::size_t Rows() const;
+
+  /**
+   * @brief Returns the number of columns of the expression.
+   */
+  constexpr std::size_t Cols() const;
+
+ private:
+  std::size_t _m_rows;
+  std::size_t _m_cols;
+};
+
+}  // namespace Impl
+
+/**
+ * @brief Expression node whose elements all equal one value.
+ *
+ * Generates its elements as they are read instead of filling a matrix, and
+ * evaluates a SIMD packet at a time into cores with packet access. Usually
+ * built from `Sglty::Constant()`, which takes the shape and core of the
+ * other operand:
+ * ```
+ * Sglty::DenseMat<float, 4, 4> b = a + Sglty::Constant(1.0f);
+ * ```
+ *
+ * @tparam _core_impl The core the expression evaluates into; owning and not
+ * structured (see `Sglty::Traits::Core::is_structured_v`).
+ */
+template <typename _core_impl>
+struct Constant : Impl::Generated<_core_impl> {
+  using typename Impl::Generated<_core_impl>::value_type;
+
+  /**
+   * @brief Constructs a fixed-size constant expression.
+   *
+   * @param _v The value of every element.
+   */
+  constexpr explicit Constant(value_type _v);
+
+  /**
+   * @brief Constructs a constant expression of a given shape.
+   *
+   * @param _rows The row count, ignored unless runtime-sized.
+   * @param _cols The column count, ignored unless runtime-sized.
+   * @param _v The value of every element.
+   */
+  constexpr Constant(std::size_t _rows, std::size_t _cols, value_type _v);
+
+  /**
+   * @brief Returns the value of every element.
+   */
+  constexpr value_type Value() const;
+
+  /**
+   * @brief Evaluates the expression at a given coordinate.
+   *
+   * @param i The row index.
+   * @param j The column index.
+   * @return The value of the expression.
+   */
+  constexpr value_type operator()(std::size_t i, std::size_t j) const;
+
+  /**
+   * @brief Evaluates a SIMD packet of the expression at a given coordinate.
+   *
+   * @param i The row index of the first lane.
+   * @param j The column index of the first lane.
+   * @return The value broadcast to every lane.
+   */
+  auto Packet(std::size_t i, std::size_t j) const;
+
+ private:
+  value_type _m_value;
+};
+
+/**
+ * @brief Expression node whose elements are all zero.
+ *
+ * A `Constant` recognized by the rewrites of `+`, `-` and `*`: `a + z`,
+ * `z + a` and `a - z` are `a` itself, `z - a` is `-a`, and a product with
+ * `z` is a `Zero` of the product's shape, so none of them read `a` (see
+ * `Sglty::Op::Arthm::Add`). Usually built from `Sglty::Zero()`.
+ *
+ * @tparam _core_impl The core the expression evaluates into.
+ */
+template <typename _core_impl>
+struct Zero : Constant<_core_impl> {
+  /**
+   * @brief Constructs a fixed-size zero expression.
+   */
+  constexpr Zero();
+
+  /**
+   * @brief Constructs a zero expression of a given shape.
+   *
+   * @param _rows The row count, ignored unless runtime-sized.
+   * @param _cols The column count, ignored unless runtime-sized.
+   */
+  constexpr Zero(std::size_t _rows, std::size_t _cols);
+};
+
+/**
+ * @brief Expression node of ones on the diagonal and zeros elsewhere.
+ *
+ * Products with it are rewritten to the other operand when that already has
+ * the core of the product, as are products with the zero-storage
+ * `Matrix<Core::Identity>` returned by `Matrix::Identity()`. Usually built
+ * from `Sglty::Identity()`, e.g. `a + Sglty::Identity()` adds one to the
+ * diagonal of `a`.
+ *
+ * @tparam _core_impl The core the expression evaluates into; square.
+ */
+template <typename _core_impl>
+struct Identity : Impl::Generated<_core_impl> {
+  using typename Impl::Generated<_core_impl>::value_type;
+
+  static_assert(Traits::Size::is_compatible_v<_core_impl::size_traits::rows,
+                                              _core_impl::size_traits::cols>,
+                "Error: an Identity matrix must be a square matrix.");
+
+  /**
+   * @brief Constructs a fixed-size identity expression.
+   */
+  constexpr Identity();
+
+  /**
+   * @brief Constructs an identity expression of a given shape.
+   *
+   * @param _rows The row count, ignored unless runtime-sized.
+   * @param _cols The column count, ignored unless runtime-sized.
+   */
+  constexpr Identity(std::size_t _rows, std::size_t _cols);
+
+  /**
+   * @brief Evaluates the expression at a given coordinate.
+   *
+   * @param i The row index.
+   * @param j The column index.
+   * @return One if `i == j`, zero otherwise.
+   */
+  constexpr value_type operator()(std::size_t i, std::size_t j) const;
+};
+
+namespace Impl {
+
+// Cores of the nodes generated next to an operand of core `_core_impl`: the
+// core it evaluates into, dense for structured ones.
+template <typename _core_impl,
+          bool = Traits::Core::is_structured_v<_core_impl>>
+struct ShapedCore {
+  using type = Traits::Core::plain_t<_core_impl>;
+};
+
+template <typename _core_impl>
+struct ShapedCore<_core_impl, true> {
+  using type =
+      typename _core_impl::template core_rebind_major<Core::Major::Row>;
+};
+
+/**
+ * @brief Core of a node generated in the shape of `_expr`, with elements of
+ * `_Tp`.
+ */
+template <typename _expr, typename _Tp>
+using shaped_core_t = typename ShapedCore<typename _expr::core_impl>::type::
+    template core_rebind_value<_Tp>;
+
+template <typename _expr>
+struct IsUnshaped : std::is_base_of<Unshaped, _expr> {};
+
+template <typename _expr>
+struct IsZero : std::false_type {};
+
+template <typename _core_impl>
+struct IsZero<Zero<_core_impl>> : std::true_type {};
+
+template <typename _expr>
+struct IsIdentity : std::false_type {};
+
+template <typename _core_impl>
+struct IsIdentity<Identity<_core_impl>> : std::true_type {};
+
+template <typename _Tp, std::size_t _size>
+struct IsIdentity<Types::Matrix<Core::Identity<_Tp, _size>>>
+    : std::true_type {};
+
+/**
+ * @brief Whether `_lhs _op _rhs`, for `Expr::Add` or `Expr::Sub`, is `_lhs`
+ * itself: `_rhs` is an `Expr::Zero` of its shape, and `_lhs` already has
+ * the core of the result.
+ */
+template <typename _op, typename _lhs, typename _rhs, typename = void>
+struct IsZeroSum : std::false_type {};
+
+template <typename _op, typename _lhs, typename _rhs>
+struct IsZeroSum<_op,
+                 _lhs,
+                 _rhs,
+                 std::enable_if_t<IsZero<_rhs>::value &&
+                                  Traits::Expr::is_valid_v<_lhs>>>
+    : std::bool_constant<
+          _op::template is_valid_core_impl<_lhs, _rhs> &&
+          _op::template is_valid_dimension<_lhs, _rhs> &&
+          std::is_same_v<typename _op::template core_impl<_lhs, _rhs>,
+                         typename _lhs::core_impl>> {};
+
+}  // namespace Impl
+
+/**
+ * @brief Constant without a shape, see `Sglty::Constant()`.
+ *
+ * @tparam _Tp The type of the value.
+ */
+template <typename _Tp>
+struct UnshapedConstant : Unshaped {
+  /**
+   * @brief The constant in the shape and core of `_e`, with elements of
+   * `_Tp`.
+   *
+   * @param _e The other operand.
+   */
+  template <typename _expr>
+  constexpr auto Shape(const _expr& _e) const;
+
+  /// The value of every element.
+  _Tp _v;
+};
+
+/**
+ * @brief Zero without a shape, see `Sglty::Zero()`.
+ */
+struct UnshapedZero : Unshaped {
+  /**
+   * @brief The zero in the shape, core and element type of `_e`.
+   *
+   * @param _e The other operand.
+   */
+  template <typename _expr>
+  constexpr auto Shape(const _expr& _e) const;
+};
+
+/**
+ * @brief Identity without a shape, see `Sglty::Identity()`.
+ */
+struct UnshapedIdentity : Unshaped {
+  /**
+   * @brief The identity in the shape, core and element type of `_e`.
+   *
+   * @param _e The other operand.
+   */
+  template <typename _expr>
+  constexpr auto Shape(const _expr& _e) const;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty {
+
+/**
+ * @brief A matrix whose elements all equal `_v`, in the shape of the other
+ * operand.
+ *
+ * `a + Sglty::Constant(1.0f)` and `a - Sglty::Constant(1.0f)` read as an
+ * `Expr::Constant` of the shape and core of `a`, generated as it is read;
+ * elements of another type than those of `a` are promoted as for any other
+ * operand.
+ *
+ * @tparam _Tp The type of the value.
+ * @param _v The value of every element.
+ */
+template <typename _Tp>
+constexpr Expr::UnshapedConstant<_Tp> Constant(_Tp _v);
+
+/**
+ * @brief A zero matrix in the shape of the other operand.
+ *
+ * `a + Sglty::Zero()` and `a - Sglty::Zero()` are `a`, and `a * Sglty::Zero()`
+ * is an `Expr::Zero` of the shape of `a` (the zero is square in products).
+ */
+constexpr Expr::UnshapedZero Zero();
+
+/**
+ * @brief An identity matrix in the shape of the other operand.
+ *
+ * `a * Sglty::Identity()` is `a`, and `a + Sglty::Identity()` reads an
+ * `Expr::Identity` of the shape of `a`.
+ */
+constexpr Expr::UnshapedIdentity Identity();
+
+}  // namespace Sglty
+
+#include "Impl/Constant.tpp"
+
+// Singularity/Expr/Constant.hpp
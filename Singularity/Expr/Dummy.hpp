@@ -44,6 +44,26 @@ struct Dummy : Tag {
    * @return Dummy int value (reference to internal dummy state).
    */
   constexpr auto operator()(std::size_t i, std::size_t j) const;
+
+  /**
+   * @brief Runtime row count of the dummy expression (always zero).
+   */
+  constexpr std::size_t Rows() const;
+
+  /**
+   * @brief Runtime column count of the dummy expression (always zero).
+   */
+  constexpr std::size_t Cols() const;
+
+  /**
+   * @brief Converts the dummy expression to a dummy scalar.
+   *
+   * Lets operations that also accept scalar operands (e.g. `MulScalar`) be
+   * probed with `Dummy` by `Sglty::Traits::Op::is_valid_v`.
+   *
+   * @return Always 0.
+   */
+  constexpr operator int() const;
 };
 
 }  // namespace Sglty::Expr
@@ -17,6 +17,26 @@ enum class Type {
   Binary
 };
 
+/**
+ * @brief How evaluating an expression element by element walks memory.
+ *
+ * Ordered from cheapest to most expensive to traverse, so the access of an
+ * expression tree is the largest access of its nodes (see
+ * `Sglty::Traits::Expr::access_v`).
+ */
+enum class Access {
+  /// Every operand element is read once, at the position being written.
+  Contiguous,
+
+  /// Every operand element is read once, but across the storage order (e.g.
+  /// `Trp`), so consecutive results touch distant addresses.
+  Strided,
+
+  /// Operand elements are read again for other results (e.g. `MulMatrix`),
+  /// so the expression should be evaluated by a blocked kernel.
+  Reuse
+};
+
 }  // namespace Sglty::Expr
 
 // Singularity/Expr/Enums.hpp
@@ -1,5 +1,11 @@
 #pragma once
 
+namespace Sglty::Memory {
+
+class Workspace;
+
+}  // namespace Sglty::Memory
+
 namespace Sglty::Expr {
 
 /**
@@ -12,7 +18,8 @@ namespace Sglty::Expr {
  * the result using the associated `core_impl` of the expression.
  *
  * The returned type is always a concrete `Matrix<core_impl>`, with all values
- * computed according to the expression logic.
+ * computed according to the expression logic. A view evaluates into a copy
+ * owning its elements (see `Sglty::Traits::Core::plain_t`).
  *
  * @tparam _expr The expression type. Must satisfy
  * `Sglty::Traits::Expr::is_valid_v`.
@@ -22,6 +29,30 @@ namespace Sglty::Expr {
 template <typename _expr>
 constexpr auto Evaluate(const _expr& _e);
 
+/**
+ * @brief Evaluates a matrix expression with its scratch space drawn from
+ * `_workspace`.
+ *
+ * `_workspace` is installed on the calling thread for the duration of the
+ * call (see `Sglty::Memory::UseWorkspace`), so packing buffers and
+ * temporaries of the evaluation come from it. The result is the same as
+ * `Evaluate(_e)` and owns its elements; it is itself drawn from `_workspace`
+ * only if its core uses `Sglty::Memory::Allocator`.
+ *
+ * Example Usage:
+ * ```
+ * const auto y = Evaluate(a * b + c, ws);  // packing buffers from `ws`
+ * ```
+ *
+ * @tparam _expr The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v`.
+ * @param _e The expression to evaluate.
+ * @param _workspace The workspace to allocate from.
+ * @return A concrete `Matrix` representing the evaluated expression.
+ */
+template <typename _expr>
+auto Evaluate(const _expr& _e, Memory::Workspace& _workspace);
+
 }  // namespace Sglty::Expr
 
 #include "Impl/Evaluate.tpp"
@@ -0,0 +1,1167 @@
+#pragma once
+
+#include "../Assign.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../Binary.hpp"
+#include "../Broadcast.hpp"
+#include "../Enums.hpp"
+#include "../Materialized.hpp"
+#include "../Unary.hpp"
+#include "../../Config.hpp"
+#include "../../Core/Enums.hpp"
+#include "../../Exec/Executor.hpp"
+#include "../../Kernel/Copy.hpp"
+#include "../../Kernel/Gemm.hpp"
+#include "../../Kernel/Sparse.hpp"
+#include "../../Memory/Allocator.hpp"
+#include "../../Op/Alg/Cast.hpp"
+#include "../../Op/Alg/Trp.hpp"
+#include "../../Op/Arthm/Add.hpp"
+#include "../../Op/Arthm/Mul.hpp"
+#include "../../Op/Arthm/Sub.hpp"
+#include "../../Simd/Packet.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
+#include "../../Traits/Op.hpp"
+#include "../../Traits/Size.hpp"
+#include "../../Trace/Tracer.hpp"
+#include "../../Traits/Type.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+template <typename _expr, typename _enable = void>
+struct IsDirectAccess : std::false_type {};
+
+template <typename _expr>
+struct IsDirectAccess<_expr,
+                      std::enable_if_t<Traits::Expr::is_terminal_v<_expr>>>
+    : std::bool_constant<
+          _expr::core_type == Core::Type::Dense &&
+          (_expr::core_major == Core::Major::Row ||
+           _expr::core_major == Core::Major::Col) &&
+          Traits::Core::tile_v<typename _expr::core_impl> == 0 &&
+          Traits::Type::is_numeric_v<typename _expr::value_type>> {};
+
+template <typename _expr>
+struct IsDirectAccess<Materialized<_expr>>
+    : IsDirectAccess<typename Materialized<_expr>::matrix_type> {};
+
+template <typename _expr, typename _enable = void>
+struct IsSparseAccess : std::false_type {};
+
+template <typename _expr>
+struct IsSparseAccess<_expr,
+                      std::enable_if_t<Traits::Expr::is_terminal_v<_expr>>>
+    : std::bool_constant<
+          Traits::Core::is_sparse_v<typename _expr::core_impl> &&
+          std::is_arithmetic_v<typename _expr::value_type>> {};
+
+template <typename _expr>
+struct IsSparseAccess<Materialized<_expr>>
+    : IsSparseAccess<typename Materialized<_expr>::matrix_type> {};
+
+// Operands the product kernels read in place.
+template <typename _expr>
+struct IsKernelOperand
+    : std::disjunction<IsDirectAccess<_expr>, IsSparseAccess<_expr>> {};
+
+// The transpose of a dense matrix is read with its strides swapped.
+template <typename _operand>
+struct IsKernelOperand<Unary<_operand, Trp>>
+    : std::conjunction<
+          std::bool_constant<Traits::Expr::is_terminal_v<
+              typename Unary<_operand, Trp>::operand_type>>,
+          IsDirectAccess<typename Unary<_operand, Trp>::operand_type>> {};
+
+// Dense matrices cast to a non-storage type are converted while packed.
+template <typename _operand, typename _Up>
+struct IsKernelOperand<Unary<_operand, CastTo<_Up>>>
+    : std::conjunction<
+          std::bool_constant<
+              Traits::Expr::is_terminal_v<
+                  typename Unary<_operand, CastTo<_Up>>::operand_type> &&
+              std::is_same_v<Traits::Type::compute_t<_Up>, _Up>>,
+          IsDirectAccess<
+              typename Unary<_operand, CastTo<_Up>>::operand_type>> {};
+
+// Operands that are not directly accessible can still feed a kernel once
+// evaluated into a temporary of their own core.
+template <typename _expr>
+struct IsProductOperand
+    : std::disjunction<
+          IsKernelOperand<_expr>,
+          IsKernelOperand<Types::Matrix<typename _expr::core_impl>>> {};
+
+template <typename _dst, typename _expr>
+struct IsProductAssignable : std::false_type {};
+
+// Dense and mixed products write a dense `_dst`, sparse x sparse products
+// write compressed buffers and need `_dst` to be of the result core.
+template <typename _dst, typename _lhs, typename _rhs>
+struct IsProductAssignable<_dst, Binary<_lhs, _rhs, MulMatrix>> {
+ private:
+  using expr_type = Binary<_lhs, _rhs, MulMatrix>;
+  using lhs_type  = typename expr_type::lhs_type;
+  using rhs_type  = typename expr_type::rhs_type;
+
+  static constexpr bool sparse =
+      Traits::Core::is_sparse_v<typename lhs_type::core_impl> &&
+      Traits::Core::is_sparse_v<typename rhs_type::core_impl>;
+
+ public:
+  static constexpr bool value =
+      IsProductOperand<lhs_type>::value && IsProductOperand<rhs_type>::value &&
+      (sparse ? std::is_same_v<typename _dst::core_impl,
+                               typename expr_type::core_impl> &&
+                    IsSparseAccess<_dst>::value
+              : IsDirectAccess<_dst>::value);
+};
+
+// `c + a * b` written as `c` followed by the product accumulated into `_dst`.
+template <typename _dst, typename _expr>
+struct IsAccumulateAssignable : std::false_type {};
+
+template <typename _dst, typename _lhs, typename _rhs>
+struct IsAccumulateAssignable<_dst, Binary<_lhs, _rhs, GemmAccumulate>> {
+ private:
+  using term_type =
+      Op::Arthm::Impl::ProductTerm<typename Binary<_lhs,
+                                                   _rhs,
+                                                   GemmAccumulate>::rhs_type>;
+
+ public:
+  static constexpr bool value =
+      IsProductAssignable<_dst, typename term_type::product_type>::value &&
+      IsDirectAccess<_dst>::value &&
+      std::is_same_v<typename _dst::value_type,
+                     typename term_type::product_type::core_impl::value_type>;
+};
+
+// `beta * _dst` as the addend of a `GemmAccumulate`, without reading it.
+template <typename _dst, typename _expr>
+struct IsScaledDst : std::false_type {};
+
+template <typename _dst, typename _scalar>
+struct IsScaledDst<_dst, Binary<const _dst&, _scalar, MulScalar>>
+    : std::bool_constant<MulScalar::vectorizable<_dst, _scalar>> {};
+
+// Element-wise operations evaluated over stored entries only.
+template <typename _op>
+struct MergeFn;
+
+template <>
+struct MergeFn<Add> {
+  template <typename _lhs, typename _rhs>
+  constexpr auto operator()(const _lhs& l, const _rhs& r) const {
+    return l + r;
+  }
+};
+
+template <>
+struct MergeFn<Sub> {
+  template <typename _lhs, typename _rhs>
+  constexpr auto operator()(const _lhs& l, const _rhs& r) const {
+    return l - r;
+  }
+};
+
+template <typename _dst, typename _expr>
+struct IsMergeAssignable : std::false_type {};
+
+template <typename _dst, typename _lhs, typename _rhs, typename _op>
+struct IsMergeAssignable<_dst, Binary<_lhs, _rhs, _op>>
+    : std::bool_constant<
+          std::is_same_v<typename _dst::core_impl,
+                         typename Binary<_lhs, _rhs, _op>::core_impl> &&
+          IsSparseAccess<_dst>::value &&
+          (std::is_same_v<_op, Add> || std::is_same_v<_op, Sub>)> {};
+
+// Views are written like the owning core their expressions evaluate into,
+// and temporaries like the core they were rebound from.
+template <typename _dst, typename _expr>
+struct IsPacketAssignable
+    : std::bool_constant<
+          (std::is_same_v<Traits::Core::plain_t<typename _dst::core_impl>,
+                          typename _expr::core_impl> ||
+           std::is_same_v<typename _dst::core_impl,
+                          Memory::scratch_t<typename _expr::core_impl>>) &&
+          Traits::Core::has_packet_access_v<typename _dst::core_impl> &&
+          Traits::Expr::is_vectorizable_v<_expr>> {};
+
+// Dense copies that would read or write with a stride in plain loops: a
+// source of the other major, or the transpose of one of the same major.
+template <typename _dst, typename _src>
+struct IsDirectCopy
+    : std::conjunction<
+          std::bool_constant<Traits::Expr::is_terminal_v<_src>>,
+          IsDirectAccess<_dst>,
+          IsDirectAccess<_src>,
+          std::is_same<typename _dst::core_impl::value_type,
+                       typename _src::core_impl::value_type>> {};
+
+template <typename _dst, typename _src>
+struct IsOtherMajor
+    : std::bool_constant<_dst::core_major != _src::core_major> {};
+
+template <typename _dst, typename _expr>
+struct IsCopyAssignable : std::conjunction<IsDirectCopy<_dst, _expr>,
+                                           IsOtherMajor<_dst, _expr>> {};
+
+template <typename _dst, typename _operand>
+struct IsCopyAssignable<_dst, Unary<_operand, Trp>>
+    : IsDirectCopy<_dst, typename Unary<_operand, Trp>::operand_type> {};
+
+// `a = Trp(a)`, which can be evaluated by `Matrix::TransposeInPlace()` unless
+// the transpose has another structure.
+template <typename _dst, typename _expr>
+struct IsSelfTranspose : std::false_type {};
+
+template <typename _dst>
+struct IsSelfTranspose<_dst, Unary<const _dst&, Trp>>
+    : std::is_same<Traits::Core::transpose_t<typename _dst::core_impl>,
+                   typename _dst::core_impl> {};
+
+// The matrix behind a directly accessible operand.
+template <typename _expr>
+constexpr const auto& Storage(const _expr& e) {
+  if constexpr (Traits::Expr::is_terminal_v<_expr>) {
+    return e;
+  } else {
+    return e._m;
+  }
+}
+
+template <typename _operand>
+constexpr const auto& Storage(const Unary<_operand, Trp>& e) {
+  return e._o;
+}
+
+template <typename _operand, typename _Up>
+constexpr const auto& Storage(const Unary<_operand, CastTo<_Up>>& e) {
+  return e._o;
+}
+
+template <typename _matrix>
+constexpr std::size_t RowStride(const _matrix& m) {
+  return _matrix::core_major == Core::Major::Row ? m.OuterStride() : 1;
+}
+
+template <typename _matrix>
+constexpr std::size_t ColStride(const _matrix& m) {
+  return _matrix::core_major == Core::Major::Row ? 1 : m.OuterStride();
+}
+
+template <typename _expr>
+constexpr std::size_t RowStride(const Materialized<_expr>& m) {
+  return RowStride(m._m);
+}
+
+template <typename _expr>
+constexpr std::size_t ColStride(const Materialized<_expr>& m) {
+  return ColStride(m._m);
+}
+
+// `Trp(a)(i, j)` is `a(j, i)`: the strides of `a` swap roles.
+template <typename _operand>
+constexpr std::size_t RowStride(const Unary<_operand, Trp>& e) {
+  return ColStride(e._o);
+}
+
+template <typename _operand>
+constexpr std::size_t ColStride(const Unary<_operand, Trp>& e) {
+  return RowStride(e._o);
+}
+
+template <typename _operand, typename _Up>
+constexpr std::size_t RowStride(const Unary<_operand, CastTo<_Up>>& e) {
+  return RowStride(e._o);
+}
+
+template <typename _operand, typename _Up>
+constexpr std::size_t ColStride(const Unary<_operand, CastTo<_Up>>& e) {
+  return ColStride(e._o);
+}
+
+// Rows of a CSR, columns of a CSC matrix.
+template <typename _matrix>
+constexpr std::size_t OuterSize(const _matrix& m) {
+  return _matrix::core_major == Core::Major::Row ? m.Rows() : m.Cols();
+}
+
+// Scalar operations of an `m x k` by `k x n` product.
+constexpr std::uint64_t ProductFlops(std::size_t m,
+                                     std::size_t n,
+                                     std::size_t k) {
+  return 2 * std::uint64_t(m) * std::uint64_t(n) * std::uint64_t(k);
+}
+
+template <typename _dst, typename _lhs, typename _rhs>
+void AssignProduct(_dst& dst, const _lhs& l, const _rhs& r) {
+  if constexpr (!IsKernelOperand<_lhs>::value) {
+    // O(n^2) to evaluate lazily fused operands vs O(n^3) strided reads.
+    const Materialized<_lhs> temp(l);
+    AssignProduct(dst, temp, r);
+  } else if constexpr (!IsKernelOperand<_rhs>::value) {
+    const Materialized<_rhs> temp(r);
+    AssignProduct(dst, l, temp);
+  } else {
+    const auto& a = Storage(l);
+    const auto& b = Storage(r);
+
+    Trace::Span span = Trace::Begin(Trace::Kind::Product, 0, 0);
+
+    using a_type = std::decay_t<decltype(a)>;
+    using b_type = std::decay_t<decltype(b)>;
+
+    constexpr bool a_sparse = IsSparseAccess<a_type>::value;
+    constexpr bool b_sparse = IsSparseAccess<b_type>::value;
+
+    // Element type the product is computed in (see `Traits::Type::Promote`).
+    using compute_type =
+        Traits::Type::promote_t<typename _lhs::core_impl::value_type,
+                                typename _rhs::core_impl::value_type>;
+
+    if constexpr (a_sparse && b_sparse) {
+      // Every stored entry of `a` meets a row of `b` of average density.
+      span.flops = ProductFlops(1, b.NonZeros(), a.NonZeros()) /
+                   std::max<std::size_t>(OuterSize(b), 1);
+      // Both operands share the compressed axis (same `core_base`); CSC is
+      // handled as C^T = B^T * A^T.
+      if constexpr (a_type::core_major == Core::Major::Row) {
+        Kernel::SparseSparse(a.Rows(),
+                             b.Cols(),
+                             a.OuterIndex(),
+                             a.InnerIndex(),
+                             a.Data(),
+                             b.OuterIndex(),
+                             b.InnerIndex(),
+                             b.Data(),
+                             dst.OuterIndex(),
+                             dst.InnerIndex(),
+                             dst.Data(),
+                             _dst::core_impl::capacity);
+      } else {
+        Kernel::SparseSparse(b.Cols(),
+                             a.Rows(),
+                             b.OuterIndex(),
+                             b.InnerIndex(),
+                             b.Data(),
+                             a.OuterIndex(),
+                             a.InnerIndex(),
+                             a.Data(),
+                             dst.OuterIndex(),
+                             dst.InnerIndex(),
+                             dst.Data(),
+                             _dst::core_impl::capacity);
+      }
+    } else if constexpr (a_sparse) {
+      span.flops = ProductFlops(1, r.Cols(), a.NonZeros());
+      Kernel::SparseDense(l.Rows(),
+                          r.Cols(),
+                          OuterSize(a),
+                          a_type::core_major == Core::Major::Row,
+                          a.OuterIndex(),
+                          a.InnerIndex(),
+                          a.Data(),
+                          b.Data(),
+                          RowStride(r),
+                          ColStride(r),
+                          dst.Data(),
+                          RowStride(dst),
+                          ColStride(dst));
+    } else if constexpr (b_sparse) {
+      span.flops = ProductFlops(l.Rows(), 1, b.NonZeros());
+      Kernel::DenseSparse(l.Rows(),
+                          r.Cols(),
+                          a.Data(),
+                          RowStride(l),
+                          ColStride(l),
+                          OuterSize(b),
+                          b_type::core_major == Core::Major::Row,
+                          b.OuterIndex(),
+                          b.InnerIndex(),
+                          b.Data(),
+                          dst.Data(),
+                          RowStride(dst),
+                          ColStride(dst));
+    } else {
+      span.flops = ProductFlops(l.Rows(), r.Cols(), l.Cols());
+      Kernel::GemmAccumulate(l.Rows(),
+                             r.Cols(),
+                             l.Cols(),
+                             compute_type{1},
+                             a.Data(),
+                             RowStride(l),
+                             ColStride(l),
+                             b.Data(),
+                             RowStride(r),
+                             ColStride(r),
+                             compute_type{},
+                             dst.Data(),
+                             RowStride(dst),
+                             ColStride(dst));
+    }
+
+    span.bytes = Trace::Bytes(dst);
+    Trace::End(span);
+  }
+}
+
+// `dst = alpha * l * r + beta * dst`, with non-kernel operands evaluated
+// into temporaries as in `AssignProduct`.
+template <typename _dst, typename _lhs, typename _rhs, typename _Tp>
+void AssignGemm(_dst& dst, const _lhs& l, const _rhs& r, _Tp alpha, _Tp beta) {
+  if constexpr (!IsKernelOperand<_lhs>::value) {
+    const Materialized<_lhs> temp(l);
+    AssignGemm(dst, temp, r, alpha, beta);
+  } else if constexpr (!IsKernelOperand<_rhs>::value) {
+    const Materialized<_rhs> temp(r);
+    AssignGemm(dst, l, temp, alpha, beta);
+  } else {
+    const Trace::Span span =
+        Trace::Begin(Trace::Kind::Product,
+                     Trace::Bytes(dst),
+                     ProductFlops(l.Rows(), r.Cols(), l.Cols()));
+
+    Kernel::GemmAccumulate(l.Rows(),
+                           r.Cols(),
+                           l.Cols(),
+                           alpha,
+                           Storage(l).Data(),
+                           RowStride(l),
+                           ColStride(l),
+                           Storage(r).Data(),
+                           RowStride(r),
+                           ColStride(r),
+                           beta,
+                           dst.Data(),
+                           RowStride(dst),
+                           ColStride(dst));
+    Trace::End(span);
+  }
+}
+
+// Writes the addend `l` into `dst` unless it is `dst` itself or a multiple
+// of it, then accumulates the product term `r`.
+template <typename _dst, typename _lhs, typename _rhs>
+void AssignAccumulate(_dst& dst, const _lhs& l, const _rhs& r) {
+  using value_type = typename _dst::value_type;
+  using term_type  = Op::Arthm::Impl::ProductTerm<_rhs>;
+
+  const auto& p     = term_type::Product(r);
+  const auto  alpha = term_type::template Factor<value_type>(r);
+
+  if constexpr (std::is_same_v<_lhs, _dst>) {
+    if (&l == &dst) {
+      AssignGemm(dst, p._l, p._r, alpha, value_type{1});
+      return;
+    }
+  } else if constexpr (IsScaledDst<_dst, _lhs>::value) {
+    if (&l._l == &dst) {
+      AssignGemm(dst, p._l, p._r, alpha, static_cast<value_type>(l._r));
+      return;
+    }
+  }
+  AssignNoAlias(dst, l);
+  AssignGemm(dst, p._l, p._r, alpha, value_type{1});
+}
+
+template <typename _dst, typename _lhs, typename _rhs, typename _op>
+void AssignMerge(_dst& dst, const _lhs& l, const _rhs& r, _op fn) {
+  if constexpr (!IsSparseAccess<_lhs>::value) {
+    const Materialized<_lhs> temp(l);
+    AssignMerge(dst, temp, r, fn);
+  } else if constexpr (!IsSparseAccess<_rhs>::value) {
+    const Materialized<_rhs> temp(r);
+    AssignMerge(dst, l, temp, fn);
+  } else {
+    const auto& a = Storage(l);
+    const auto& b = Storage(r);
+
+    Trace::Span span = Trace::Begin(
+        Trace::Kind::Merge, 0, std::uint64_t(a.NonZeros() + b.NonZeros()));
+
+    Kernel::SparseMerge(OuterSize(dst),
+                        a.OuterIndex(),
+                        a.InnerIndex(),
+                        a.Data(),
+                        b.OuterIndex(),
+                        b.InnerIndex(),
+                        b.Data(),
+                        dst.OuterIndex(),
+                        dst.InnerIndex(),
+                        dst.Data(),
+                        _dst::core_impl::capacity,
+                        fn);
+
+    span.bytes = Trace::Bytes(dst);
+    Trace::End(span);
+  }
+}
+
+// Whether an element-wise evaluation may be large enough to be split into
+// panels; fixed-size ones below `SGLTY_PARALLEL_THRESHOLD` never are. Panels
+// cover every element, so only dense destinations qualify.
+template <typename _dst, typename _expr>
+struct IsParallelAssignable
+    : std::bool_constant<
+          SGLTY_PARALLEL_THRESHOLD != 0 &&
+          _dst::core_type == Core::Type::Dense &&
+          (Traits::Core::is_dynamic_v<typename _dst::core_impl> ||
+           Traits::Expr::is_dynamic_v<_expr> ||
+           Traits::Size::SaturatedMul(
+               _expr::rows * _expr::cols,
+               Traits::Size::SaturatedAdd(
+                   Traits::Expr::element_cost_v<_expr>, 1)) >=
+               std::size_t{SGLTY_PARALLEL_THRESHOLD})> {};
+
+// Calls `fn(i0, j0, rows, cols)` for panels of whole rows (row-major) or
+// columns (column-major) of `dst`, through `Exec::ParallelFor` when the
+// evaluation of `_expr` is large enough.
+template <typename _expr, typename _dst, typename _fn>
+void ForEachPanel(const _dst& dst, const _fn& fn) {
+  constexpr bool row = _dst::core_major == Core::Major::Row;
+
+  if constexpr (!IsParallelAssignable<_dst, _expr>::value) {
+    fn(0, 0, dst.Rows(), dst.Cols());
+  } else {
+    const std::size_t outer = row ? dst.Rows() : dst.Cols();
+    const std::size_t inner = row ? dst.Cols() : dst.Rows();
+    const std::size_t cost =
+        Traits::Size::SaturatedAdd(Traits::Expr::element_cost_v<_expr>, 1);
+    const std::size_t work =
+        Traits::Size::SaturatedMul(outer * inner, cost);
+    const std::size_t panel =
+        Exec::PanelSize(outer, Traits::Size::SaturatedMul(inner, cost));
+    const std::size_t tasks = panel == 0 ? 0 : (outer + panel - 1) / panel;
+
+    if (!Exec::IsParallel(work, tasks)) {
+      fn(0, 0, dst.Rows(), dst.Cols());
+      return;
+    }
+    Exec::ParallelFor(work, tasks, [&](std::size_t t) {
+      const std::size_t begin = t * panel;
+      const std::size_t count = std::min(panel, outer - begin);
+      if constexpr (row) {
+        fn(begin, 0, count, inner);
+      } else {
+        fn(0, begin, inner, count);
+      }
+    });
+  }
+}
+
+// Copies a terminal or `Trp` of one in panels of `dst`.
+template <typename _dst, typename _expr>
+void AssignCopy(_dst& dst, const _expr& e) {
+  const auto&       a    = Storage(e);
+  const std::size_t a_rs = RowStride(e);
+  const std::size_t a_cs = ColStride(e);
+
+  const Trace::Span span =
+      Trace::Begin(Trace::Kind::Copy, Trace::Bytes(dst), 0);
+
+  ForEachPanel<_expr>(
+      dst,
+      [&](std::size_t i0, std::size_t j0, std::size_t rows, std::size_t cols) {
+        Kernel::Copy(rows,
+                     cols,
+                     a.Data() + i0 * a_rs + j0 * a_cs,
+                     a_rs,
+                     a_cs,
+                     dst.Data() + i0 * RowStride(dst) + j0 * ColStride(dst),
+                     RowStride(dst),
+                     ColStride(dst));
+      });
+
+  Trace::End(span);
+}
+
+template <typename _matrix, typename _enable = void>
+struct HasAdvise : std::false_type {};
+
+template <typename _matrix>
+struct HasAdvise<
+    _matrix,
+    std::void_t<decltype(std::declval<const typename _matrix::core_impl&>()
+                             .Advise(std::size_t{},
+                                     std::size_t{},
+                                     std::size_t{},
+                                     std::size_t{},
+                                     Core::Advice{}))>> : std::true_type {};
+
+// Passes `advice` for the region to every matrix `e` reads element-wise.
+template <typename _expr>
+void Advise(const _expr&,
+            std::size_t,
+            std::size_t,
+            std::size_t,
+            std::size_t,
+            Core::Advice) {}
+
+template <typename _lhs, typename _rhs, typename _op>
+void Advise(const Binary<_lhs, _rhs, _op>& e,
+            std::size_t i0,
+            std::size_t j0,
+            std::size_t rows,
+            std::size_t cols,
+            Core::Advice advice);
+
+template <typename _operand, typename _op>
+void Advise(const Unary<_operand, _op>& e,
+            std::size_t i0,
+            std::size_t j0,
+            std::size_t rows,
+            std::size_t cols,
+            Core::Advice advice);
+
+template <typename _core_impl>
+void Advise(const Types::Matrix<_core_impl>& m,
+            std::size_t i0,
+            std::size_t j0,
+            std::size_t rows,
+            std::size_t cols,
+            Core::Advice advice) {
+  if constexpr (HasAdvise<Types::Matrix<_core_impl>>::value) {
+    m.Advise(i0, j0, rows, cols, advice);
+  }
+}
+
+template <typename _lhs, typename _rhs, typename _op>
+void Advise(const Binary<_lhs, _rhs, _op>& e,
+            std::size_t i0,
+            std::size_t j0,
+            std::size_t rows,
+            std::size_t cols,
+            Core::Advice advice) {
+  using expr_type = Binary<_lhs, _rhs, _op>;
+
+  if constexpr (Traits::Op::is_elementwise_v<_op,
+                                             typename expr_type::lhs_type,
+                                             typename expr_type::rhs_type>) {
+    Advise(e._l, i0, j0, rows, cols, advice);
+    Advise(e._r, i0, j0, rows, cols, advice);
+  }
+}
+
+template <typename _operand, typename _op>
+void Advise(const Unary<_operand, _op>& e,
+            std::size_t i0,
+            std::size_t j0,
+            std::size_t rows,
+            std::size_t cols,
+            Core::Advice advice) {
+  using expr_type = Unary<_operand, _op>;
+
+  if constexpr (Traits::Op::is_elementwise_v<
+                    _op, typename expr_type::operand_type>) {
+    Advise(e._o, i0, j0, rows, cols, advice);
+  }
+}
+
+// Destinations stored in tiles (see `Traits::Core::tile_v`).
+template <typename _dst, typename _expr>
+struct IsTiledAssignable
+    : std::bool_constant<
+          Traits::Core::tile_v<typename _dst::core_impl> != 0 &&
+          !Traits::Core::is_sparse_v<typename _dst::core_impl>> {};
+
+// Evaluates `e` into `dst` tile by tile, in strips of one row (row-major) or
+// column (column-major) of tiles. The next strip of the operands is
+// prefetched before a strip is evaluated, and the strip is marked cold once
+// written, so only a few strips need to be resident at a time.
+template <typename _dst, typename _expr>
+void AssignTiled(_dst& dst, const _expr& e) {
+  using dst_core   = typename _dst::core_impl;
+  using value_type = typename dst_core::value_type;
+
+  // `Tiled` cores order their tiles row-major.
+  constexpr bool row         = _dst::core_major != Core::Major::Col;
+  constexpr Core::Major axis = row ? Core::Major::Row : Core::Major::Col;
+  constexpr std::size_t tile = Traits::Core::tile_v<dst_core>;
+
+  const std::size_t outer  = row ? dst.Rows() : dst.Cols();
+  const std::size_t inner  = row ? dst.Cols() : dst.Rows();
+  const std::size_t strips = outer / tile + (outer % tile != 0);
+
+  // Calls `fn(i0, j0, rows, cols)` with the region of strip `s`.
+  const auto region = [&](std::size_t s, auto&& fn) {
+    const std::size_t o = s * tile;
+    const std::size_t m = outer - o < tile ? outer - o : tile;
+    if constexpr (row) {
+      fn(o, 0, m, inner);
+    } else {
+      fn(0, o, inner, m);
+    }
+  };
+
+  const auto strip = [&](std::size_t s) {
+    if (s + 1 < strips) {
+      region(s + 1, [&](auto i0, auto j0, auto rows, auto cols) {
+        Advise(e, i0, j0, rows, cols, Core::Advice::WillNeed);
+      });
+    }
+    region(s, [&](auto i0, auto j0, auto rows, auto cols) {
+      for (std::size_t n = 0; n < inner; n += tile) {
+        const std::size_t k  = inner - n < tile ? inner - n : tile;
+        const std::size_t ti = row ? i0 : i0 + n;
+        const std::size_t tj = row ? j0 + n : j0;
+        const std::size_t tr = row ? rows : k;
+        const std::size_t tc = row ? k : cols;
+
+        const auto scalar = [&](std::size_t i, std::size_t j) {
+          dst(ti + i, tj + j) = e(ti + i, tj + j);
+        };
+        if constexpr (IsPacketAssignable<_dst, _expr>::value) {
+          Types::Impl::TraversePacket<axis>(
+              tr,
+              tc,
+              Simd::Packet<value_type>::size,
+              [&](std::size_t i, std::size_t j) {
+                dst.StorePacket(ti + i, tj + j, e.Packet(ti + i, tj + j));
+              },
+              scalar);
+        } else {
+          Types::Impl::Traverse<axis>(tr, tc, scalar);
+        }
+      }
+      Advise(e, i0, j0, rows, cols, Core::Advice::Cold);
+      Advise(dst, i0, j0, rows, cols, Core::Advice::Cold);
+    });
+  };
+
+  const std::size_t cost =
+      Traits::Size::SaturatedAdd(Traits::Expr::element_cost_v<_expr>, 1);
+  const std::size_t work =
+      Traits::Size::SaturatedMul(outer * inner, cost);
+  const std::size_t panel = Exec::PanelSize(
+      strips, Traits::Size::SaturatedMul(tile * inner, cost));
+  const std::size_t tasks = panel == 0 ? 0 : (strips + panel - 1) / panel;
+
+  Exec::ParallelFor(work, tasks, [&](std::size_t t) {
+    const std::size_t end = (t + 1) * panel < strips ? (t + 1) * panel : strips;
+    for (std::size_t s = t * panel; s < end; s++) {
+      strip(s);
+    }
+  });
+}
+
+// `Trp` of a dense matrix read across `_major`, the storage order of the
+// destination.
+template <Core::Major _major, typename _expr, typename _enable = void>
+struct IsStridedOperand : std::false_type {};
+
+template <Core::Major _major, typename _operand>
+struct IsStridedOperand<
+    _major,
+    Unary<_operand, Trp>,
+    std::enable_if_t<Traits::Expr::is_terminal_v<
+        typename Unary<_operand, Trp>::operand_type>>> {
+ private:
+  using operand_type = typename Unary<_operand, Trp>::operand_type;
+
+ public:
+  static constexpr bool value = IsDirectAccess<operand_type>::value &&
+                                operand_type::core_major == _major;
+};
+
+// Rebuilds an element-wise expression with its strided operands read from
+// `temporaries`, which evaluates them once through the tiled `Trp` copy;
+// `value` tells whether there is any. Other sub-expressions are held by
+// reference and scalars by value.
+template <Core::Major _major, typename _expr, typename _enable = void>
+struct Destrided {
+  static constexpr bool value = false;
+
+  struct temporaries {
+    constexpr temporaries(const _expr&) {}
+  };
+
+  using type = std::
+      conditional_t<Traits::Expr::is_valid_v<_expr>, const _expr&, _expr>;
+
+  static type Apply(const _expr& e, const temporaries&) { return e; }
+};
+
+template <Core::Major _major, typename _operand>
+struct Destrided<
+    _major,
+    Unary<_operand, Trp>,
+    std::enable_if_t<IsStridedOperand<_major, Unary<_operand, Trp>>::value>> {
+  static constexpr bool value = true;
+
+  using temporaries = Materialized<Unary<_operand, Trp>>;
+
+  using type = const temporaries&;
+
+  static type Apply(const Unary<_operand, Trp>&, const temporaries& t) {
+    return t;
+  }
+};
+
+template <Core::Major _major, typename _lhs, typename _rhs, typename _op>
+struct Destrided<
+    _major,
+    Binary<_lhs, _rhs, _op>,
+    std::enable_if_t<Traits::Op::is_elementwise_v<
+        _op,
+        typename Binary<_lhs, _rhs, _op>::lhs_type,
+        typename Binary<_lhs, _rhs, _op>::rhs_type>>> {
+ private:
+  using expr_type = Binary<_lhs, _rhs, _op>;
+  using lhs       = Destrided<_major, typename expr_type::lhs_type>;
+  using rhs       = Destrided<_major, typename expr_type::rhs_type>;
+
+ public:
+  static constexpr bool value = lhs::value || rhs::value;
+
+  struct temporaries {
+    temporaries(const expr_type& e) : l(e._l), r(e._r) {}
+
+    const typename lhs::temporaries l;
+    const typename rhs::temporaries r;
+  };
+
+  using type = std::conditional_t<
+      value,
+      Binary<typename lhs::type, typename rhs::type, _op>,
+      const expr_type&>;
+
+  static type Apply(const expr_type& e, const temporaries& t) {
+    if constexpr (value) {
+      return type(lhs::Apply(e._l, t.l), rhs::Apply(e._r, t.r));
+    } else {
+      return e;
+    }
+  }
+};
+
+// Strided element-wise evaluations that may be large enough for the
+// transposes to be copied first; fixed-size ones below
+// `SGLTY_STRIDED_THRESHOLD` elements never are.
+template <typename _dst, typename _expr>
+struct IsStridedAssignable
+    : std::bool_constant<
+          SGLTY_STRIDED_THRESHOLD != 0 &&
+          Traits::Expr::access_v<_expr> == Access::Strided &&
+          IsDirectAccess<_dst>::value &&
+          Destrided<_dst::core_major, _expr>::value &&
+          (Traits::Core::is_dynamic_v<typename _dst::core_impl> ||
+           Traits::Expr::is_dynamic_v<_expr> ||
+           _expr::rows * _expr::cols >=
+               std::size_t{SGLTY_STRIDED_THRESHOLD})> {};
+
+// Whether `m` shares any element storage with `dst`. Element-wise reads
+// (`in_place`) of the exact same layout are safe for dense destinations.
+template <typename _dst, typename _matrix>
+constexpr bool Overlaps(const _dst& dst, const _matrix& m, bool in_place) {
+  using dst_core = typename _dst::core_impl;
+  using m_core   = typename _matrix::core_impl;
+
+  constexpr bool dense = !Traits::Core::is_sparse_v<dst_core> &&
+                         !Traits::Core::is_sparse_v<m_core>;
+
+  if (static_cast<const void*>(&dst) == static_cast<const void*>(&m)) {
+    return !(in_place && dense);
+  }
+  if constexpr (!Traits::Core::is_view_v<dst_core> &&
+                !Traits::Core::is_view_v<m_core>) {
+    return false;  // distinct owning matrices never share storage
+  } else if constexpr (!dense || Traits::Core::is_structured_v<dst_core> ||
+                       Traits::Core::is_structured_v<m_core>) {
+    return false;  // views only refer to dense storage
+  } else {
+    if (Config::IsConstantEvaluated()) {
+      return true;  // unrelated addresses cannot be ordered here
+    }
+    if (in_place && dst.Data() == m.Data() &&
+        dst.OuterStride() == m.OuterStride() &&
+        _dst::core_major == _matrix::core_major) {
+      return false;
+    }
+    const auto extent = [](const auto& x) -> std::size_t {
+      using x_type        = std::decay_t<decltype(x)>;
+      const bool row      = x_type::core_major == Core::Major::Row;
+      const std::size_t n = row ? x.Rows() : x.Cols();  // outer extent
+      const std::size_t k = row ? x.Cols() : x.Rows();  // inner extent
+      return n == 0 || k == 0 ? 0 : (n - 1) * x.OuterStride() + k;
+    };
+    const auto dst_begin = reinterpret_cast<std::uintptr_t>(dst.Data());
+    const auto m_begin   = reinterpret_cast<std::uintptr_t>(m.Data());
+    const auto dst_end   = dst_begin + extent(dst) * sizeof(*dst.Data());
+    const auto m_end     = m_begin + extent(m) * sizeof(*m.Data());
+    return dst_begin < m_end && m_begin < dst_end;
+  }
+}
+
+// Scalars and materialized sub-expressions are evaluated before `_dst`.
+template <typename _dst, typename _expr>
+constexpr bool Aliases(const _dst&, const _expr&, bool) {
+  return false;
+}
+
+template <typename _dst, typename _lhs, typename _rhs, typename _op>
+constexpr bool Aliases(const _dst& dst,
+                       const Binary<_lhs, _rhs, _op>& e,
+                       bool in_place);
+
+template <typename _dst, typename _operand, typename _op>
+constexpr bool Aliases(const _dst& dst,
+                       const Unary<_operand, _op>& e,
+                       bool in_place);
+
+template <typename _dst, typename _operand, typename _core_impl>
+constexpr bool Aliases(const _dst& dst,
+                       const Broadcast<_operand, _core_impl>& e,
+                       bool in_place);
+
+template <typename _dst, typename _core_impl>
+constexpr bool Aliases(const _dst& dst,
+                       const Types::Matrix<_core_impl>& m,
+                       bool in_place) {
+  if constexpr (Traits::Expr::may_alias_v<Types::Matrix<_core_impl>, _dst>) {
+    return Overlaps(dst, m, in_place);
+  } else {
+    return false;
+  }
+}
+
+template <typename _dst, typename _lhs, typename _rhs, typename _op>
+constexpr bool Aliases(const _dst& dst,
+                       const Binary<_lhs, _rhs, _op>& e,
+                       bool in_place) {
+  using expr_type = Binary<_lhs, _rhs, _op>;
+
+  if constexpr (Traits::Expr::may_alias_v<expr_type, _dst>) {
+    const bool elementwise =
+        in_place && Traits::Op::is_elementwise_v<_op,
+                                                 typename expr_type::lhs_type,
+                                                 typename expr_type::rhs_type>;
+    return Aliases(dst, e._l, elementwise) || Aliases(dst, e._r, elementwise);
+  } else {
+    return false;
+  }
+}
+
+template <typename _dst, typename _operand, typename _op>
+constexpr bool Aliases(const _dst& dst,
+                       const Unary<_operand, _op>& e,
+                       bool in_place) {
+  using expr_type = Unary<_operand, _op>;
+
+  if constexpr (Traits::Expr::may_alias_v<expr_type, _dst>) {
+    const bool elementwise =
+        in_place && Traits::Op::is_elementwise_v<
+                        _op, typename expr_type::operand_type>;
+    return Aliases(dst, e._o, elementwise);
+  } else {
+    return false;
+  }
+}
+
+// Operand elements are read for other positions than their own.
+template <typename _dst, typename _operand, typename _core_impl>
+constexpr bool Aliases(const _dst& dst,
+                       const Broadcast<_operand, _core_impl>& e,
+                       bool) {
+  using expr_type = Broadcast<_operand, _core_impl>;
+
+  if constexpr (Traits::Expr::may_alias_v<expr_type, _dst>) {
+    return Aliases(dst, e._o, false);
+  } else {
+    return false;
+  }
+}
+
+}  // namespace Impl
+
+template <typename _core_impl, typename _expr>
+constexpr bool Aliases(const Types::Matrix<_core_impl>& _dst,
+                       const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  return Impl::Aliases(_dst, _e, true);
+}
+
+template <typename _core_impl, typename _expr>
+constexpr void Assign(Types::Matrix<_core_impl>& _dst, const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  const Trace::Span span =
+      Trace::Begin(Trace::Kind::Assign, Trace::Bytes(_e), Trace::Flops(_e));
+
+  if constexpr (Impl::IsSelfTranspose<Types::Matrix<_core_impl>,
+                                      _expr>::value) {
+    if (&_e._o == &_dst && _dst.Rows() == _dst.Cols()) {
+      _dst.TransposeInPlace();
+      Trace::Count(Trace::Kind::Transpose, Trace::Bytes(_dst), 0);
+      Trace::End(span);
+      return;
+    }
+  }
+
+  if (Aliases(_dst, _e)) {
+    // `_e` reads elements of `_dst` after they would be overwritten.
+    using temp_core    = Traits::Core::plain_t<_core_impl>;
+    using scratch_core = Memory::scratch_t<temp_core>;
+
+    if constexpr (!std::is_same_v<scratch_core, temp_core>) {
+      // Workspace storage must not be moved into `_dst`, so it is copied out.
+      if (Memory::GetWorkspace() != nullptr) {
+        Types::Matrix<scratch_core> temp;
+        AssignNoAlias(temp, _e);
+        Trace::Count(Trace::Kind::Temporary, Trace::Bytes(temp), 0);
+        AssignNoAlias(_dst, temp);
+        Trace::End(span);
+        return;
+      }
+    }
+
+    Types::Matrix<temp_core> temp;
+    AssignNoAlias(temp, _e);
+    Trace::Count(Trace::Kind::Temporary, Trace::Bytes(temp), 0);
+    if constexpr (std::is_same_v<temp_core, _core_impl>) {
+      _dst = std::move(temp);
+    } else {
+      AssignNoAlias(_dst, temp);
+    }
+    Trace::End(span);
+    return;
+  }
+  AssignNoAlias(_dst, _e);
+  Trace::End(span);
+}
+
+template <typename _core_impl, typename _expr>
+constexpr void AssignNoAlias(Types::Matrix<_core_impl>& _dst,
+                             const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  if constexpr (Traits::Core::is_dynamic_v<_core_impl>) {
+    if (_dst.Rows() != _e.Rows() || _dst.Cols() != _e.Cols()) {
+      _dst.Resize(_e.Rows(), _e.Cols());
+    }
+  } else if constexpr (Traits::Expr::is_dynamic_v<_expr>) {
+    if (_dst.Rows() != _e.Rows() || _dst.Cols() != _e.Cols()) {
+      throw std::invalid_argument(
+          "Error: dimension mismatch between `_dst` and `_expr`.");
+    }
+  }
+
+  if constexpr (Impl::IsProductAssignable<Types::Matrix<_core_impl>,
+                                          _expr>::value) {
+    if (!Config::IsConstantEvaluated()) {
+      Impl::AssignProduct(_dst, _e._l, _e._r);
+      return;
+    }
+  } else if constexpr (Impl::IsAccumulateAssignable<Types::Matrix<_core_impl>,
+                                                    _expr>::value) {
+    if (!Config::IsConstantEvaluated()) {
+      Impl::AssignAccumulate(_dst, _e._l, _e._r);
+      return;
+    }
+  } else if constexpr (Impl::IsMergeAssignable<Types::Matrix<_core_impl>,
+                                               _expr>::value) {
+    if (!Config::IsConstantEvaluated()) {
+      Impl::AssignMerge(
+          _dst, _e._l, _e._r, Impl::MergeFn<typename _expr::op_type>{});
+      return;
+    }
+  } else if constexpr (Impl::IsCopyAssignable<Types::Matrix<_core_impl>,
+                                              _expr>::value) {
+    if (!Config::IsConstantEvaluated()) {
+      Impl::AssignCopy(_dst, _e);
+      return;
+    }
+  } else if constexpr (Impl::IsStridedAssignable<Types::Matrix<_core_impl>,
+                                                 _expr>::value) {
+    if (!Config::IsConstantEvaluated() &&
+        _dst.Rows() * _dst.Cols() >= std::size_t{SGLTY_STRIDED_THRESHOLD}) {
+      using destrided = Impl::Destrided<_core_impl::core_traits::core_major,
+                                        _expr>;
+
+      const typename destrided::temporaries temporaries(_e);
+      AssignNoAlias(_dst, destrided::Apply(_e, temporaries));
+      return;
+    }
+  } else if constexpr (Impl::IsTiledAssignable<Types::Matrix<_core_impl>,
+                                               _expr>::value) {
+    if (!Config::IsConstantEvaluated()) {
+      Impl::AssignTiled(_dst, _e);
+      return;
+    }
+  } else if constexpr (Impl::IsPacketAssignable<Types::Matrix<_core_impl>,
+                                                _expr>::value) {
+    if (!Config::IsConstantEvaluated()) {
+      using value_type = typename Types::Matrix<_core_impl>::value_type;
+
+      Impl::ForEachPanel<_expr>(
+          _dst,
+          [&](std::size_t i0,
+              std::size_t j0,
+              std::size_t rows,
+              std::size_t cols) {
+            Types::Impl::TraversePacket<_core_impl::core_traits::core_major>(
+                rows,
+                cols,
+                Simd::Packet<value_type>::size,
+                [&](std::size_t i, std::size_t j) {
+                  _dst.StorePacket(i0 + i, j0 + j, _e.Packet(i0 + i, j0 + j));
+                },
+                [&](std::size_t i, std::size_t j) {
+                  _dst(i0 + i, j0 + j) = _e(i0 + i, j0 + j);
+                });
+          });
+      return;
+    }
+  }
+
+  if constexpr (Traits::Core::is_sparse_v<_core_impl>) {
+    // Only non-zero results are stored.
+    _dst = Types::Matrix<_core_impl>();
+    Traverse(_dst, [&](std::size_t i, std::size_t j) {
+      const auto value = _e(i, j);
+      if (value != decltype(value){}) {
+        _dst(i, j) = value;
+      }
+    });
+  } else {
+    if constexpr (Impl::IsParallelAssignable<Types::Matrix<_core_impl>,
+                                             _expr>::value) {
+      if (!Config::IsConstantEvaluated()) {
+        Impl::ForEachPanel<_expr>(
+            _dst,
+            [&](std::size_t i0,
+                std::size_t j0,
+                std::size_t rows,
+                std::size_t cols) {
+              Types::Impl::Traverse<_core_impl::core_traits::core_major>(
+                  rows,
+                  cols,
+                  [&](std::size_t i, std::size_t j) {
+                    _dst(i0 + i, j0 + j) = _e(i0 + i, j0 + j);
+                  });
+            });
+        return;
+      }
+    }
+    Traverse(_dst,
+             [&](std::size_t i, std::size_t j) { _dst(i, j) = _e(i, j); });
+  }
+}
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/Assign.tpp
@@ -2,12 +2,43 @@
 
 #include "../Binary.hpp"
 
+#include <stdexcept>
+#include <utility>
+
+#include "../../Traits/Expr.hpp"
+
 namespace Sglty::Expr {
 
 template <typename _lhs, typename _rhs, typename _op>
-constexpr Binary<_lhs, _rhs, _op>::Binary(const lhs_type& _l,
-                                          const rhs_type& _r)
-    : _l(_l), _r(_r) {}
+template <typename _l_arg, typename _r_arg>
+constexpr Binary<_lhs, _rhs, _op>::Binary(_l_arg&& _l, _r_arg&& _r)
+    : _l(std::forward<_l_arg>(_l)), _r(std::forward<_r_arg>(_r)) {
+  if constexpr (Traits::Expr::is_dynamic_v<lhs_type> ||
+                Traits::Expr::is_dynamic_v<rhs_type>) {
+    if (!op_type{}.IsValidDimension(this->_l, this->_r)) {
+      throw std::invalid_argument(
+          "Error: `_lhs` and `_rhs` have incompatible dimensions.");
+    }
+  }
+}
+
+template <typename _lhs, typename _rhs, typename _op>
+constexpr std::size_t Binary<_lhs, _rhs, _op>::Rows() const {
+  if constexpr (Traits::Expr::is_dynamic_v<Binary>) {
+    return op_type{}.Rows(_l, _r);
+  } else {
+    return rows;
+  }
+}
+
+template <typename _lhs, typename _rhs, typename _op>
+constexpr std::size_t Binary<_lhs, _rhs, _op>::Cols() const {
+  if constexpr (Traits::Expr::is_dynamic_v<Binary>) {
+    return op_type{}.Cols(_l, _r);
+  } else {
+    return cols;
+  }
+}
 
 template <typename _lhs, typename _rhs, typename _op>
 constexpr auto Binary<_lhs, _rhs, _op>::operator()(std::size_t i,
@@ -15,6 +46,28 @@ constexpr auto Binary<_lhs, _rhs, _op>::operator()(std::size_t i,
   return op_type{}(_l, _r, i, j);
 }
 
+template <typename _lhs, typename _rhs, typename _op>
+auto Binary<_lhs, _rhs, _op>::Packet(std::size_t i, std::size_t j) const {
+  return op_type{}.Packet(_l, _r, i, j);
+}
+
+namespace Impl {
+
+// The runtime shape check of a `Binary<_lhs, _rhs, _op>` node, for rewrites
+// that do not build it, e.g. `x + Zero()` to `x`.
+template <typename _op, typename _lhs, typename _rhs>
+constexpr void CheckDimension(const _lhs& _l, const _rhs& _r) {
+  if constexpr (Traits::Expr::is_dynamic_v<_lhs> ||
+                Traits::Expr::is_dynamic_v<_rhs>) {
+    if (!_op{}.IsValidDimension(_l, _r)) {
+      throw std::invalid_argument(
+          "Error: `_lhs` and `_rhs` have incompatible dimensions.");
+    }
+  }
+}
+
+}  // namespace Impl
+
 }  // namespace Sglty::Expr
 
 // Singularity/Expr/Impl/Binary.tpp
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../Broadcast.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Sglty::Expr {
+
+template <typename _operand, typename _core_impl>
+constexpr Broadcast<_operand, _core_impl>::Broadcast(const operand_type& _o,
+                                                     std::size_t _rows,
+                                                     std::size_t _cols)
+    : _o(_o), _m_rows(_rows), _m_cols(_cols) {
+  if constexpr (Traits::Expr::is_dynamic_v<operand_type> ||
+                Traits::Core::is_dynamic_v<core_impl>) {
+    const bool row = this->_o.Rows() == 1 && this->_o.Cols() == Cols();
+    const bool col = this->_o.Cols() == 1 && this->_o.Rows() == Rows();
+    if (!row && !col) {
+      throw std::invalid_argument(
+          "Error: only a row or a column vector of a matching extent can be "
+          "broadcast.");
+    }
+  }
+}
+
+template <typename _operand, typename _core_impl>
+constexpr std::size_t Broadcast<_operand, _core_impl>::Rows() const {
+  if constexpr (rows == Traits::Size::dynamic) {
+    return _m_rows;
+  } else {
+    return rows;
+  }
+}
+
+template <typename _operand, typename _core_impl>
+constexpr std::size_t Broadcast<_operand, _core_impl>::Cols() const {
+  if constexpr (cols == Traits::Size::dynamic) {
+    return _m_cols;
+  } else {
+    return cols;
+  }
+}
+
+template <typename _operand, typename _core_impl>
+constexpr auto Broadcast<_operand, _core_impl>::operator()(
+    std::size_t i, std::size_t j) const {
+  return _o(_o.Rows() == 1 ? 0 : i, _o.Cols() == 1 ? 0 : j);
+}
+
+template <typename _operand>
+template <typename _expr>
+constexpr auto UnshapedBroadcast<_operand>::Shape(const _expr& _e) const {
+  using operand_type = std::remove_cv_t<std::remove_reference_t<_operand>>;
+  using value_type   = typename operand_type::core_impl::value_type;
+
+  return Broadcast<_operand, Impl::shaped_core_t<_expr, value_type>>(
+      _o, _e.Rows(), _e.Cols());
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty {
+
+template <typename _operand>
+constexpr auto Broadcast(_operand&& _o) {
+  using operand_type = std::decay_t<_operand>;
+
+  static_assert(Traits::Expr::is_valid_v<operand_type>,
+                "Error: `_operand` is not a valid expression type.");
+
+  // Every element is read once per repeat.
+  using nested_type =
+      std::conditional_t<Traits::Expr::contains_product_v<operand_type>,
+                         Expr::Materialized<operand_type>,
+                         Traits::Expr::nested_t<_operand>>;
+
+  return Expr::UnshapedBroadcast<nested_type>{{}, std::forward<_operand>(_o)};
+}
+
+}  // namespace Sglty
+
+// Singularity/Expr/Impl/Broadcast.tpp
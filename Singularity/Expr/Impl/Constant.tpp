@@ -0,0 +1,135 @@
+#pragma once
+
+#include "../Constant.hpp"
+
+#include <cstddef>
+
+#include "../../Simd/Packet.hpp"
+#include "../../Traits/Size.hpp"
+#include "../../Traits/Type.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+template <typename _core_impl>
+constexpr Generated<_core_impl>::Generated(std::size_t _rows,
+                                           std::size_t _cols)
+    : _m_rows(_rows), _m_cols(_cols) {}
+
+template <typename _core_impl>
+constexpr std::size_t Generated<_core_impl>::Rows() const {
+  if constexpr (rows == Traits::Size::dynamic) {
+    return _m_rows;
+  } else {
+    return rows;
+  }
+}
+
+template <typename _core_impl>
+constexpr std::size_t Generated<_core_impl>::Cols() const {
+  if constexpr (cols == Traits::Size::dynamic) {
+    return _m_cols;
+  } else {
+    return cols;
+  }
+}
+
+}  // namespace Impl
+
+template <typename _core_impl>
+constexpr Constant<_core_impl>::Constant(value_type _v)
+    : Constant(Constant::rows, Constant::cols, _v) {
+  static_assert(!Traits::Core::is_dynamic_v<_core_impl>,
+                "Error: a runtime-sized constant needs a shape.");
+}
+
+template <typename _core_impl>
+constexpr Constant<_core_impl>::Constant(std::size_t _rows,
+                                         std::size_t _cols,
+                                         value_type _v)
+    : Impl::Generated<_core_impl>(_rows, _cols), _m_value(_v) {}
+
+template <typename _core_impl>
+constexpr typename Constant<_core_impl>::value_type
+Constant<_core_impl>::Value() const {
+  return _m_value;
+}
+
+template <typename _core_impl>
+constexpr typename Constant<_core_impl>::value_type
+Constant<_core_impl>::operator()(std::size_t, std::size_t) const {
+  return _m_value;
+}
+
+template <typename _core_impl>
+auto Constant<_core_impl>::Packet(std::size_t, std::size_t) const {
+  return Simd::Packet<value_type>::Broadcast(_m_value);
+}
+
+template <typename _core_impl>
+constexpr Zero<_core_impl>::Zero()
+    : Constant<_core_impl>(typename Zero::value_type{}) {}
+
+template <typename _core_impl>
+constexpr Zero<_core_impl>::Zero(std::size_t _rows, std::size_t _cols)
+    : Constant<_core_impl>(_rows, _cols, typename Zero::value_type{}) {}
+
+template <typename _core_impl>
+constexpr Identity<_core_impl>::Identity()
+    : Identity(Identity::rows, Identity::cols) {
+  static_assert(!Traits::Core::is_dynamic_v<_core_impl>,
+                "Error: a runtime-sized identity needs a shape.");
+}
+
+template <typename _core_impl>
+constexpr Identity<_core_impl>::Identity(std::size_t _rows, std::size_t _cols)
+    : Impl::Generated<_core_impl>(_rows, _cols) {}
+
+template <typename _core_impl>
+constexpr typename Identity<_core_impl>::value_type
+Identity<_core_impl>::operator()(std::size_t i, std::size_t j) const {
+  return i == j ? value_type(1) : value_type(0);
+}
+
+template <typename _Tp>
+template <typename _expr>
+constexpr auto UnshapedConstant<_Tp>::Shape(const _expr& _e) const {
+  return Constant<Impl::shaped_core_t<_expr, _Tp>>(_e.Rows(), _e.Cols(), _v);
+}
+
+template <typename _expr>
+constexpr auto UnshapedZero::Shape(const _expr& _e) const {
+  using value_type = typename _expr::core_impl::value_type;
+  return Zero<Impl::shaped_core_t<_expr, value_type>>(_e.Rows(), _e.Cols());
+}
+
+template <typename _expr>
+constexpr auto UnshapedIdentity::Shape(const _expr& _e) const {
+  using value_type = typename _expr::core_impl::value_type;
+  return Identity<Impl::shaped_core_t<_expr, value_type>>(_e.Rows(),
+                                                          _e.Cols());
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty {
+
+template <typename _Tp>
+constexpr Expr::UnshapedConstant<_Tp> Constant(_Tp _v) {
+  static_assert(Traits::Type::is_numeric_v<_Tp>,
+                "Error: a constant must be of an arithmetic type.");
+  return {{}, _v};
+}
+
+constexpr Expr::UnshapedZero Zero() {
+  return {};
+}
+
+constexpr Expr::UnshapedIdentity Identity() {
+  return {};
+}
+
+}  // namespace Sglty
+
+// Singularity/Expr/Impl/Constant.tpp
@@ -12,6 +12,18 @@ constexpr auto Dummy::operator()(std::size_t i, std::size_t j) const {
   return Op::Dummy{}(Dummy{}, Dummy{}, i, j);
 }
 
+constexpr std::size_t Dummy::Rows() const {
+  return rows;
+}
+
+constexpr std::size_t Dummy::Cols() const {
+  return cols;
+}
+
+constexpr Dummy::operator int() const {
+  return 0;
+}
+
 }  // namespace Sglty::Expr
 
 // Singularity/Expr/Impl/Dummy.tpp
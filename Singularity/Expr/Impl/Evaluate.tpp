@@ -2,6 +2,10 @@
 
 #include "../Evaluate.hpp"
 
+#include "../Assign.hpp"
+#include "../../Memory/Workspace.hpp"
+#include "../../Trace/Tracer.hpp"
+#include "../../Traits/Core.hpp"
 #include "../../Traits/Expr.hpp"
 #include "../../Types/Matrix.hpp"
 
@@ -12,12 +16,23 @@ constexpr auto Evaluate(const _expr& _e) {
   static_assert(Traits::Expr::is_valid_v<_expr>,
                 "Error: `_expr` is not a valid expression type.");
 
-  Types::Matrix<typename _expr::core_impl> ret;
-  Traverse(ret, [&](std::size_t i, std::size_t j) { ret(i, j) = _e(i, j); });
+  const Trace::Span span =
+      Trace::Begin(Trace::Kind::Evaluate, Trace::Bytes(_e), Trace::Flops(_e));
+
+  Types::Matrix<Traits::Core::plain_t<typename _expr::core_impl>> ret;
+  AssignNoAlias(ret, _e);
+
+  Trace::End(span);
 
   return ret;
 }
 
+template <typename _expr>
+auto Evaluate(const _expr& _e, Memory::Workspace& _workspace) {
+  const Memory::UseWorkspace use(_workspace);
+  return Evaluate(_e);
+}
+
 }  // namespace Sglty::Expr
 
 // Singularity/Expr/Impl/Evaluate.tpp
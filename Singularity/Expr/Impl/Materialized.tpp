@@ -0,0 +1,56 @@
+#pragma once
+
+#include "../Materialized.hpp"
+
+#include "../Assign.hpp"
+#include "../../Trace/Tracer.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+// `Evaluate()` into a matrix of another core than the plain one.
+template <typename _matrix, typename _expr>
+constexpr _matrix EvaluateAs(const _expr& e) {
+  const Trace::Span span =
+      Trace::Begin(Trace::Kind::Evaluate, Trace::Bytes(e), Trace::Flops(e));
+
+  _matrix ret;
+  Expr::AssignNoAlias(ret, e);
+
+  Trace::End(span);
+  return ret;
+}
+
+}  // namespace Impl
+
+template <typename _expr>
+constexpr Materialized<_expr>::Materialized(const expr_type& _e)
+    : _m(Impl::EvaluateAs<matrix_type>(_e)) {
+  Trace::Count(Trace::Kind::Temporary, Trace::Bytes(_m), 0);
+}
+
+template <typename _expr>
+constexpr std::size_t Materialized<_expr>::Rows() const {
+  return _m.Rows();
+}
+
+template <typename _expr>
+constexpr std::size_t Materialized<_expr>::Cols() const {
+  return _m.Cols();
+}
+
+template <typename _expr>
+constexpr auto Materialized<_expr>::operator()(std::size_t i,
+                                               std::size_t j) const {
+  return _m(i, j);
+}
+
+template <typename _expr>
+auto Materialized<_expr>::Packet(std::size_t i, std::size_t j) const {
+  return _m.Packet(i, j);
+}
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/Materialized.tpp
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../NoAlias.hpp"
+
+#include "../Assign.hpp"
+#include "../../Op/Arthm/Add.hpp"
+#include "../../Op/Arthm/Sub.hpp"
+#include "../../Traits/Size.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _matrix>
+constexpr NoAlias<_matrix>::NoAlias(matrix_type& _m) : _m_matrix(_m) {}
+
+template <typename _matrix>
+template <typename _expr>
+constexpr typename NoAlias<_matrix>::matrix_type& NoAlias<_matrix>::operator=(
+    const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: non-expression passed");
+  static_assert(
+      Traits::Size::is_compatible_v<matrix_type::rows, _expr::rows> &&
+          Traits::Size::is_compatible_v<matrix_type::cols, _expr::cols>,
+      "Error: dimension mismatch.");
+
+  AssignNoAlias(_m_matrix, _e);
+  return _m_matrix;
+}
+
+template <typename _matrix>
+template <typename _expr>
+constexpr typename NoAlias<_matrix>::matrix_type& NoAlias<_matrix>::operator+=(
+    const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: non-expression passed");
+
+  AssignNoAlias(_m_matrix, Op::Arthm::Add(_m_matrix, _e));
+  return _m_matrix;
+}
+
+template <typename _matrix>
+template <typename _expr>
+constexpr typename NoAlias<_matrix>::matrix_type& NoAlias<_matrix>::operator-=(
+    const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: non-expression passed");
+
+  AssignNoAlias(_m_matrix, Op::Arthm::Sub(_m_matrix, _e));
+  return _m_matrix;
+}
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/NoAlias.tpp
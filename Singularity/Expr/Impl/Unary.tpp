@@ -2,17 +2,78 @@
 
 #include "../Unary.hpp"
 
+#include <type_traits>
+#include <utility>
+
+#include "../../Traits/Expr.hpp"
+
 namespace Sglty::Expr {
 
 template <typename _operand, typename _op>
 constexpr Unary<_operand, _op>::Unary(const operand_type& _o) : _o(_o) {}
 
+template <typename _operand, typename _op>
+constexpr Unary<_operand, _op>::Unary(operand_type&& _o)
+    : _o(std::move(_o)) {}
+
+template <typename _operand, typename _op>
+constexpr std::size_t Unary<_operand, _op>::Rows() const {
+  if constexpr (Traits::Expr::is_dynamic_v<Unary>) {
+    return op_type{}.Rows(_o);
+  } else {
+    return rows;
+  }
+}
+
+template <typename _operand, typename _op>
+constexpr std::size_t Unary<_operand, _op>::Cols() const {
+  if constexpr (Traits::Expr::is_dynamic_v<Unary>) {
+    return op_type{}.Cols(_o);
+  } else {
+    return cols;
+  }
+}
+
 template <typename _operand, typename _op>
 constexpr auto Unary<_operand, _op>::operator()(std::size_t i,
                                                 std::size_t j) const {
   return op_type{}(_o, i, j);
 }
 
+template <typename _operand, typename _op>
+auto Unary<_operand, _op>::Packet(std::size_t i, std::size_t j) const {
+  return op_type{}.Packet(_o, i, j);
+}
+
+namespace Impl {
+
+// The operand of `_e` the way `_e` holds it: a referenced terminal stays a
+// reference, an operand held by value is copied out of an lvalue node and
+// moved out of a temporary one. Used by rewrites that drop a node, e.g.
+// `-(-x)` to `x`.
+template <typename _unary>
+constexpr decltype(auto) Operand(_unary&& _e) {
+  using nested_type = typename std::decay_t<_unary>::nested_type;
+
+  if constexpr (std::is_reference_v<nested_type>) {
+    return static_cast<nested_type>(_e._o);
+  } else if constexpr (std::is_lvalue_reference_v<_unary>) {
+    return nested_type(_e._o);
+  } else {
+    return nested_type(std::move(_e._o));
+  }
+}
+
+// `_o` the way a node would hold it (see `Traits::Expr::nested_t`). Used by
+// rewrites that keep an operand in place of the node, e.g. `x + Zero()` to
+// `x`.
+template <typename _operand>
+constexpr Traits::Expr::nested_t<_operand> Nest(_operand&& _o) {
+  return std::forward<_operand>(_o);
+}
+
+}  // namespace Impl
+
 }  // namespace Sglty::Expr
 
 // Singularity/Expr/Impl/Unary.tpp
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Tag.hpp"
+#include "../Memory/Allocator.hpp"
+#include "../Traits/Expr.hpp"
+#include "../Types/Matrix.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Expression node holding the evaluated result of a sub-expression.
+ *
+ * `Materialized` evaluates `_expr` exactly once, on construction, into a
+ * temporary `Matrix<Sglty::Memory::scratch_t<_expr::core_impl>>` and then
+ * serves elements from it. Heap-backed temporaries are drawn from the
+ * workspace installed on the constructing thread, if any (see
+ * `Sglty::Memory::GetWorkspace()`).
+ *
+ * It is inserted automatically for operands that are read many times per
+ * output element and are expensive to recompute, e.g. the inner product of
+ * `(a * b) * c` (see `Sglty::Traits::Op::evaluate_before_use_v`). Without it
+ * every element of the outer product would redo a full inner dot product.
+ *
+ * Keeping `_expr` in the type lets `Sglty::Traits::Expr::cost_v` still
+ * account for the work spent on the temporary.
+ *
+ * @tparam _expr The materialized expression type.
+ */
+template <typename _expr>
+struct Materialized : Tag {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  /**
+   * @brief The expression that was evaluated.
+   */
+  using expr_type = _expr;
+
+  /**
+   * @brief The core implementation of the result.
+   */
+  using core_impl = typename expr_type::core_impl;
+
+  /**
+   * @brief The concrete matrix type holding the result.
+   */
+  using matrix_type = Types::Matrix<Memory::scratch_t<core_impl>>;
+
+  /**
+   * @brief The number of rows in the expression.
+   */
+  constexpr static std::size_t rows = expr_type::rows;
+
+  /**
+   * @brief The number of columns in the expression.
+   */
+  constexpr static std::size_t cols = expr_type::cols;
+
+  /**
+   * @brief Evaluates `_e` into the held temporary.
+   *
+   * @param _e The expression to evaluate.
+   */
+  constexpr Materialized(const expr_type& _e);
+
+  /**
+   * @brief Returns the number of rows of the held temporary.
+   */
+  constexpr std::size_t Rows() const;
+
+  /**
+   * @brief Returns the number of columns of the held temporary.
+   */
+  constexpr std::size_t Cols() const;
+
+  /**
+   * @brief Reads the evaluated value at a given coordinate.
+   *
+   * @param i The row index.
+   * @param j The column index.
+   * @return The element at (i, j) of the temporary.
+   */
+  constexpr auto operator()(std::size_t i, std::size_t j) const;
+
+  /**
+   * @brief Loads a SIMD packet from the held temporary.
+   *
+   * @param i The row index of the first lane.
+   * @param j The column index of the first lane.
+   * @return The packet of consecutive elements along the major axis.
+   */
+  auto Packet(std::size_t i, std::size_t j) const;
+
+  /// The evaluated temporary.
+  const matrix_type _m;
+};
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Materialized.tpp"
+
+// Singularity/Expr/Materialized.hpp
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../Traits/Expr.hpp"
+#include "../Types/Matrix.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Assignment proxy that evaluates straight into a matrix, skipping the
+ * aliasing check of `Sglty::Expr::Assign`.
+ *
+ * Returned by `Matrix::NoAlias()`. The caller promises that the assigned
+ * expression does not read the matrix being written, e.g. when a product of
+ * two views is known to target a disjoint buffer:
+ * ```
+ * c.NoAlias() = a * b;   // no scratch buffer, even if views are involved
+ * c.NoAlias() += a * b;  // evaluates `c + a * b` element by element
+ * ```
+ * If the promise is broken the result is unspecified (see
+ * `Sglty::Expr::AssignNoAlias`).
+ *
+ * The proxy refers to the matrix and must not outlive it.
+ *
+ * @tparam _matrix The `Matrix` type written to.
+ */
+template <typename _matrix>
+class NoAlias {
+ public:
+  /**
+   * @brief The `Matrix` type written to.
+   */
+  using matrix_type = _matrix;
+
+  /**
+   * @brief Wraps the matrix to write into.
+   *
+   * @param _m The destination matrix.
+   */
+  constexpr explicit NoAlias(matrix_type& _m);
+
+  /**
+   * @brief Evaluates `_e` straight into the wrapped matrix.
+   *
+   * @tparam _expr The expression type. Must satisfy
+   * `Sglty::Traits::Expr::is_valid_v`.
+   * @param _e The expression to evaluate.
+   * @return Reference to the wrapped matrix.
+   */
+  template <typename _expr>
+  constexpr matrix_type& operator=(const _expr& _e);
+
+  /**
+   * @brief Adds `_e` straight into the wrapped matrix.
+   *
+   * @tparam _expr The expression type.
+   * @param _e The expression to add.
+   * @return Reference to the wrapped matrix.
+   */
+  template <typename _expr>
+  constexpr matrix_type& operator+=(const _expr& _e);
+
+  /**
+   * @brief Subtracts `_e` straight from the wrapped matrix.
+   *
+   * @tparam _expr The expression type.
+   * @param _e The expression to subtract.
+   * @return Reference to the wrapped matrix.
+   */
+  template <typename _expr>
+  constexpr matrix_type& operator-=(const _expr& _e);
+
+ private:
+  matrix_type& _m_matrix;
+};
+
+}  // namespace Sglty::Expr
+
+#include "Impl/NoAlias.tpp"
+
+// Singularity/Expr/NoAlias.hpp
@@ -16,6 +16,16 @@ namespace Sglty::Expr {
  */
 struct Tag {};
 
+/**
+ * @brief Marker base class for operands without a shape of their own.
+ *
+ * Inherited by the placeholders returned from `Sglty::Constant()`,
+ * `Sglty::Zero()`, `Sglty::Identity()` and `Sglty::Broadcast()`. They are
+ * not expressions: `+`, `-` and `*` replace them by a node of the shape of
+ * the other operand through `Shape()`, e.g. `a + Sglty::Constant(1.0f)`.
+ */
+struct Unshaped {};
+
 }  // namespace Sglty::Expr
 
 // Singularity/Expr/Tag.hpp
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
 #include "../Traits/Core.hpp"
 #include "../Traits/Expr.hpp"
@@ -21,7 +22,9 @@ namespace Sglty::Expr {
  *
  * Used in expression trees and evaluated when passed into a `Matrix`.
  *
- * @tparam _operand The operand expression type.
+ * The operand is held according to `Sglty::Traits::Expr::nested_t`.
+ *
+ * @tparam _operand The operand storage type.
  * @tparam _op The operation defining evaluation and result traits.
  */
 template <typename _operand, typename _op>
@@ -29,7 +32,13 @@ struct Unary : Tag {
   /**
    * @brief The expression being transformed.
    */
-  using operand_type = _operand;
+  using operand_type = std::remove_cv_t<std::remove_reference_t<_operand>>;
+
+  /**
+   * @brief The operand as held by the node (see
+   * `Sglty::Traits::Expr::nested_t`).
+   */
+  using nested_type = _operand;
 
   static_assert(Traits::Expr::is_valid_v<operand_type>,
                 "Error: `_operand` is not a valid expression type.");
@@ -73,6 +82,31 @@ struct Unary : Tag {
    */
   constexpr Unary(const operand_type& _o);
 
+  /**
+   * @brief Constructs a unary expression node from a temporary operand.
+   *
+   * Moves the operand in, so owning operands are not copied.
+   *
+   * @param _o The operand expression to wrap.
+   */
+  constexpr Unary(operand_type&& _o);
+
+  /**
+   * @brief Returns the number of rows of the expression.
+   *
+   * Equals `rows` unless the expression is runtime-sized, in which case the
+   * extent is computed from the operand by `op_type::Rows()`.
+   */
+  constexpr std::size_t Rows() const;
+
+  /**
+   * @brief Returns the number of columns of the expression.
+   *
+   * Equals `cols` unless the expression is runtime-sized, in which case the
+   * extent is computed from the operand by `op_type::Cols()`.
+   */
+  constexpr std::size_t Cols() const;
+
   /**
    * @brief Evaluates the expression at a given coordinate.
    *
@@ -84,8 +118,20 @@ struct Unary : Tag {
    */
   constexpr auto operator()(std::size_t i, std::size_t j) const;
 
-  /// Stored operand (by value).
-  const operand_type _o;
+  /**
+   * @brief Evaluates a SIMD packet of the expression at a given coordinate.
+   *
+   * Only usable when `Sglty::Traits::Expr::is_vectorizable_v` holds for this
+   * expression. Actual evaluation logic is delegated to `op_type::Packet()`.
+   *
+   * @param i The row index of the first lane.
+   * @param j The column index of the first lane.
+   * @return The packet of consecutive results along the major axis.
+   */
+  auto Packet(std::size_t i, std::size_t j) const;
+
+  /// Stored operand (by reference for lvalue matrices, by value otherwise).
+  const _operand _o;
 };
 
 }  // namespace Sglty::Expr
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../Core/Enums.hpp"
+
+#if __has_include(<span>)
+#include <span>
+#endif
+
+namespace Sglty::Types {
+
+template <typename>
+class Matrix;
+
+}  // namespace Sglty::Types
+
+namespace Sglty::IO {
+
+/**
+ * @brief Kinds of element types in a serialized matrix.
+ */
+enum class Scalar : std::uint8_t {
+  /// Two's complement signed integers.
+  Signed = 1,
+
+  /// Unsigned integers.
+  Unsigned = 2,
+
+  /// IEEE 754 binary floating point, including `Core::Float16`.
+  Float = 3,
+
+  /// `Core::BFloat16`.
+  BFloat = 4,
+
+  /// `bool`, one byte per element.
+  Bool = 5
+};
+
+/**
+ * @brief Size in bytes of the header preceding the elements.
+ */
+constexpr inline std::size_t header_size = 32;
+
+/**
+ * @brief Description of a serialized matrix.
+ *
+ * A serialized matrix is a `header_size`-byte header followed by its
+ * `rows * cols` elements, tightly packed in `major` order and in the byte
+ * order of the writer. The header holds, in order:
+ *
+ * - the magic bytes `"SGLT"` and the format version (`1`)
+ * - `scalar`, `size`, `major` (`0` for row-, `1` for column-major) and the
+ *   byte order of the elements (`1` for little-, `2` for big-endian), one
+ *   byte each
+ * - six reserved zero bytes
+ * - `rows` and `cols`, as little-endian 64-bit integers
+ *
+ * Elements start at offset `header_size`, so a block written at an aligned
+ * address (e.g. the start of a memory-mapped file) can be read in place by
+ * `View()`.
+ */
+struct Header {
+  Scalar scalar;
+  std::uint8_t size;
+  Core::Major major;
+  std::uint64_t rows;
+  std::uint64_t cols;
+};
+
+/**
+ * @brief The `scalar` of the header of matrices of `_Tp`.
+ */
+template <typename _Tp>
+extern const Scalar scalar_v;
+
+/**
+ * @brief Returns the header `Write()` emits for `_m`.
+ */
+template <typename _core_impl>
+constexpr Header HeaderOf(const Types::Matrix<_core_impl>& _m);
+
+/**
+ * @brief Parses the header at the start of `_in`.
+ *
+ * Useful to pick the matrix type of data written by another program.
+ *
+ * @param _in   The serialized matrix.
+ * @param _size The size of `_in` in bytes.
+ * @return The parsed header.
+ * @throws std::invalid_argument if `_in` is shorter than `header_size`, is
+ * not a serialized matrix, or was written with another version or byte
+ * order.
+ */
+Header ReadHeader(const void* _in, std::size_t _size);
+
+/**
+ * @brief Number of bytes `Write()` needs for `_m`: `header_size` plus its
+ * elements.
+ */
+template <typename _core_impl>
+constexpr std::size_t SerializedSize(const Types::Matrix<_core_impl>& _m);
+
+/**
+ * @brief Serializes `_m` into `_out`.
+ *
+ * `_m` must be dense row- or column-major storage (`Core::Dense`,
+ * `Core::DenseHeap`, `Core::Dynamic`, views, ...). Its elements are copied
+ * with one `memcpy` when they are contiguous, and one per row (or column)
+ * otherwise.
+ *
+ * Example Usage:
+ * ```
+ * std::vector<std::byte> buf(Sglty::IO::SerializedSize(a));
+ * Sglty::IO::Write(a, buf.data(), buf.size());
+ * Sglty::IO::Read(b, buf.data(), buf.size());  // b == a
+ * ```
+ *
+ * @param _m    The matrix to serialize.
+ * @param _out  The destination.
+ * @param _size The size of `_out` in bytes.
+ * @return The number of bytes written, `SerializedSize(_m)`.
+ * @throws std::invalid_argument if `_out` is too small.
+ */
+template <typename _core_impl>
+std::size_t Write(const Types::Matrix<_core_impl>& _m,
+                  void* _out,
+                  std::size_t _size);
+
+/**
+ * @brief Deserializes a matrix written by `Write()` into `_m`.
+ *
+ * The value type and major of `_m` must match the header. A runtime-sized
+ * `_m` takes the shape of the header; a fixed-size one must already have it.
+ *
+ * @param _m    The matrix to read into.
+ * @param _in   The serialized matrix.
+ * @param _size The size of `_in` in bytes.
+ * @return The number of bytes read, i.e. the offset of whatever follows.
+ * @throws std::invalid_argument if `_in` is malformed, truncated or does not
+ * match `_m`.
+ */
+template <typename _core_impl>
+std::size_t Read(Types::Matrix<_core_impl>& _m,
+                 const void* _in,
+                 std::size_t _size);
+
+/**
+ * @brief Views a matrix serialized by `Write()` in place, without copying.
+ *
+ * `_view` is a `Core::Map` matrix, e.g. `MapMat<const float, 4, 4>`, whose
+ * value type (without `const`), shape and major must match the header. The
+ * view reads `_in` directly and is valid as long as `_in` is.
+ *
+ * Example Usage:
+ * ```
+ * Sglty::IO::MappedFile file("state.sglt");  // Singularity/IO/File.hpp
+ * const auto x = Sglty::IO::View<Sglty::MapMat<const float, 6, 6>>(
+ *     file.Data(), file.Size());
+ * ```
+ *
+ * @tparam _view The view type.
+ * @param _in   The serialized matrix.
+ * @param _size The size of `_in` in bytes.
+ * @return A view over the elements of `_in`.
+ * @throws std::invalid_argument if `_in` is malformed, truncated, not suitably
+ * aligned for the elements, or does not match `_view`.
+ */
+template <typename _view>
+_view View(const void* _in, std::size_t _size);
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+/**
+ * @brief Serializes `_m` into `_out` (see `Write(_m, _out, _size)`).
+ */
+template <typename _core_impl>
+std::size_t Write(const Types::Matrix<_core_impl>& _m,
+                  std::span<std::byte> _out);
+
+/**
+ * @brief Deserializes `_in` into `_m` (see `Read(_m, _in, _size)`).
+ */
+template <typename _core_impl>
+std::size_t Read(Types::Matrix<_core_impl>& _m,
+                 std::span<const std::byte> _in);
+
+/**
+ * @brief Views `_in` without copying (see `View(_in, _size)`).
+ */
+template <typename _view>
+_view View(std::span<const std::byte> _in);
+#endif
+
+}  // namespace Sglty::IO
+
+#include "Impl/Binary.tpp"
+
+// Singularity/IO/Binary.hpp
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Binary.hpp"
+
+namespace Sglty::IO {
+
+/**
+ * @brief Serializes `_m` to the file descriptor `_fd`.
+ *
+ * Writes the same bytes as `Write(_m, _out, _size)`, straight from the
+ * storage of `_m` with `writev()`, so files, pipes and sockets take a matrix
+ * without an intermediate buffer. Partial writes and interrupted calls are
+ * resumed.
+ *
+ * Not included by `Lib.hpp`, since it needs POSIX:
+ * ```
+ * #include "Singularity/IO/File.hpp"
+ *
+ * Sglty::IO::Write(socket, a);
+ * Sglty::IO::Read(socket, b);  // on the other end
+ * ```
+ *
+ * @param _fd The file descriptor to write to.
+ * @param _m  The matrix to serialize.
+ * @throws std::system_error if writing fails.
+ */
+template <typename _core_impl>
+void Write(int _fd, const Types::Matrix<_core_impl>& _m);
+
+/**
+ * @brief Deserializes a matrix written by `Write()` from `_fd` into `_m`.
+ *
+ * Reads the header, then the elements directly into the storage of `_m`. The
+ * same requirements as for `Read(_m, _in, _size)` apply. Exactly the bytes of
+ * one matrix are consumed, so several matrices can follow each other on a
+ * stream.
+ *
+ * @param _fd The file descriptor to read from.
+ * @param _m  The matrix to read into.
+ * @throws std::invalid_argument if the data is malformed or does not match
+ * `_m`.
+ * @throws std::system_error if reading fails or the stream ends early.
+ */
+template <typename _core_impl>
+void Read(int _fd, Types::Matrix<_core_impl>& _m);
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Gives `Read()` and `View()` direct access to a file written by `Write()`.
+ * The mapping starts page-aligned, so the elements of a matrix at the start
+ * of the file are suitably aligned for `View()`.
+ *
+ * Example Usage:
+ * ```
+ * const Sglty::IO::MappedFile file("weights.sglt");
+ * const auto w = Sglty::IO::View<Sglty::MapMat<const float, 64, 64>>(
+ *     file.Data(), file.Size());
+ * ```
+ */
+class MappedFile {
+ public:
+  /**
+   * @brief Maps the file at `_path`.
+   *
+   * @param _path The path of the file.
+   * @throws std::system_error if the file cannot be opened or mapped.
+   */
+  explicit MappedFile(const char* _path);
+
+  MappedFile(MappedFile&& _other) noexcept;
+  MappedFile& operator=(MappedFile&& _other) noexcept;
+
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile();
+
+  /**
+   * @brief Returns the first byte of the file, or `nullptr` if it is empty.
+   */
+  const std::byte* Data() const noexcept;
+
+  /**
+   * @brief Returns the size of the file in bytes.
+   */
+  std::size_t Size() const noexcept;
+
+ private:
+  const std::byte* _m_data;
+  std::size_t _m_size;
+};
+
+}  // namespace Sglty::IO
+
+#include "Impl/File.tpp"
+
+// Singularity/IO/File.hpp
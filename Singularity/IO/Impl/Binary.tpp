@@ -0,0 +1,315 @@
+#pragma once
+
+#include "../Binary.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../../Core/Enums.hpp"
+#include "../../Core/Half.hpp"
+#include "../../Expr/Assign.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Types/Matrix.hpp"
+
+namespace Sglty::Core {
+
+template <typename, std::size_t, std::size_t, Core::Major>
+class Map;
+
+}  // namespace Sglty::Core
+
+namespace Sglty::IO {
+
+namespace Impl {
+
+constexpr inline unsigned char magic[4] = {'S', 'G', 'L', 'T'};
+
+constexpr inline std::uint8_t version = 1;
+
+template <typename _Tp>
+constexpr Scalar ScalarOf() {
+  if constexpr (std::is_same_v<_Tp, bool>) {
+    return Scalar::Bool;
+  } else if constexpr (std::is_same_v<_Tp, Core::BFloat16>) {
+    return Scalar::BFloat;
+  } else if constexpr (std::is_same_v<_Tp, Core::Float16> ||
+                       std::is_floating_point_v<_Tp>) {
+    return Scalar::Float;
+  } else if constexpr (std::is_signed_v<_Tp>) {
+    return Scalar::Signed;
+  } else {
+    static_assert(std::is_unsigned_v<_Tp>,
+                  "Error: `_Tp` has no serialized representation.");
+    return Scalar::Unsigned;
+  }
+}
+
+// `1` on little-, `2` on big-endian targets.
+inline std::uint8_t ByteOrder() {
+  const std::uint16_t probe = 1;
+  unsigned char first;
+  std::memcpy(&first, &probe, 1);
+  return first == 1 ? 1 : 2;
+}
+
+template <typename _matrix>
+struct IsSerializable : Expr::Impl::IsDirectAccess<_matrix> {};
+
+template <typename _matrix>
+struct IsMapView : std::false_type {};
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+struct IsMapView<Types::Matrix<Core::Map<_Tp, _rows, _cols, _core_major>>>
+    : std::true_type {};
+
+// `lines` rows (row-major) or columns (column-major) of `length` elements,
+// `stride` elements apart; contiguous storage is a single line.
+struct Layout {
+  std::size_t lines;
+  std::size_t length;
+  std::size_t stride;
+};
+
+template <typename _matrix>
+Layout LayoutOf(const _matrix& m) {
+  constexpr bool row = _matrix::core_major == Core::Major::Row;
+
+  Layout layout{row ? m.Rows() : m.Cols(), row ? m.Cols() : m.Rows(), 0};
+  layout.stride = m.OuterStride();
+  if (layout.stride == layout.length || layout.lines <= 1) {
+    layout.length *= layout.lines;
+    layout.lines  = layout.length != 0;
+    layout.stride = layout.length;
+  }
+  return layout;
+}
+
+inline void EncodeHeader(const Header& h, unsigned char* out) {
+  std::memset(out, 0, header_size);
+  std::memcpy(out, magic, sizeof(magic));
+  out[4] = version;
+  out[5] = static_cast<std::uint8_t>(h.scalar);
+  out[6] = h.size;
+  out[7] = h.major == Core::Major::Row ? 0 : 1;
+  out[8] = ByteOrder();
+  for (std::size_t k = 0; k < 8; k++) {
+    out[16 + k] = static_cast<unsigned char>(h.rows >> (8 * k));
+    out[24 + k] = static_cast<unsigned char>(h.cols >> (8 * k));
+  }
+}
+
+// Bytes of the elements described by `h`.
+inline std::size_t PayloadSize(const Header& h) {
+  constexpr std::uint64_t max = std::numeric_limits<std::size_t>::max();
+
+  if (h.rows != 0 && h.cols > max / h.rows) {
+    throw std::invalid_argument("Error: the serialized matrix is too large.");
+  }
+  const std::uint64_t elements = h.rows * h.cols;
+  if (h.size != 0 && elements > (max - header_size) / h.size) {
+    throw std::invalid_argument("Error: the serialized matrix is too large.");
+  }
+  return static_cast<std::size_t>(elements * h.size);
+}
+
+// Checks `h` describes a matrix of `_matrix`'s value type and major.
+template <typename _matrix>
+void CheckType(const Header& h) {
+  using value_type = std::remove_cv_t<typename _matrix::value_type>;
+
+  if (h.scalar != scalar_v<value_type> || h.size != sizeof(value_type)) {
+    throw std::invalid_argument(
+        "Error: the serialized matrix has another value type.");
+  }
+  if (h.major != _matrix::core_major) {
+    throw std::invalid_argument(
+        "Error: the serialized matrix has another major.");
+  }
+}
+
+// Parses `in` and checks it holds a whole matrix of `_matrix`'s value type
+// and major.
+template <typename _matrix>
+Header CheckedHeader(const void* in, std::size_t size) {
+  const Header h = ReadHeader(in, size);
+  CheckType<_matrix>(h);
+  if (size - header_size < PayloadSize(h)) {
+    throw std::invalid_argument("Error: the serialized matrix is truncated.");
+  }
+  return h;
+}
+
+template <typename _matrix>
+void CheckShape(const _matrix& m, const Header& h) {
+  if (h.rows != m.Rows() || h.cols != m.Cols()) {
+    throw std::invalid_argument(
+        "Error: the serialized matrix has another shape.");
+  }
+}
+
+}  // namespace Impl
+
+template <typename _Tp>
+constexpr inline Scalar scalar_v = Impl::ScalarOf<std::remove_cv_t<_Tp>>();
+
+template <typename _core_impl>
+constexpr Header HeaderOf(const Types::Matrix<_core_impl>& _m) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = std::remove_cv_t<typename matrix_type::value_type>;
+
+  return Header{scalar_v<value_type>,
+                static_cast<std::uint8_t>(sizeof(value_type)),
+                matrix_type::core_major,
+                _m.Rows(),
+                _m.Cols()};
+}
+
+inline Header ReadHeader(const void* _in, std::size_t _size) {
+  const auto* in = static_cast<const unsigned char*>(_in);
+
+  if (_size < header_size) {
+    throw std::invalid_argument("Error: `_in` is too short for a header.");
+  }
+  if (std::memcmp(in, Impl::magic, sizeof(Impl::magic)) != 0 || in[7] > 1) {
+    throw std::invalid_argument("Error: `_in` is not a serialized matrix.");
+  }
+  if (in[4] != Impl::version) {
+    throw std::invalid_argument(
+        "Error: unsupported version of the serialized matrix.");
+  }
+  if (in[8] != Impl::ByteOrder()) {
+    throw std::invalid_argument(
+        "Error: the serialized matrix has another byte order.");
+  }
+
+  Header h{static_cast<Scalar>(in[5]),
+           in[6],
+           in[7] == 0 ? Core::Major::Row : Core::Major::Col,
+           0,
+           0};
+  for (std::size_t k = 0; k < 8; k++) {
+    h.rows |= std::uint64_t(in[16 + k]) << (8 * k);
+    h.cols |= std::uint64_t(in[24 + k]) << (8 * k);
+  }
+  return h;
+}
+
+template <typename _core_impl>
+constexpr std::size_t SerializedSize(const Types::Matrix<_core_impl>& _m) {
+  using value_type = typename Types::Matrix<_core_impl>::value_type;
+
+  return header_size + _m.Rows() * _m.Cols() * sizeof(value_type);
+}
+
+template <typename _core_impl>
+std::size_t Write(const Types::Matrix<_core_impl>& _m,
+                  void* _out,
+                  std::size_t _size) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  static_assert(Impl::IsSerializable<matrix_type>::value,
+                "Error: only dense row- or column-major matrices can be "
+                "serialized.");
+
+  const std::size_t bytes = SerializedSize(_m);
+  if (_size < bytes) {
+    throw std::invalid_argument("Error: `_out` is too small for `_m`.");
+  }
+
+  auto* out = static_cast<unsigned char*>(_out);
+  Impl::EncodeHeader(HeaderOf(_m), out);
+
+  const Impl::Layout layout = Impl::LayoutOf(_m);
+  const std::size_t line    = layout.length * sizeof(value_type);
+  for (std::size_t k = 0; k < layout.lines; k++) {
+    std::memcpy(
+        out + header_size + k * line, _m.Data() + k * layout.stride, line);
+  }
+  return bytes;
+}
+
+template <typename _core_impl>
+std::size_t Read(Types::Matrix<_core_impl>& _m,
+                 const void* _in,
+                 std::size_t _size) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  static_assert(Impl::IsSerializable<matrix_type>::value,
+                "Error: only dense row- or column-major matrices can be "
+                "deserialized.");
+  static_assert(!std::is_const_v<value_type>,
+                "Error: cannot read into a read-only view.");
+
+  const Header h = Impl::CheckedHeader<matrix_type>(_in, _size);
+  if constexpr (Traits::Core::is_dynamic_v<_core_impl>) {
+    _m.Resize(h.rows, h.cols);
+  } else {
+    Impl::CheckShape(_m, h);
+  }
+
+  const auto* in = static_cast<const unsigned char*>(_in);
+
+  // The destination goes through a plain pointer: copying straight into
+  // `_m.Data()` makes GCC report `-Warray-bounds` for fixed-size targets.
+  value_type* const data    = _m.Data();
+  const Impl::Layout layout = Impl::LayoutOf(_m);
+  const std::size_t line    = layout.length * sizeof(value_type);
+  for (std::size_t k = 0; k < layout.lines; k++) {
+    std::memcpy(data + k * layout.stride, in + header_size + k * line, line);
+  }
+  return header_size + Impl::PayloadSize(h);
+}
+
+template <typename _view>
+_view View(const void* _in, std::size_t _size) {
+  using value_type = typename _view::value_type;
+
+  static_assert(Impl::IsMapView<_view>::value,
+                "Error: `_view` must be a `Core::Map` matrix.");
+
+  const Header h = Impl::CheckedHeader<_view>(_in, _size);
+  if (h.rows != _view::rows || h.cols != _view::cols) {
+    throw std::invalid_argument(
+        "Error: the serialized matrix has another shape.");
+  }
+
+  const auto* data = static_cast<const unsigned char*>(_in) + header_size;
+  if (reinterpret_cast<std::uintptr_t>(data) % alignof(value_type) != 0) {
+    throw std::invalid_argument(
+        "Error: the elements of `_in` are not aligned for `_view`.");
+  }
+  return _view(const_cast<value_type*>(
+      reinterpret_cast<const std::remove_cv_t<value_type>*>(data)));
+}
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+template <typename _core_impl>
+std::size_t Write(const Types::Matrix<_core_impl>& _m,
+                  std::span<std::byte> _out) {
+  return Write(_m, _out.data(), _out.size());
+}
+
+template <typename _core_impl>
+std::size_t Read(Types::Matrix<_core_impl>& _m,
+                 std::span<const std::byte> _in) {
+  return Read(_m, _in.data(), _in.size());
+}
+
+template <typename _view>
+_view View(std::span<const std::byte> _in) {
+  return View<_view>(_in.data(), _in.size());
+}
+#endif
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/Binary.tpp
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "../File.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "../../Traits/Core.hpp"
+#include "../../Types/Matrix.hpp"
+
+namespace Sglty::IO {
+
+namespace Impl {
+
+// Most buffers handed to one `writev()` call.
+constexpr inline std::size_t max_iov = 64;
+
+[[noreturn]] inline void ThrowErrno() {
+  throw std::system_error(errno, std::generic_category());
+}
+
+// Writes all of `iov[0, count)`, advancing past partial writes.
+inline void WriteAll(int fd, ::iovec* iov, std::size_t count) {
+  while (count != 0) {
+    const ::ssize_t n = ::writev(fd, iov, static_cast<int>(count));
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      ThrowErrno();
+    }
+
+    auto done = static_cast<std::size_t>(n);
+    while (count != 0 && done >= iov->iov_len) {
+      done -= iov->iov_len;
+      iov++;
+      count--;
+    }
+    if (count != 0) {
+      iov->iov_base = static_cast<unsigned char*>(iov->iov_base) + done;
+      iov->iov_len -= done;
+    }
+  }
+}
+
+inline void ReadAll(int fd, void* out, std::size_t size) {
+  auto* dst = static_cast<unsigned char*>(out);
+  while (size != 0) {
+    const ::ssize_t n = ::read(fd, dst, size);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      ThrowErrno();
+    }
+    if (n == 0) {
+      throw std::system_error(
+          std::make_error_code(std::errc::io_error),
+          "Error: the stream ended inside a serialized matrix.");
+    }
+    dst  += n;
+    size -= static_cast<std::size_t>(n);
+  }
+}
+
+}  // namespace Impl
+
+template <typename _core_impl>
+void Write(int _fd, const Types::Matrix<_core_impl>& _m) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  static_assert(Impl::IsSerializable<matrix_type>::value,
+                "Error: only dense row- or column-major matrices can be "
+                "serialized.");
+
+  unsigned char header[header_size];
+  Impl::EncodeHeader(HeaderOf(_m), header);
+
+  const Impl::Layout layout = Impl::LayoutOf(_m);
+  const std::size_t line    = layout.length * sizeof(value_type);
+
+  ::iovec iov[Impl::max_iov];
+  iov[0]            = ::iovec{header, header_size};
+  std::size_t count = 1;
+  for (std::size_t k = 0; k < layout.lines; k++) {
+    const void* data = _m.Data() + k * layout.stride;
+
+    // `writev()` does not write through `iov_base`.
+    iov[count++] = ::iovec{const_cast<void*>(data), line};
+    if (count == Impl::max_iov) {
+      Impl::WriteAll(_fd, iov, count);
+      count = 0;
+    }
+  }
+  Impl::WriteAll(_fd, iov, count);
+}
+
+template <typename _core_impl>
+void Read(int _fd, Types::Matrix<_core_impl>& _m) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  static_assert(Impl::IsSerializable<matrix_type>::value,
+                "Error: only dense row- or column-major matrices can be "
+                "deserialized.");
+  static_assert(!std::is_const_v<value_type>,
+                "Error: cannot read into a read-only view.");
+
+  unsigned char header[header_size];
+  Impl::ReadAll(_fd, header, header_size);
+
+  const Header h = ReadHeader(header, header_size);
+  Impl::CheckType<matrix_type>(h);
+  Impl::PayloadSize(h);  // rejects shapes too large to address
+  if constexpr (Traits::Core::is_dynamic_v<_core_impl>) {
+    _m.Resize(h.rows, h.cols);
+  } else {
+    Impl::CheckShape(_m, h);
+  }
+
+  const Impl::Layout layout = Impl::LayoutOf(_m);
+  const std::size_t line    = layout.length * sizeof(value_type);
+  for (std::size_t k = 0; k < layout.lines; k++) {
+    Impl::ReadAll(_fd, _m.Data() + k * layout.stride, line);
+  }
+}
+
+inline MappedFile::MappedFile(const char* _path)
+    : _m_data(nullptr), _m_size(0) {
+  const int fd = ::open(_path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    Impl::ThrowErrno();
+  }
+
+  struct ::stat st;
+  if (::fstat(fd, &st) != 0) {
+    const int error = errno;
+    ::close(fd);
+    throw std::system_error(error, std::generic_category());
+  }
+
+  _m_size = static_cast<std::size_t>(st.st_size);
+  if (_m_size != 0) {
+    void* p = ::mmap(nullptr, _m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+      const int error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category());
+    }
+    _m_data = static_cast<const std::byte*>(p);
+  }
+  ::close(fd);
+}
+
+inline MappedFile::MappedFile(MappedFile&& _other) noexcept
+    : _m_data(std::exchange(_other._m_data, nullptr)),
+      _m_size(std::exchange(_other._m_size, 0)) {}
+
+inline MappedFile& MappedFile::operator=(MappedFile&& _other) noexcept {
+  if (this != &_other) {
+    if (_m_data != nullptr) {
+      ::munmap(const_cast<std::byte*>(_m_data), _m_size);
+    }
+    _m_data = std::exchange(_other._m_data, nullptr);
+    _m_size = std::exchange(_other._m_size, 0);
+  }
+  return *this;
+}
+
+inline MappedFile::~MappedFile() {
+  if (_m_data != nullptr) {
+    ::munmap(const_cast<std::byte*>(_m_data), _m_size);
+  }
+}
+
+inline const std::byte* MappedFile::Data() const noexcept { return _m_data; }
+
+inline std::size_t MappedFile::Size() const noexcept { return _m_size; }
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/File.tpp
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../Text.hpp"
+
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+#include "../../Core/Half.hpp"
+#include "../../Types/Matrix.hpp"
+
+namespace Sglty::IO {
+
+namespace Impl {
+
+// Longest text `Format()` emits for one element, with room to spare.
+constexpr inline std::size_t max_chars = 64;
+
+template <typename _Tp>
+char* Format(char* first, char* last, const _Tp& value) {
+  if constexpr (std::is_same_v<_Tp, bool>) {
+    *first = value ? '1' : '0';
+    return first + 1;
+  } else if constexpr (std::is_same_v<_Tp, Core::BFloat16> ||
+                       std::is_same_v<_Tp, Core::Float16>) {
+    return std::to_chars(first, last, static_cast<float>(value)).ptr;
+  } else {
+    return std::to_chars(first, last, value).ptr;
+  }
+}
+
+// Emits the text of `m` in blocks of `size` characters through `flush`.
+template <typename _matrix, typename _flush>
+void FormatRows(const _matrix& m, char* buf, std::size_t size, _flush flush) {
+  using value_type = std::remove_cv_t<typename _matrix::value_type>;
+
+  char* const last = buf + size;
+  char* out        = buf;
+  for (std::size_t i = 0; i < m.Rows(); i++) {
+    for (std::size_t j = 0; j < m.Cols(); j++) {
+      if (static_cast<std::size_t>(last - out) < max_chars) {
+        flush(buf, out - buf);
+        out = buf;
+      }
+      out    = Format<value_type>(out, last, m(i, j));
+      *out++ = ' ';
+    }
+    if (out == last) {
+      flush(buf, out - buf);
+      out = buf;
+    }
+    *out++ = '\n';
+  }
+  flush(buf, out - buf);
+}
+
+}  // namespace Impl
+
+template <typename _core_impl>
+void WriteText(std::FILE* _file, const Types::Matrix<_core_impl>& _m) {
+  char buf[4096];
+  Impl::FormatRows(
+      _m, buf, sizeof(buf), [_file](const char* _data, std::size_t _size) {
+        if (_size != 0 && std::fwrite(_data, 1, _size, _file) != _size) {
+          throw std::system_error(errno, std::generic_category());
+        }
+      });
+}
+
+template <typename _core_impl>
+std::string ToString(const Types::Matrix<_core_impl>& _m) {
+  std::string text;
+  char buf[4096];
+  Impl::FormatRows(
+      _m, buf, sizeof(buf), [&text](const char* _data, std::size_t _size) {
+        text.append(_data, _size);
+      });
+  return text;
+}
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/Text.tpp
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+
+namespace Sglty::Types {
+
+template <typename>
+class Matrix;
+
+}  // namespace Sglty::Types
+
+namespace Sglty::IO {
+
+/**
+ * @brief Writes `_m` as text to `_file`, one row per line.
+ *
+ * Every element is followed by a `' '` and every row by a `'\n'`, as in
+ * `Matrix::Print()`. Elements are formatted with `std::to_chars` into a
+ * buffer that is handed to `std::fwrite` in large blocks; floating-point
+ * values use the shortest representation that reads back to the same value,
+ * `Core::BFloat16` and `Core::Float16` that of their `float` value. Any core
+ * is accepted, including sparse ones, whose missing entries are written as
+ * `0`.
+ *
+ * @param _file The stream to write to.
+ * @param _m    The matrix to format.
+ * @throws std::system_error if `_file` reports a write error.
+ */
+template <typename _core_impl>
+void WriteText(std::FILE* _file, const Types::Matrix<_core_impl>& _m);
+
+/**
+ * @brief Formats `_m` as by `WriteText()` into a string.
+ *
+ * @param _m The matrix to format.
+ * @return The text of `_m`.
+ */
+template <typename _core_impl>
+std::string ToString(const Types::Matrix<_core_impl>& _m);
+
+}  // namespace Sglty::IO
+
+#include "Impl/Text.tpp"
+
+// Singularity/IO/Text.hpp
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Computes `C = A` for strided `A` and `C` of shape `m` x `n`.
+ *
+ * Element `(i, j)` of a matrix `x` lives at `x[i * x_rs + j * x_cs]`, as in
+ * `Sglty::Kernel::Gemm`; transposes and changes of major are expressed by
+ * swapping strides. When `A` and `C` are contiguous along the same axis,
+ * whole rows or columns are copied. When they are contiguous along different
+ * axes, so that plain loops would read or write with a stride, the copy is
+ * split into tiles of at least 32 x 32 that stay in cache, and tiles into
+ * `Simd::Packet<_Tp>::size` square blocks transposed in registers (see
+ * `Sglty::Simd::Transpose`).
+ *
+ * `C` must not overlap `A`.
+ *
+ * @param m Rows of `A` and `C`.
+ * @param n Columns of `A` and `C`.
+ * @param a Pointer to `A`.
+ * @param a_rs Row stride of `A`.
+ * @param a_cs Column stride of `A`.
+ * @param c Pointer to `C`.
+ * @param c_rs Row stride of `C`.
+ * @param c_cs Column stride of `C`.
+ */
+template <typename _Tp>
+void Copy(std::size_t m,
+          std::size_t n,
+          const _Tp* a,
+          std::size_t a_rs,
+          std::size_t a_cs,
+          _Tp* c,
+          std::size_t c_rs,
+          std::size_t c_cs);
+
+/**
+ * @brief Transposes the square `n` x `n` matrix `A` in place.
+ *
+ * Element `(i, j)` lives at `a[i * ld + j]`, or equivalently at
+ * `a[i + j * ld]`: the result is the same for both majors. Pairs of
+ * `Simd::Packet<_Tp>::size` square blocks mirrored across the diagonal are
+ * transposed in registers and swapped.
+ *
+ * @param n The number of rows and columns of `A`.
+ * @param a Pointer to `A`.
+ * @param ld Distance between consecutive rows (or columns) of `A`.
+ */
+template <typename _Tp>
+void TransposeInPlace(std::size_t n, _Tp* a, std::size_t ld);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Copy.tpp"
+
+// Singularity/Kernel/Copy.hpp
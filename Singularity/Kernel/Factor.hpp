@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Blocking parameters used by the factorization kernels.
+ *
+ * Matrices whose smaller extent is at most `small_threshold` are factored
+ * column by column. Larger ones are factored in panels of `nb` columns: each
+ * panel goes through the unblocked algorithm and the trailing matrix is
+ * updated by `Sglty::Kernel::GemmAccumulate`, which carries nearly all of the
+ * arithmetic of a large factorization.
+ *
+ * @tparam _Tp The scalar element type.
+ */
+template <typename _Tp>
+struct FactorBlocking {
+  static constexpr std::size_t nb = 64;
+
+  static constexpr std::size_t small_threshold = 2 * nb;
+};
+
+/**
+ * @brief Factors the `m` x `n` matrix `A` in place as `P * A = L * U` with
+ * partial (row) pivoting.
+ *
+ * Element `(i, j)` of `A` lives at `a[i * a_rs + j * a_cs]`, as in
+ * `Sglty::Kernel::Gemm`. On return the strict lower part of `A` holds the
+ * unit lower trapezoidal `L` and the upper part holds `U`. Row `k` was
+ * swapped with row `pivots[k] >= k` at step `k`, for every
+ * `k < min(m, n)`.
+ *
+ * A zero pivot leaves its column unscaled and the factorization continues,
+ * so `L * U` still equals `P * A`.
+ *
+ * Usable in constant expressions, where the unblocked algorithm is used.
+ *
+ * @tparam _Tp The floating-point element type.
+ * @param m Rows of `A`.
+ * @param n Columns of `A`.
+ * @param a Pointer to `A`.
+ * @param a_rs Row stride of `A`.
+ * @param a_cs Column stride of `A`.
+ * @param pivots `min(m, n)` row indices written by the factorization.
+ * @return `false` if `U` has a zero on its diagonal.
+ */
+template <typename _Tp>
+constexpr bool Lu(std::size_t m,
+                  std::size_t n,
+                  _Tp* a,
+                  std::size_t a_rs,
+                  std::size_t a_cs,
+                  std::size_t* pivots);
+
+/**
+ * @brief Factors the symmetric positive definite `n` x `n` matrix `A` in
+ * place as `A = L * Trp(L)`.
+ *
+ * Only the lower triangle of `A` is read, and it is overwritten by `L`; the
+ * strict upper triangle is left untouched.
+ *
+ * Usable in constant expressions, where the unblocked algorithm is used.
+ *
+ * @tparam _Tp The floating-point element type.
+ * @param n Rows and columns of `A`.
+ * @param a Pointer to `A`.
+ * @param a_rs Row stride of `A`.
+ * @param a_cs Column stride of `A`.
+ * @return `false` if `A` is not positive definite, in which case `A` is
+ * partially overwritten.
+ */
+template <typename _Tp>
+constexpr bool Cholesky(std::size_t n,
+                        _Tp* a,
+                        std::size_t a_rs,
+                        std::size_t a_cs);
+
+/**
+ * @brief Number of elements `Sglty::Kernel::Qr` needs as workspace for an
+ * `m` x `n` matrix.
+ *
+ * `0` when the matrix is small enough to be factored unblocked.
+ *
+ * @tparam _Tp The scalar element type.
+ */
+template <typename _Tp>
+constexpr std::size_t QrWorkspaceSize(std::size_t m, std::size_t n);
+
+/**
+ * @brief Factors the `m` x `n` matrix `A` in place as `A = Q * R` with
+ * Householder reflections.
+ *
+ * On return the upper part of `A` holds `R`, and column `k` below the
+ * diagonal holds the reflector `H_k = I - tau[k] * v * Trp(v)`, whose `v` has
+ * an implicit `1` on the diagonal; `Q = H_0 * H_1 * ... * H_{min(m, n) - 1}`.
+ * Large matrices accumulate the reflectors of each panel into a compact
+ * `I - V * T * Trp(V)` form and update the trailing matrix with two products.
+ *
+ * Usable in constant expressions, where the unblocked algorithm is used and
+ * `work` is not read.
+ *
+ * @tparam _Tp The floating-point element type.
+ * @param m Rows of `A`.
+ * @param n Columns of `A`.
+ * @param a Pointer to `A`.
+ * @param a_rs Row stride of `A`.
+ * @param a_cs Column stride of `A`.
+ * @param tau `min(m, n)` reflector factors written by the factorization.
+ * @param work `QrWorkspaceSize<_Tp>(m, n)` elements of scratch space, or
+ * `nullptr` when that is `0`.
+ */
+template <typename _Tp>
+constexpr void Qr(std::size_t m,
+                  std::size_t n,
+                  _Tp* a,
+                  std::size_t a_rs,
+                  std::size_t a_cs,
+                  _Tp* tau,
+                  _Tp* work);
+
+/**
+ * @brief Computes `B = Trp(Q) * B` for the `Q` of `Sglty::Kernel::Qr`.
+ *
+ * @tparam _Tp The floating-point element type.
+ * @param m Rows of the factored matrix and of `B`.
+ * @param k Number of reflectors, i.e. `min(m, n)` of the factored matrix.
+ * @param n Columns of `B`.
+ * @param qr Pointer to the factored matrix.
+ * @param qr_rs Row stride of the factored matrix.
+ * @param qr_cs Column stride of the factored matrix.
+ * @param tau The `k` reflector factors.
+ * @param b Pointer to `B`.
+ * @param b_rs Row stride of `B`.
+ * @param b_cs Column stride of `B`.
+ */
+template <typename _Tp>
+constexpr void ApplyQt(std::size_t m,
+                       std::size_t k,
+                       std::size_t n,
+                       const _Tp* qr,
+                       std::size_t qr_rs,
+                       std::size_t qr_cs,
+                       const _Tp* tau,
+                       _Tp* b,
+                       std::size_t b_rs,
+                       std::size_t b_cs);
+
+/**
+ * @brief Solves `T * X = B` in place for a triangular `n` x `n` matrix `T`
+ * and an `n` x `k` matrix `B`, which is overwritten by `X`.
+ *
+ * Only the triangle of `T` selected by `_lower` is read; with `_unit` its
+ * diagonal is taken to be `1` and not read either. `Trp(T)` is solved by
+ * swapping the strides of `T` and flipping `_lower`. Large systems are solved
+ * in blocks of `FactorBlocking<_Tp>::nb` rows, with the remaining rows updated
+ * by `Sglty::Kernel::GemmAccumulate`.
+ *
+ * `B` must not overlap `T`. Usable in constant expressions.
+ *
+ * @tparam _lower Whether `T` is lower (or upper) triangular.
+ * @tparam _unit  Whether `T` has a unit diagonal.
+ * @tparam _Tp    The floating-point element type.
+ * @param n Rows and columns of `T`, rows of `B`.
+ * @param k Columns of `B`.
+ * @param t Pointer to `T`.
+ * @param t_rs Row stride of `T`.
+ * @param t_cs Column stride of `T`.
+ * @param b Pointer to `B`.
+ * @param b_rs Row stride of `B`.
+ * @param b_cs Column stride of `B`.
+ */
+template <bool _lower, bool _unit, typename _Tp>
+constexpr void TriangularSolve(std::size_t n,
+                               std::size_t k,
+                               const _Tp* t,
+                               std::size_t t_rs,
+                               std::size_t t_cs,
+                               _Tp* b,
+                               std::size_t b_rs,
+                               std::size_t b_cs);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Factor.tpp"
+
+// Singularity/Kernel/Factor.hpp
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Blocking parameters used by `Sglty::Kernel::Gemm`.
+ *
+ * The product is computed on `mc × kc` panels of lhs and `kc × nc` panels of
+ * rhs, both packed into contiguous buffers, with an `mr × nr` register tile
+ * as the innermost unit of work:
+ *
+ * - `mr`, `nr` size the accumulator block kept in registers
+ *
+ * - `mc × kc` elements of packed lhs are meant to stay in L2
+ *
+ * - `kc × nr` elements of packed rhs are meant to stay in L1
+ *
+ * The register tile is fully unrolled at compile time (see
+ * `Impl::MicroKernel`), which lets the compiler keep it in vector registers
+ * without relying on loop vectorization heuristics.
+ *
+ * Products with fewer than `small_threshold` multiply-adds skip packing
+ * altogether and use a direct loop ordered by the output layout.
+ *
+ * Larger products are split into panels of whole `mc` row blocks of `C`,
+ * which `Sglty::Exec::ParallelFor` may run concurrently. Every element of `C`
+ * is accumulated in the same order either way. Multiply-adds are written as
+ * plain expressions, which the compiler contracts into FMA instructions where
+ * the target has them; explicit `std::fma` calls would block vectorization of
+ * the register tile.
+ *
+ * @tparam _Tp The scalar element type.
+ */
+template <typename _Tp>
+struct GemmBlocking {
+  static constexpr std::size_t mr = 8;
+  static constexpr std::size_t nr = 8;
+  static constexpr std::size_t mc = 64;
+  static constexpr std::size_t kc = 256;
+  static constexpr std::size_t nc = 1024;
+
+  static constexpr std::size_t small_threshold = 32 * 32 * 32;
+};
+
+/**
+ * @brief Computes `C = A * B` over raw strided buffers.
+ *
+ * Element `(i, j)` of a matrix `X` is read at `x[i * x_rs + j * x_cs]`, so
+ * both row-major (`x_rs = cols, x_cs = 1`) and column-major
+ * (`x_rs = 1, x_cs = rows`) operands are supported in any combination.
+ *
+ * `C` is overwritten and must not overlap `A` or `B`.
+ *
+ * Not usable during constant evaluation — callers keep a scalar fallback for
+ * that case.
+ *
+ * @tparam _Tp The scalar element type.
+ * @param m Rows of `A` and `C`.
+ * @param n Columns of `B` and `C`.
+ * @param k Columns of `A` and rows of `B`.
+ * @param a Pointer to `A`.
+ * @param a_rs Row stride of `A`.
+ * @param a_cs Column stride of `A`.
+ * @param b Pointer to `B`.
+ * @param b_rs Row stride of `B`.
+ * @param b_cs Column stride of `B`.
+ * @param c Pointer to `C`.
+ * @param c_rs Row stride of `C`.
+ * @param c_cs Column stride of `C`.
+ */
+template <typename _Tp>
+void Gemm(std::size_t m,
+          std::size_t n,
+          std::size_t k,
+          const _Tp* a,
+          std::size_t a_rs,
+          std::size_t a_cs,
+          const _Tp* b,
+          std::size_t b_rs,
+          std::size_t b_cs,
+          _Tp* c,
+          std::size_t c_rs,
+          std::size_t c_cs);
+
+/**
+ * @brief Computes `C = alpha * A * B + beta * C` over raw strided buffers.
+ *
+ * Same layout rules and blocking as `Gemm`, which is this kernel with
+ * `alpha = 1` and `beta = 0`. The product is accumulated straight into `C`
+ * without a temporary; when `beta` is zero `C` is only written, so it may
+ * hold uninitialized or non-finite values.
+ *
+ * `A`, `B` and `C` may each be stored in another element type than the one
+ * the product is computed in: `A` and `B` are converted to `_Tp` while they
+ * are packed, and `C` is read and rounded back once per element, e.g.
+ * `Sglty::Core::BFloat16` buffers accumulated in `float`.
+ *
+ * `C` must not overlap `A` or `B`.
+ *
+ * @tparam _Tp The element type the product is computed in.
+ * @tparam _Ta The element type of `A`, convertible to `_Tp`.
+ * @tparam _Tb The element type of `B`, convertible to `_Tp`.
+ * @tparam _Tc The element type of `C`, convertible from and to `_Tp`.
+ * @param m Rows of `A` and `C`.
+ * @param n Columns of `B` and `C`.
+ * @param k Columns of `A` and rows of `B`.
+ * @param alpha Factor of the product.
+ * @param a Pointer to `A`.
+ * @param a_rs Row stride of `A`.
+ * @param a_cs Column stride of `A`.
+ * @param b Pointer to `B`.
+ * @param b_rs Row stride of `B`.
+ * @param b_cs Column stride of `B`.
+ * @param beta Factor of the previous contents of `C`.
+ * @param c Pointer to `C`.
+ * @param c_rs Row stride of `C`.
+ * @param c_cs Column stride of `C`.
+ */
+template <typename _Tp, typename _Ta, typename _Tb, typename _Tc>
+void GemmAccumulate(std::size_t m,
+                    std::size_t n,
+                    std::size_t k,
+                    _Tp alpha,
+                    const _Ta* a,
+                    std::size_t a_rs,
+                    std::size_t a_cs,
+                    const _Tb* b,
+                    std::size_t b_rs,
+                    std::size_t b_cs,
+                    _Tp beta,
+                    _Tc* c,
+                    std::size_t c_rs,
+                    std::size_t c_cs);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Gemm.tpp"
+
+// Singularity/Kernel/Gemm.hpp
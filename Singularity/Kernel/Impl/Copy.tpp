@@ -0,0 +1,189 @@
+#pragma once
+
+#include "../Copy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "../../Simd/Packet.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+// Packets of `_Tp` that can be transposed in registers.
+template <typename _Tp>
+constexpr std::size_t TransposeWidth() {
+  if constexpr (Simd::is_vectorizable_v<_Tp>) {
+    return Simd::Packet<_Tp>::size;
+  } else {
+    return 1;
+  }
+}
+
+// Edge of the cache tiles a transposing copy is split into, a multiple of
+// the register block.
+template <typename _Tp>
+constexpr std::size_t CopyBlock() {
+  return std::max(std::size_t{32}, TransposeWidth<_Tp>());
+}
+
+// Moves the `w` x `w` block at `a` (rows `a_rs` apart) to `c` transposed
+// (rows `c_rs` apart), with `w = Simd::Packet<_Tp>::size`.
+template <typename _Tp>
+void TransposeBlock(const _Tp* a, std::size_t a_rs, _Tp* c, std::size_t c_rs) {
+  using packet_type = Simd::Packet<_Tp>;
+
+  packet_type rows[packet_type::size];
+  for (std::size_t k = 0; k < packet_type::size; k++) {
+    rows[k] = packet_type::Load(a + k * a_rs);
+  }
+  Simd::Transpose(rows);
+  for (std::size_t k = 0; k < packet_type::size; k++) {
+    rows[k].Store(c + k * c_rs);
+  }
+}
+
+// Replaces the `w` x `w` blocks at `x` and `y` with each other's
+// transposes.
+template <typename _Tp>
+void SwapTransposedBlocks(_Tp* x, _Tp* y, std::size_t ld) {
+  using packet_type = Simd::Packet<_Tp>;
+
+  packet_type x_rows[packet_type::size];
+  packet_type y_rows[packet_type::size];
+  for (std::size_t k = 0; k < packet_type::size; k++) {
+    x_rows[k] = packet_type::Load(x + k * ld);
+    y_rows[k] = packet_type::Load(y + k * ld);
+  }
+  Simd::Transpose(x_rows);
+  Simd::Transpose(y_rows);
+  for (std::size_t k = 0; k < packet_type::size; k++) {
+    x_rows[k].Store(y + k * ld);
+    y_rows[k].Store(x + k * ld);
+  }
+}
+
+// `C = A` with `A` contiguous along rows and `C` along columns:
+// `A(i, j) = a[i * a_rs + j]`, `C(i, j) = c[i + j * c_cs]`.
+template <typename _Tp>
+void CopyTransposed(std::size_t m,
+                    std::size_t n,
+                    const _Tp* a,
+                    std::size_t a_rs,
+                    _Tp* c,
+                    std::size_t c_cs) {
+  constexpr std::size_t w     = TransposeWidth<_Tp>();
+  constexpr std::size_t block = CopyBlock<_Tp>();
+
+  for (std::size_t i0 = 0; i0 < m; i0 += block) {
+    const std::size_t i_end = std::min(i0 + block, m);
+    for (std::size_t j0 = 0; j0 < n; j0 += block) {
+      const std::size_t j_end = std::min(j0 + block, n);
+
+      std::size_t i = i0;
+      if constexpr (w > 1) {
+        for (; i + w <= i_end; i += w) {
+          std::size_t j = j0;
+          for (; j + w <= j_end; j += w) {
+            TransposeBlock(a + i * a_rs + j, a_rs, c + i + j * c_cs, c_cs);
+          }
+          for (; j < j_end; j++) {
+            for (std::size_t k = i; k < i + w; k++) {
+              c[k + j * c_cs] = a[k * a_rs + j];
+            }
+          }
+        }
+      }
+      // Remaining rows, written along the contiguous axis of `C`.
+      for (std::size_t j = j0; j < j_end; j++) {
+        for (std::size_t k = i; k < i_end; k++) {
+          c[k + j * c_cs] = a[k * a_rs + j];
+        }
+      }
+    }
+  }
+}
+
+}  // namespace Impl
+
+template <typename _Tp>
+void Copy(std::size_t m,
+          std::size_t n,
+          const _Tp* a,
+          std::size_t a_rs,
+          std::size_t a_cs,
+          _Tp* c,
+          std::size_t c_rs,
+          std::size_t c_cs) {
+  if (m == 0 || n == 0) {
+    return;
+  }
+  if (a_cs == 1 && c_cs == 1) {
+    for (std::size_t i = 0; i < m; i++) {
+      std::copy_n(a + i * a_rs, n, c + i * c_rs);
+    }
+  } else if (a_rs == 1 && c_rs == 1) {
+    for (std::size_t j = 0; j < n; j++) {
+      std::copy_n(a + j * a_cs, m, c + j * c_cs);
+    }
+  } else if (a_cs == 1 && c_rs == 1) {
+    Impl::CopyTransposed(m, n, a, a_rs, c, c_cs);
+  } else if (a_rs == 1 && c_cs == 1) {
+    // C^T = A^T, with the roles of rows and columns swapped.
+    Impl::CopyTransposed(n, m, a, a_cs, c, c_rs);
+  } else {
+    constexpr std::size_t block = Impl::CopyBlock<_Tp>();
+
+    for (std::size_t i0 = 0; i0 < m; i0 += block) {
+      const std::size_t i_end = std::min(i0 + block, m);
+      for (std::size_t j0 = 0; j0 < n; j0 += block) {
+        const std::size_t j_end = std::min(j0 + block, n);
+        for (std::size_t i = i0; i < i_end; i++) {
+          for (std::size_t j = j0; j < j_end; j++) {
+            c[i * c_rs + j * c_cs] = a[i * a_rs + j * a_cs];
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename _Tp>
+void TransposeInPlace(std::size_t n, _Tp* a, std::size_t ld) {
+  constexpr std::size_t w     = Impl::TransposeWidth<_Tp>();
+  constexpr std::size_t block = Impl::CopyBlock<_Tp>();
+
+  const std::size_t full = w > 1 ? n / w * w : 0;
+
+  if constexpr (w > 1) {
+    for (std::size_t i0 = 0; i0 < full; i0 += block) {
+      const std::size_t i_end = std::min(i0 + block, full);
+      for (std::size_t j0 = i0; j0 < full; j0 += block) {
+        const std::size_t j_end = std::min(j0 + block, full);
+        for (std::size_t i = i0; i < i_end; i += w) {
+          for (std::size_t j = j0 == i0 ? i : j0; j < j_end; j += w) {
+            if (i == j) {
+              // All rows are loaded before any is stored.
+              Impl::TransposeBlock(a + i * ld + j, ld, a + i * ld + j, ld);
+            } else {
+              Impl::SwapTransposedBlocks(a + i * ld + j, a + j * ld + i, ld);
+            }
+          }
+        }
+      }
+    }
+  }
+  // Pairs outside the blocked square.
+  for (std::size_t i = 0; i < n; i++) {
+    for (std::size_t j = std::max(i + 1, full); j < n; j++) {
+      const _Tp tmp = a[i * ld + j];
+      a[i * ld + j] = a[j * ld + i];
+      a[j * ld + i] = tmp;
+    }
+  }
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Copy.tpp
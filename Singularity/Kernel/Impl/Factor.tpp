@@ -0,0 +1,571 @@
+#pragma once
+
+#include "../Factor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "../Gemm.hpp"
+#include "../../Config.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+template <typename _Tp>
+constexpr _Tp Abs(_Tp x) {
+  return x < _Tp{} ? -x : x;
+}
+
+// `std::sqrt`, or Newton's iteration from above during constant evaluation.
+template <typename _Tp>
+constexpr _Tp Sqrt(_Tp x) {
+  if (!Config::IsConstantEvaluated()) {
+    return std::sqrt(x);
+  }
+  if (!(x > _Tp{})) {
+    return _Tp{};
+  }
+  _Tp r = x > _Tp(1) ? x : _Tp(1);
+  for (;;) {
+    const _Tp next = (r + x / r) / _Tp(2);
+    if (!(next < r)) {
+      return r;
+    }
+    r = next;
+  }
+}
+
+template <typename _Tp>
+constexpr void SwapRows(std::size_t i,
+                        std::size_t p,
+                        std::size_t j0,
+                        std::size_t j1,
+                        _Tp* a,
+                        std::size_t a_rs,
+                        std::size_t a_cs) {
+  for (std::size_t j = j0; j < j1; j++) {
+    const _Tp t            = a[i * a_rs + j * a_cs];
+    a[i * a_rs + j * a_cs] = a[p * a_rs + j * a_cs];
+    a[p * a_rs + j * a_cs] = t;
+  }
+}
+
+template <typename _Tp>
+constexpr bool LuUnblocked(std::size_t m,
+                           std::size_t n,
+                           _Tp* a,
+                           std::size_t a_rs,
+                           std::size_t a_cs,
+                           std::size_t* pivots) {
+  const auto at = [&](std::size_t i, std::size_t j) -> _Tp& {
+    return a[i * a_rs + j * a_cs];
+  };
+
+  bool regular = true;
+  for (std::size_t k = 0; k < std::min(m, n); k++) {
+    std::size_t p = k;
+    for (std::size_t i = k + 1; i < m; i++) {
+      if (Abs(at(i, k)) > Abs(at(p, k))) {
+        p = i;
+      }
+    }
+    pivots[k] = p;
+    if (at(p, k) == _Tp{}) {
+      regular = false;
+      continue;
+    }
+    if (p != k) {
+      SwapRows(k, p, 0, n, a, a_rs, a_cs);
+    }
+
+    const _Tp pivot = at(k, k);
+    for (std::size_t i = k + 1; i < m; i++) {
+      at(i, k) /= pivot;
+    }
+    // Rank-one update, with the inner loop along the contiguous axis.
+    if (a_cs <= a_rs) {
+      for (std::size_t i = k + 1; i < m; i++) {
+        const _Tp l = at(i, k);
+        for (std::size_t j = k + 1; j < n; j++) {
+          at(i, j) -= l * at(k, j);
+        }
+      }
+    } else {
+      for (std::size_t j = k + 1; j < n; j++) {
+        const _Tp u = at(k, j);
+        for (std::size_t i = k + 1; i < m; i++) {
+          at(i, j) -= at(i, k) * u;
+        }
+      }
+    }
+  }
+  return regular;
+}
+
+template <typename _Tp>
+constexpr bool CholeskyUnblocked(std::size_t n,
+                                 _Tp* a,
+                                 std::size_t a_rs,
+                                 std::size_t a_cs) {
+  const auto at = [&](std::size_t i, std::size_t j) -> _Tp& {
+    return a[i * a_rs + j * a_cs];
+  };
+
+  for (std::size_t k = 0; k < n; k++) {
+    if (!(at(k, k) > _Tp{})) {
+      return false;
+    }
+    const _Tp d = Sqrt(at(k, k));
+    at(k, k)    = d;
+    for (std::size_t i = k + 1; i < n; i++) {
+      at(i, k) /= d;
+    }
+    for (std::size_t j = k + 1; j < n; j++) {
+      const _Tp l = at(j, k);
+      for (std::size_t i = j; i < n; i++) {
+        at(i, j) -= at(i, k) * l;
+      }
+    }
+  }
+  return true;
+}
+
+// Lower triangle of `C -= A * Trp(A)` for the `n` x `n` diagonal block `C`.
+template <typename _Tp>
+constexpr void SymmetricUpdate(std::size_t n,
+                               std::size_t k,
+                               const _Tp* a,
+                               std::size_t a_rs,
+                               std::size_t a_cs,
+                               _Tp* c,
+                               std::size_t c_rs,
+                               std::size_t c_cs) {
+  for (std::size_t i = 0; i < n; i++) {
+    for (std::size_t j = 0; j <= i; j++) {
+      _Tp s{};
+      for (std::size_t p = 0; p < k; p++) {
+        s += a[i * a_rs + p * a_cs] * a[j * a_rs + p * a_cs];
+      }
+      c[i * c_rs + j * c_cs] -= s;
+    }
+  }
+}
+
+template <typename _Tp>
+constexpr void QrUnblocked(std::size_t m,
+                           std::size_t n,
+                           _Tp* a,
+                           std::size_t a_rs,
+                           std::size_t a_cs,
+                           _Tp* tau) {
+  const auto at = [&](std::size_t i, std::size_t j) -> _Tp& {
+    return a[i * a_rs + j * a_cs];
+  };
+
+  for (std::size_t k = 0; k < std::min(m, n); k++) {
+    // Reflector mapping `A(k:m, k)` onto `beta * e_0`.
+    const _Tp alpha = at(k, k);
+    _Tp       norm2{};
+    for (std::size_t i = k + 1; i < m; i++) {
+      norm2 += at(i, k) * at(i, k);
+    }
+    if (norm2 == _Tp{}) {
+      tau[k] = _Tp{};
+      continue;
+    }
+    const _Tp s    = Sqrt(alpha * alpha + norm2);
+    const _Tp beta = alpha < _Tp{} ? s : -s;
+    tau[k]         = (beta - alpha) / beta;
+
+    const _Tp scale = _Tp(1) / (alpha - beta);
+    for (std::size_t i = k + 1; i < m; i++) {
+      at(i, k) *= scale;
+    }
+    at(k, k) = beta;
+
+    for (std::size_t j = k + 1; j < n; j++) {
+      _Tp w = at(k, j);
+      for (std::size_t i = k + 1; i < m; i++) {
+        w += at(i, k) * at(i, j);
+      }
+      w *= tau[k];
+      at(k, j) -= w;
+      for (std::size_t i = k + 1; i < m; i++) {
+        at(i, j) -= w * at(i, k);
+      }
+    }
+  }
+}
+
+template <bool _lower, bool _unit, typename _Tp>
+constexpr void TriangularSolveUnblocked(std::size_t n,
+                                        std::size_t k,
+                                        const _Tp* t,
+                                        std::size_t t_rs,
+                                        std::size_t t_cs,
+                                        _Tp* b,
+                                        std::size_t b_rs,
+                                        std::size_t b_cs) {
+  if (b_rs < b_cs) {
+    // Column-major `B`: solve one contiguous column at a time.
+    for (std::size_t j = 0; j < k; j++) {
+      _Tp* x = b + j * b_cs;
+      for (std::size_t s = 0; s < n; s++) {
+        const std::size_t i  = _lower ? s : n - 1 - s;
+        const std::size_t p0 = _lower ? 0 : i + 1;
+        const std::size_t p1 = _lower ? i : n;
+        _Tp v = x[i * b_rs];
+        for (std::size_t p = p0; p < p1; p++) {
+          v -= t[i * t_rs + p * t_cs] * x[p * b_rs];
+        }
+        if constexpr (!_unit) {
+          v /= t[i * t_rs + i * t_cs];
+        }
+        x[i * b_rs] = v;
+      }
+    }
+    return;
+  }
+  for (std::size_t s = 0; s < n; s++) {
+    const std::size_t i  = _lower ? s : n - 1 - s;
+    const std::size_t p0 = _lower ? 0 : i + 1;
+    const std::size_t p1 = _lower ? i : n;
+    for (std::size_t p = p0; p < p1; p++) {
+      const _Tp l = t[i * t_rs + p * t_cs];
+      for (std::size_t j = 0; j < k; j++) {
+        b[i * b_rs + j * b_cs] -= l * b[p * b_rs + j * b_cs];
+      }
+    }
+    if constexpr (!_unit) {
+      const _Tp d = t[i * t_rs + i * t_cs];
+      for (std::size_t j = 0; j < k; j++) {
+        b[i * b_rs + j * b_cs] /= d;
+      }
+    }
+  }
+}
+
+}  // namespace Impl
+
+template <typename _Tp>
+constexpr bool Lu(std::size_t m,
+                  std::size_t n,
+                  _Tp* a,
+                  std::size_t a_rs,
+                  std::size_t a_cs,
+                  std::size_t* pivots) {
+  constexpr std::size_t nb = FactorBlocking<_Tp>::nb;
+
+  const std::size_t mn = std::min(m, n);
+
+  if (Config::IsConstantEvaluated() ||
+      mn <= FactorBlocking<_Tp>::small_threshold) {
+    return Impl::LuUnblocked(m, n, a, a_rs, a_cs, pivots);
+  }
+
+  const auto at = [&](std::size_t i, std::size_t j) {
+    return a + i * a_rs + j * a_cs;
+  };
+
+  bool regular = true;
+  for (std::size_t j0 = 0; j0 < mn; j0 += nb) {
+    const std::size_t jb = std::min(nb, mn - j0);
+
+    regular = Impl::LuUnblocked(m - j0, jb, at(j0, j0), a_rs, a_cs,
+                                pivots + j0) &&
+              regular;
+
+    for (std::size_t k = j0; k < j0 + jb; k++) {
+      pivots[k] += j0;
+      if (pivots[k] != k) {
+        Impl::SwapRows(k, pivots[k], 0, j0, a, a_rs, a_cs);
+        Impl::SwapRows(k, pivots[k], j0 + jb, n, a, a_rs, a_cs);
+      }
+    }
+    if (j0 + jb == n) {
+      continue;
+    }
+
+    // A12 = L11^-1 * A12, then A22 -= A21 * A12.
+    TriangularSolve<true, true>(jb,
+                                n - j0 - jb,
+                                at(j0, j0),
+                                a_rs,
+                                a_cs,
+                                at(j0, j0 + jb),
+                                a_rs,
+                                a_cs);
+    if (j0 + jb < m) {
+      GemmAccumulate<_Tp>(m - j0 - jb,
+                          n - j0 - jb,
+                          jb,
+                          _Tp(-1),
+                          at(j0 + jb, j0),
+                          a_rs,
+                          a_cs,
+                          at(j0, j0 + jb),
+                          a_rs,
+                          a_cs,
+                          _Tp(1),
+                          at(j0 + jb, j0 + jb),
+                          a_rs,
+                          a_cs);
+    }
+  }
+  return regular;
+}
+
+template <typename _Tp>
+constexpr bool Cholesky(std::size_t n,
+                        _Tp* a,
+                        std::size_t a_rs,
+                        std::size_t a_cs) {
+  constexpr std::size_t nb = FactorBlocking<_Tp>::nb;
+
+  if (Config::IsConstantEvaluated() ||
+      n <= FactorBlocking<_Tp>::small_threshold) {
+    return Impl::CholeskyUnblocked(n, a, a_rs, a_cs);
+  }
+
+  const auto at = [&](std::size_t i, std::size_t j) {
+    return a + i * a_rs + j * a_cs;
+  };
+
+  for (std::size_t j0 = 0; j0 < n; j0 += nb) {
+    const std::size_t jb = std::min(nb, n - j0);
+    const std::size_t r  = n - j0 - jb;
+
+    if (!Impl::CholeskyUnblocked(jb, at(j0, j0), a_rs, a_cs)) {
+      return false;
+    }
+    if (r == 0) {
+      break;
+    }
+
+    // A21 = A21 * L11^-T, solved as L11 * Trp(A21) = Trp(A21).
+    _Tp* a21 = at(j0 + jb, j0);
+    TriangularSolve<true, false>(
+        jb, r, at(j0, j0), a_rs, a_cs, a21, a_cs, a_rs);
+
+    // Lower triangle of A22 -= A21 * Trp(A21), a block column at a time.
+    for (std::size_t c0 = 0; c0 < r; c0 += nb) {
+      const std::size_t cb = std::min(nb, r - c0);
+
+      Impl::SymmetricUpdate(cb,
+                            jb,
+                            a21 + c0 * a_rs,
+                            a_rs,
+                            a_cs,
+                            at(j0 + jb + c0, j0 + jb + c0),
+                            a_rs,
+                            a_cs);
+      if (c0 + cb < r) {
+        GemmAccumulate<_Tp>(r - c0 - cb,
+                            cb,
+                            jb,
+                            _Tp(-1),
+                            a21 + (c0 + cb) * a_rs,
+                            a_rs,
+                            a_cs,
+                            a21 + c0 * a_rs,
+                            a_cs,
+                            a_rs,
+                            _Tp(1),
+                            at(j0 + jb + c0 + cb, j0 + jb + c0),
+                            a_rs,
+                            a_cs);
+      }
+    }
+  }
+  return true;
+}
+
+template <typename _Tp>
+constexpr std::size_t QrWorkspaceSize(std::size_t m, std::size_t n) {
+  constexpr std::size_t nb = FactorBlocking<_Tp>::nb;
+
+  if (std::min(m, n) <= FactorBlocking<_Tp>::small_threshold) {
+    return 0;
+  }
+  return nb * (m + nb + n);
+}
+
+template <typename _Tp>
+constexpr void Qr(std::size_t m,
+                  std::size_t n,
+                  _Tp* a,
+                  std::size_t a_rs,
+                  std::size_t a_cs,
+                  _Tp* tau,
+                  _Tp* work) {
+  constexpr std::size_t nb = FactorBlocking<_Tp>::nb;
+
+  const std::size_t mn = std::min(m, n);
+
+  if (Config::IsConstantEvaluated() || QrWorkspaceSize<_Tp>(m, n) == 0) {
+    Impl::QrUnblocked(m, n, a, a_rs, a_cs, tau);
+    return;
+  }
+
+  const auto at = [&](std::size_t i, std::size_t j) {
+    return a + i * a_rs + j * a_cs;
+  };
+
+  // Column-major `V` (m x nb), upper triangular `T` (nb x nb) and row-major
+  // `W` (nb x n).
+  _Tp* v  = work;
+  _Tp* tt = v + m * nb;
+  _Tp* w  = tt + nb * nb;
+
+  for (std::size_t j0 = 0; j0 < mn; j0 += nb) {
+    const std::size_t jb = std::min(nb, mn - j0);
+    const std::size_t mv = m - j0;
+    const std::size_t n2 = n - j0 - jb;
+
+    Impl::QrUnblocked(mv, jb, at(j0, j0), a_rs, a_cs, tau + j0);
+    if (n2 == 0) {
+      continue;
+    }
+
+    for (std::size_t p = 0; p < jb; p++) {
+      for (std::size_t i = 0; i < mv; i++) {
+        v[i + p * mv] = i < p    ? _Tp{}
+                        : i == p ? _Tp(1)
+                                 : *at(j0 + i, j0 + p);
+      }
+    }
+
+    // H_0 * ... * H_{jb - 1} = I - V * T * Trp(V), built column by column.
+    for (std::size_t p = 0; p < jb; p++) {
+      for (std::size_t q = 0; q < p; q++) {
+        _Tp s{};
+        for (std::size_t i = p; i < mv; i++) {
+          s += v[i + q * mv] * v[i + p * mv];
+        }
+        w[q] = -tau[j0 + p] * s;
+      }
+      for (std::size_t q = 0; q < p; q++) {
+        _Tp s{};
+        for (std::size_t r = q; r < p; r++) {
+          s += tt[q * nb + r] * w[r];
+        }
+        tt[q * nb + p] = s;
+      }
+      tt[p * nb + p] = tau[j0 + p];
+    }
+
+    // A2 -= V * Trp(T) * Trp(V) * A2.
+    Gemm<_Tp>(jb, n2, mv, v, mv, 1, at(j0, j0 + jb), a_rs, a_cs, w, n2, 1);
+    for (std::size_t p = jb; p-- > 0;) {
+      for (std::size_t j = 0; j < n2; j++) {
+        _Tp s{};
+        for (std::size_t q = 0; q <= p; q++) {
+          s += tt[q * nb + p] * w[q * n2 + j];
+        }
+        w[p * n2 + j] = s;
+      }
+    }
+    GemmAccumulate<_Tp>(mv,
+                        n2,
+                        jb,
+                        _Tp(-1),
+                        v,
+                        1,
+                        mv,
+                        w,
+                        n2,
+                        1,
+                        _Tp(1),
+                        at(j0, j0 + jb),
+                        a_rs,
+                        a_cs);
+  }
+}
+
+template <typename _Tp>
+constexpr void ApplyQt(std::size_t m,
+                       std::size_t k,
+                       std::size_t n,
+                       const _Tp* qr,
+                       std::size_t qr_rs,
+                       std::size_t qr_cs,
+                       const _Tp* tau,
+                       _Tp* b,
+                       std::size_t b_rs,
+                       std::size_t b_cs) {
+  for (std::size_t p = 0; p < k; p++) {
+    if (tau[p] == _Tp{}) {
+      continue;
+    }
+    for (std::size_t j = 0; j < n; j++) {
+      _Tp w = b[p * b_rs + j * b_cs];
+      for (std::size_t i = p + 1; i < m; i++) {
+        w += qr[i * qr_rs + p * qr_cs] * b[i * b_rs + j * b_cs];
+      }
+      w *= tau[p];
+      b[p * b_rs + j * b_cs] -= w;
+      for (std::size_t i = p + 1; i < m; i++) {
+        b[i * b_rs + j * b_cs] -= w * qr[i * qr_rs + p * qr_cs];
+      }
+    }
+  }
+}
+
+template <bool _lower, bool _unit, typename _Tp>
+constexpr void TriangularSolve(std::size_t n,
+                               std::size_t k,
+                               const _Tp* t,
+                               std::size_t t_rs,
+                               std::size_t t_cs,
+                               _Tp* b,
+                               std::size_t b_rs,
+                               std::size_t b_cs) {
+  constexpr std::size_t nb = FactorBlocking<_Tp>::nb;
+
+  if (Config::IsConstantEvaluated() ||
+      n <= FactorBlocking<_Tp>::small_threshold) {
+    Impl::TriangularSolveUnblocked<_lower, _unit>(
+        n, k, t, t_rs, t_cs, b, b_rs, b_cs);
+    return;
+  }
+
+  // Solve a block of rows, then remove it from the rows still to solve.
+  for (std::size_t s = 0; s < n; s += nb) {
+    const std::size_t ib = std::min(nb, n - s);
+    const std::size_t i0 = _lower ? s : n - s - ib;
+
+    Impl::TriangularSolveUnblocked<_lower, _unit>(ib,
+                                                  k,
+                                                  t + i0 * t_rs + i0 * t_cs,
+                                                  t_rs,
+                                                  t_cs,
+                                                  b + i0 * b_rs,
+                                                  b_rs,
+                                                  b_cs);
+
+    const std::size_t r0 = _lower ? i0 + ib : 0;
+    const std::size_t rn = _lower ? n - i0 - ib : i0;
+    if (rn != 0) {
+      GemmAccumulate<_Tp>(rn,
+                          k,
+                          ib,
+                          _Tp(-1),
+                          t + r0 * t_rs + i0 * t_cs,
+                          t_rs,
+                          t_cs,
+                          b + i0 * b_rs,
+                          b_rs,
+                          b_cs,
+                          _Tp(1),
+                          b + r0 * b_rs,
+                          b_rs,
+                          b_cs);
+    }
+  }
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Factor.tpp
@@ -0,0 +1,301 @@
+#pragma once
+
+#include "../Gemm.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../../Exec/Executor.hpp"
+#include "../../Memory/Allocator.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+template <typename _Tp, typename _Ta, typename _Tb>
+void GemmDirect(std::size_t m,
+                std::size_t n,
+                std::size_t k,
+                _Tp alpha,
+                const _Ta* a,
+                std::size_t a_rs,
+                std::size_t a_cs,
+                const _Tb* b,
+                std::size_t b_rs,
+                std::size_t b_cs,
+                _Tp beta,
+                _Tp* c,
+                std::size_t c_rs,
+                std::size_t c_cs) {
+  // `beta == 0` overwrites C without reading it.
+  const auto scale = [beta](_Tp& x) {
+    x = beta == _Tp{} ? _Tp{} : beta * x;
+  };
+
+  if (c_cs == 1) {
+    // Row-major output: stream rows of C and rows of B.
+    for (std::size_t i = 0; i < m; i++) {
+      _Tp* c_row = c + i * c_rs;
+      for (std::size_t j = 0; j < n; j++) {
+        scale(c_row[j]);
+      }
+      for (std::size_t p = 0; p < k; p++) {
+        const _Tp  a_ip  = alpha * static_cast<_Tp>(a[i * a_rs + p * a_cs]);
+        const _Tb* b_row = b + p * b_rs;
+        for (std::size_t j = 0; j < n; j++) {
+          c_row[j] += a_ip * static_cast<_Tp>(b_row[j * b_cs]);
+        }
+      }
+    }
+  } else {
+    // Column-major output: stream columns of C and columns of A.
+    for (std::size_t j = 0; j < n; j++) {
+      _Tp* c_col = c + j * c_cs;
+      for (std::size_t i = 0; i < m; i++) {
+        scale(c_col[i * c_rs]);
+      }
+      for (std::size_t p = 0; p < k; p++) {
+        const _Tp  b_pj  = alpha * static_cast<_Tp>(b[p * b_rs + j * b_cs]);
+        const _Ta* a_col = a + p * a_cs;
+        for (std::size_t i = 0; i < m; i++) {
+          c_col[i * c_rs] += static_cast<_Tp>(a_col[i * a_rs]) * b_pj;
+        }
+      }
+    }
+  }
+}
+
+// Packs an `mc × kc` block of A into row panels of height `mr`:
+// panel-major, then `p`, then `i`, converted to `_Tp`. Rows past `mc` are
+// zero padded.
+template <typename _Tp, std::size_t _mr, typename _Ta>
+void PackLhs(std::size_t mc,
+             std::size_t kc,
+             const _Ta* a,
+             std::size_t a_rs,
+             std::size_t a_cs,
+             _Tp* out) {
+  for (std::size_t ir = 0; ir < mc; ir += _mr) {
+    const std::size_t rows = std::min(_mr, mc - ir);
+    for (std::size_t p = 0; p < kc; p++) {
+      for (std::size_t i = 0; i < rows; i++) {
+        out[i] = static_cast<_Tp>(a[(ir + i) * a_rs + p * a_cs]);
+      }
+      for (std::size_t i = rows; i < _mr; i++) {
+        out[i] = _Tp{};
+      }
+      out += _mr;
+    }
+  }
+}
+
+// Packs a `kc × nc` block of B into column panels of width `nr`:
+// panel-major, then `p`, then `j`, converted to `_Tp`. Columns past `nc` are
+// zero padded.
+template <typename _Tp, std::size_t _nr, typename _Tb>
+void PackRhs(std::size_t kc,
+             std::size_t nc,
+             const _Tb* b,
+             std::size_t b_rs,
+             std::size_t b_cs,
+             _Tp* out) {
+  for (std::size_t jr = 0; jr < nc; jr += _nr) {
+    const std::size_t cols = std::min(_nr, nc - jr);
+    for (std::size_t p = 0; p < kc; p++) {
+      for (std::size_t j = 0; j < cols; j++) {
+        out[j] = static_cast<_Tp>(b[p * b_rs + (jr + j) * b_cs]);
+      }
+      for (std::size_t j = cols; j < _nr; j++) {
+        out[j] = _Tp{};
+      }
+      out += _nr;
+    }
+  }
+}
+
+// One rank-1 update of the `mr × nr` register tile, unrolled over all
+// `mr * nr` accumulators.
+template <typename _Tp, std::size_t _nr, std::size_t... _idx>
+inline void MicroKernelStep(_Tp* acc,
+                            const _Tp* a,
+                            const _Tp* b,
+                            std::index_sequence<_idx...>) {
+  ((acc[_idx] += a[_idx / _nr] * b[_idx % _nr]), ...);
+}
+
+// Multiplies one packed `mr × kc` panel by one packed `kc × nr` panel and
+// adds `alpha` times the valid `rows × cols` corner to C, scaled by `beta`
+// on the first `kc` block (`beta == 0` overwrites C). C is read and written
+// in its own element type, rounding once per element.
+template <typename _Tp, std::size_t _mr, std::size_t _nr, typename _Tc>
+void MicroKernel(std::size_t kc,
+                 _Tp alpha,
+                 const _Tp* a,
+                 const _Tp* b,
+                 _Tp beta,
+                 _Tc* c,
+                 std::size_t c_rs,
+                 std::size_t c_cs,
+                 std::size_t rows,
+                 std::size_t cols) {
+  _Tp acc[_mr * _nr] = {};
+
+  for (std::size_t p = 0; p < kc; p++) {
+    MicroKernelStep<_Tp, _nr>(acc, a, b, std::make_index_sequence<_mr * _nr>{});
+    a += _mr;
+    b += _nr;
+  }
+
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      _Tc&      dst = c[i * c_rs + j * c_cs];
+      const _Tp sum = alpha * acc[i * _nr + j];
+      dst = static_cast<_Tc>(
+          beta == _Tp{} ? sum : sum + beta * static_cast<_Tp>(dst));
+    }
+  }
+}
+
+// Packed, blocked product over all of C; the sum for each element of C does
+// not depend on `m`, so any split of the rows gives the same results.
+template <typename _Tp, typename _Ta, typename _Tb, typename _Tc>
+void GemmBlocked(std::size_t m,
+                 std::size_t n,
+                 std::size_t k,
+                 _Tp alpha,
+                 const _Ta* a,
+                 std::size_t a_rs,
+                 std::size_t a_cs,
+                 const _Tb* b,
+                 std::size_t b_rs,
+                 std::size_t b_cs,
+                 _Tp beta,
+                 _Tc* c,
+                 std::size_t c_rs,
+                 std::size_t c_cs) {
+  using blocking = GemmBlocking<_Tp>;
+
+  constexpr std::size_t mr = blocking::mr;
+  constexpr std::size_t nr = blocking::nr;
+
+  const std::size_t mc_max = (std::min(blocking::mc, m) + mr - 1) / mr * mr;
+  const std::size_t kc_max = std::min(blocking::kc, k);
+  const std::size_t nc_max = (std::min(blocking::nc, n) + nr - 1) / nr * nr;
+
+  const Memory::Buffer<_Tp> a_pack(mc_max * kc_max);
+  const Memory::Buffer<_Tp> b_pack(kc_max * nc_max);
+
+  for (std::size_t jc = 0; jc < n; jc += blocking::nc) {
+    const std::size_t nc = std::min(blocking::nc, n - jc);
+
+    for (std::size_t pc = 0; pc < k; pc += blocking::kc) {
+      const std::size_t kc = std::min(blocking::kc, k - pc);
+
+      Impl::PackRhs<_Tp, nr>(
+          kc, nc, b + pc * b_rs + jc * b_cs, b_rs, b_cs, b_pack.Data());
+
+      for (std::size_t ic = 0; ic < m; ic += blocking::mc) {
+        const std::size_t mc = std::min(blocking::mc, m - ic);
+
+        Impl::PackLhs<_Tp, mr>(
+            mc, kc, a + ic * a_rs + pc * a_cs, a_rs, a_cs, a_pack.Data());
+
+        for (std::size_t jr = 0; jr < nc; jr += nr) {
+          for (std::size_t ir = 0; ir < mc; ir += mr) {
+            Impl::MicroKernel<_Tp, mr, nr>(
+                kc,
+                alpha,
+                a_pack.Data() + ir * kc,
+                b_pack.Data() + jr * kc,
+                pc == 0 ? beta : _Tp{1},
+                c + (ic + ir) * c_rs + (jc + jr) * c_cs,
+                c_rs,
+                c_cs,
+                std::min(mr, mc - ir),
+                std::min(nr, nc - jr));
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace Impl
+
+template <typename _Tp>
+void Gemm(std::size_t m,
+          std::size_t n,
+          std::size_t k,
+          const _Tp* a,
+          std::size_t a_rs,
+          std::size_t a_cs,
+          const _Tp* b,
+          std::size_t b_rs,
+          std::size_t b_cs,
+          _Tp* c,
+          std::size_t c_rs,
+          std::size_t c_cs) {
+  GemmAccumulate(
+      m, n, k, _Tp{1}, a, a_rs, a_cs, b, b_rs, b_cs, _Tp{}, c, c_rs, c_cs);
+}
+
+template <typename _Tp, typename _Ta, typename _Tb, typename _Tc>
+void GemmAccumulate(std::size_t m,
+                    std::size_t n,
+                    std::size_t k,
+                    _Tp alpha,
+                    const _Ta* a,
+                    std::size_t a_rs,
+                    std::size_t a_cs,
+                    const _Tb* b,
+                    std::size_t b_rs,
+                    std::size_t b_cs,
+                    _Tp beta,
+                    _Tc* c,
+                    std::size_t c_rs,
+                    std::size_t c_cs) {
+  using blocking = GemmBlocking<_Tp>;
+
+  if constexpr (std::is_same_v<_Tc, _Tp>) {
+    // The direct loop accumulates in C, so it needs C to be of type `_Tp`.
+    if (m * n * k < blocking::small_threshold) {
+      Impl::GemmDirect(
+          m, n, k, alpha, a, a_rs, a_cs, b, b_rs, b_cs, beta, c, c_rs, c_cs);
+      return;
+    }
+  }
+
+  // Independent panels of `mc`-aligned rows of C.
+  const std::size_t panel = Exec::PanelSize(m, n * k, blocking::mc);
+  const std::size_t tasks = (m + panel - 1) / panel;
+
+  if (!Exec::IsParallel(m * n * k, tasks)) {
+    Impl::GemmBlocked(
+        m, n, k, alpha, a, a_rs, a_cs, b, b_rs, b_cs, beta, c, c_rs, c_cs);
+    return;
+  }
+
+  Exec::ParallelFor(m * n * k, tasks, [&](std::size_t t) {
+    const std::size_t ic = t * panel;
+    Impl::GemmBlocked(std::min(panel, m - ic),
+                      n,
+                      k,
+                      alpha,
+                      a + ic * a_rs,
+                      a_rs,
+                      a_cs,
+                      b,
+                      b_rs,
+                      b_cs,
+                      beta,
+                      c + ic * c_rs,
+                      c_rs,
+                      c_cs);
+  });
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Gemm.tpp
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "../Reduce.hpp"
+
+#include <cstddef>
+
+#include "../Unroll.hpp"
+#include "../../Simd/Packet.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+// Longest run folded sequentially before splitting in halves.
+constexpr inline std::size_t reduce_block = 128;
+
+// Folds `[begin, end)` pairwise, calling `leaf(begin, end)` on runs of at most
+// `block` indices. Split points stay a multiple of `align` past `begin`.
+template <typename _leaf, typename _combine>
+constexpr auto Pairwise(std::size_t begin,
+                        std::size_t end,
+                        std::size_t block,
+                        std::size_t align,
+                        _leaf& leaf,
+                        _combine& combine) {
+  if (end - begin <= block) {
+    return leaf(begin, end);
+  }
+  const std::size_t mid = begin + (end - begin) / 2 / align * align;
+  auto lhs = Pairwise(begin, mid, block, align, leaf, combine);
+  return combine(lhs, Pairwise(mid, end, block, align, leaf, combine));
+}
+
+template <Core::Major _major, typename _at>
+constexpr auto At(_at& at, std::size_t outer, std::size_t inner) {
+  if constexpr (_major == Core::Major::Row) {
+    return at(outer, inner);
+  } else {
+    return at(inner, outer);
+  }
+}
+
+}  // namespace Impl
+
+template <Core::Major _major, typename _at, typename _combine>
+constexpr auto Reduce(std::size_t rows,
+                      std::size_t cols,
+                      _at&& at,
+                      _combine&& combine) {
+  const bool row_lines     = _major == Core::Major::Row;
+  const std::size_t outer  = row_lines ? rows : cols;
+  const std::size_t inner  = row_lines ? cols : rows;
+  std::size_t current_line = 0;
+
+  auto run = [&](std::size_t begin, std::size_t end) {
+    auto acc = Impl::At<_major>(at, current_line, begin);
+    for (std::size_t k = begin + 1; k < end; k++) {
+      acc = combine(acc, Impl::At<_major>(at, current_line, k));
+    }
+    return acc;
+  };
+  auto line = [&](std::size_t begin, std::size_t) {
+    current_line = begin;
+    return Impl::Pairwise(0, inner, Impl::reduce_block, 1, run, combine);
+  };
+  return Impl::Pairwise(0, outer, 1, 1, line, combine);
+}
+
+template <Core::Major _major,
+          typename _Tp,
+          typename _at,
+          typename _packet_at,
+          typename _combine>
+_Tp ReducePacket(std::size_t rows,
+                 std::size_t cols,
+                 _at&& at,
+                 _packet_at&& packet_at,
+                 _combine&& combine) {
+  using packet_type = Simd::Packet<_Tp>;
+
+  constexpr std::size_t width = packet_type::size;
+  constexpr std::size_t accs  = 4;
+
+  const bool row_lines     = _major == Core::Major::Row;
+  const std::size_t outer  = row_lines ? rows : cols;
+  const std::size_t inner  = row_lines ? cols : rows;
+  std::size_t current_line = 0;
+
+  auto run = [&](std::size_t begin, std::size_t end) -> _Tp {
+    const std::size_t packet_end = begin + (end - begin) / width * width;
+    std::size_t k                = begin;
+    _Tp acc;
+
+    if (packet_end == begin) {
+      acc = Impl::At<_major>(at, current_line, k++);
+    } else {
+      packet_type p;
+      if (packet_end - begin >= accs * width) {
+        packet_type part[accs];
+        Unroll<accs>([&](auto t) {
+          part[t] = Impl::At<_major>(packet_at, current_line, k + t * width);
+        });
+        for (k += accs * width; k + accs * width <= packet_end;
+             k += accs * width) {
+          Unroll<accs>([&](auto t) {
+            part[t] = combine(
+                part[t],
+                Impl::At<_major>(packet_at, current_line, k + t * width));
+          });
+        }
+        p = combine(combine(part[0], part[1]), combine(part[2], part[3]));
+      } else {
+        p = Impl::At<_major>(packet_at, current_line, k);
+        k += width;
+      }
+      for (; k < packet_end; k += width) {
+        p = combine(p, Impl::At<_major>(packet_at, current_line, k));
+      }
+
+      _Tp lanes[width];
+      p.Store(lanes);
+      for (std::size_t half = width / 2; half > 0; half /= 2) {
+        for (std::size_t l = 0; l < half; l++) {
+          lanes[l] = combine(lanes[l], lanes[l + half]);
+        }
+      }
+      acc = lanes[0];
+    }
+
+    for (; k < end; k++) {
+      acc = combine(acc, Impl::At<_major>(at, current_line, k));
+    }
+    return acc;
+  };
+  auto line = [&](std::size_t begin, std::size_t) {
+    current_line = begin;
+    return Impl::Pairwise(0, inner, Impl::reduce_block, width, run, combine);
+  };
+  return Impl::Pairwise(0, outer, 1, 1, line, combine);
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Reduce.tpp
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "../Sparse.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "../../Memory/Allocator.hpp"
+
+namespace Sglty::Kernel {
+
+template <typename _Ta, typename _Tb, typename _Tc>
+void SparseDense(std::size_t m,
+                 std::size_t n,
+                 std::size_t a_outer_size,
+                 bool a_compressed_rows,
+                 const std::size_t* a_outer,
+                 const std::size_t* a_inner,
+                 const _Ta* a_values,
+                 const _Tb* b,
+                 std::size_t b_rs,
+                 std::size_t b_cs,
+                 _Tc* c,
+                 std::size_t c_rs,
+                 std::size_t c_cs) {
+  for (std::size_t i = 0; i < m; i++) {
+    for (std::size_t j = 0; j < n; j++) {
+      c[i * c_rs + j * c_cs] = _Tc{};
+    }
+  }
+
+  // Every entry (i, p) of A adds a scaled row p of B to row i of C.
+  for (std::size_t o = 0; o < a_outer_size; o++) {
+    for (std::size_t q = a_outer[o]; q < a_outer[o + 1]; q++) {
+      const std::size_t i = a_compressed_rows ? o : a_inner[q];
+      const std::size_t p = a_compressed_rows ? a_inner[q] : o;
+
+      const _Ta  a_ip  = a_values[q];
+      const _Tb* b_row = b + p * b_rs;
+      _Tc*       c_row = c + i * c_rs;
+      for (std::size_t j = 0; j < n; j++) {
+        c_row[j * c_cs] += a_ip * b_row[j * b_cs];
+      }
+    }
+  }
+}
+
+template <typename _Ta, typename _Tb, typename _Tc>
+void DenseSparse(std::size_t m,
+                 std::size_t n,
+                 const _Ta* a,
+                 std::size_t a_rs,
+                 std::size_t a_cs,
+                 std::size_t b_outer_size,
+                 bool b_compressed_rows,
+                 const std::size_t* b_outer,
+                 const std::size_t* b_inner,
+                 const _Tb* b_values,
+                 _Tc* c,
+                 std::size_t c_rs,
+                 std::size_t c_cs) {
+  SparseDense(n,
+              m,
+              b_outer_size,
+              !b_compressed_rows,
+              b_outer,
+              b_inner,
+              b_values,
+              a,
+              a_cs,
+              a_rs,
+              c,
+              c_cs,
+              c_rs);
+}
+
+template <typename _Ta, typename _Tb, typename _Tc>
+void SparseSparse(std::size_t outer_size,
+                  std::size_t inner_size,
+                  const std::size_t* a_outer,
+                  const std::size_t* a_inner,
+                  const _Ta* a_values,
+                  const std::size_t* b_outer,
+                  const std::size_t* b_inner,
+                  const _Tb* b_values,
+                  std::size_t* c_outer,
+                  std::size_t* c_inner,
+                  _Tc* c_values,
+                  std::size_t c_capacity) {
+  std::vector<_Tc, Memory::Allocator<_Tc>>                 acc(inner_size);
+  std::vector<bool, Memory::Allocator<bool>>               touched(inner_size);
+  std::vector<std::size_t, Memory::Allocator<std::size_t>> pattern;
+  pattern.reserve(inner_size);
+
+  std::size_t nnz = 0;
+  c_outer[0]      = 0;
+  for (std::size_t o = 0; o < outer_size; o++) {
+    pattern.clear();
+    for (std::size_t q = a_outer[o]; q < a_outer[o + 1]; q++) {
+      const std::size_t p    = a_inner[q];
+      const _Ta         a_op = a_values[q];
+      for (std::size_t r = b_outer[p]; r < b_outer[p + 1]; r++) {
+        const std::size_t j = b_inner[r];
+        if (!touched[j]) {
+          touched[j] = true;
+          acc[j]     = _Tc{};
+          pattern.push_back(j);
+        }
+        acc[j] += a_op * b_values[r];
+      }
+    }
+
+    std::sort(pattern.begin(), pattern.end());
+    for (const std::size_t j : pattern) {
+      touched[j] = false;
+      if (acc[j] == _Tc{}) {
+        continue;
+      }
+      if (nnz == c_capacity) {
+        throw std::length_error("Error: sparse core capacity exceeded.");
+      }
+      c_inner[nnz]  = j;
+      c_values[nnz] = acc[j];
+      nnz++;
+    }
+    c_outer[o + 1] = nnz;
+  }
+}
+
+template <typename _Ta, typename _Tb, typename _Tc, typename _Func>
+void SparseMerge(std::size_t outer_size,
+                 const std::size_t* a_outer,
+                 const std::size_t* a_inner,
+                 const _Ta* a_values,
+                 const std::size_t* b_outer,
+                 const std::size_t* b_inner,
+                 const _Tb* b_values,
+                 std::size_t* c_outer,
+                 std::size_t* c_inner,
+                 _Tc* c_values,
+                 std::size_t c_capacity,
+                 _Func&& fn) {
+  std::size_t nnz = 0;
+  c_outer[0]      = 0;
+  for (std::size_t o = 0; o < outer_size; o++) {
+    std::size_t p = a_outer[o];
+    std::size_t q = b_outer[o];
+    while (p < a_outer[o + 1] || q < b_outer[o + 1]) {
+      std::size_t j;
+      _Tc         value;
+      if (q == b_outer[o + 1] ||
+          (p < a_outer[o + 1] && a_inner[p] < b_inner[q])) {
+        j     = a_inner[p];
+        value = fn(a_values[p++], _Tb{});
+      } else if (p == a_outer[o + 1] || b_inner[q] < a_inner[p]) {
+        j     = b_inner[q];
+        value = fn(_Ta{}, b_values[q++]);
+      } else {
+        j     = a_inner[p];
+        value = fn(a_values[p++], b_values[q++]);
+      }
+
+      if (value == _Tc{}) {
+        continue;
+      }
+      if (nnz == c_capacity) {
+        throw std::length_error("Error: sparse core capacity exceeded.");
+      }
+      c_inner[nnz]  = j;
+      c_values[nnz] = value;
+      nnz++;
+    }
+    c_outer[o + 1] = nnz;
+  }
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Sparse.tpp
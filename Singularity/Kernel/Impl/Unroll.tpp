@@ -0,0 +1,38 @@
+#pragma once
+
+#include "../Unroll.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+template <typename _fn, std::size_t... _idx>
+constexpr void Unroll(_fn& fn, std::index_sequence<_idx...>) {
+  (fn(std::integral_constant<std::size_t, _idx>{}), ...);
+}
+
+template <typename _fn, std::size_t... _idx>
+constexpr bool UnrollAll(_fn& fn, std::index_sequence<_idx...>) {
+  return (static_cast<bool>(fn(std::integral_constant<std::size_t, _idx>{})) &&
+          ...);
+}
+
+}  // namespace Impl
+
+template <std::size_t _n, typename _fn>
+constexpr void Unroll(_fn&& fn) {
+  Impl::Unroll(fn, std::make_index_sequence<_n>{});
+}
+
+template <std::size_t _n, typename _fn>
+constexpr bool UnrollAll(_fn&& fn) {
+  return Impl::UnrollAll(fn, std::make_index_sequence<_n>{});
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Unroll.tpp
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Core/Enums.hpp"
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Folds `at(i, j)` over a `rows` x `cols` range with `combine`.
+ *
+ * The range is split into lines along `_major` (rows for `Major::Row`,
+ * columns otherwise), so consecutive elements are read in storage order.
+ * Lines, and runs of more than 128 elements within a line, are combined
+ * pairwise: for floating-point sums the rounding error grows with the
+ * logarithm of the element count instead of linearly.
+ *
+ * Usable in constant expressions. `rows` and `cols` must be positive.
+ *
+ * @tparam _major   The storage order to follow.
+ * @tparam _at      Callable returning the value at `(i, j)`.
+ * @tparam _combine Associative binary callable on values.
+ * @param rows    The number of rows.
+ * @param cols    The number of columns.
+ * @param at      The element accessor.
+ * @param combine The fold operation.
+ * @return The folded value.
+ */
+template <Core::Major _major, typename _at, typename _combine>
+constexpr auto Reduce(std::size_t rows,
+                      std::size_t cols,
+                      _at&& at,
+                      _combine&& combine);
+
+/**
+ * @brief SIMD counterpart of `Reduce` for vectorizable `_Tp`.
+ *
+ * Within each run, `packet_at(i, j)` loads `Simd::Packet<_Tp>::size`
+ * consecutive elements along `_major` and four independent packet
+ * accumulators are folded with `combine` before being reduced across lanes;
+ * the tail of each line goes through `at`. `combine` must accept both `_Tp`
+ * and `Simd::Packet<_Tp>` arguments.
+ *
+ * Not usable in constant expressions. `rows` and `cols` must be positive.
+ *
+ * @tparam _major     The storage order to follow.
+ * @tparam _Tp        The scalar value type.
+ * @tparam _at        Callable returning the value at `(i, j)`.
+ * @tparam _packet_at Callable returning the packet starting at `(i, j)`.
+ * @tparam _combine   Associative binary callable on values and packets.
+ * @param rows      The number of rows.
+ * @param cols      The number of columns.
+ * @param at        The element accessor.
+ * @param packet_at The packet accessor.
+ * @param combine   The fold operation.
+ * @return The folded value.
+ */
+template <Core::Major _major,
+          typename _Tp,
+          typename _at,
+          typename _packet_at,
+          typename _combine>
+_Tp ReducePacket(std::size_t rows,
+                 std::size_t cols,
+                 _at&& at,
+                 _packet_at&& packet_at,
+                 _combine&& combine);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Reduce.tpp"
+
+// Singularity/Kernel/Reduce.hpp
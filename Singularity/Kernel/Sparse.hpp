@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Computes `C = A * B` for a compressed sparse `A` and strided dense
+ * `B` and `C`.
+ *
+ * `A` is given by its compressed buffers (see `Sglty::Core::Sparse`): entry
+ * `p` of outer index `o` is at position `(o, a_inner[p])` of `A` when
+ * `a_compressed_rows` is set (CSR), and at `(a_inner[p], o)` otherwise
+ * (CSC). Dense elements use the same strides as `Sglty::Kernel::Gemm`.
+ *
+ * Work is proportional to `nnz(A) * n` instead of `m * n * k`.
+ *
+ * `C` is overwritten and must not overlap `B`.
+ *
+ * @param m Rows of `A` and `C`.
+ * @param n Columns of `B` and `C`.
+ * @param a_outer_size Rows (CSR) or columns (CSC) of `A`.
+ * @param a_compressed_rows Whether `A` is stored as CSR.
+ * @param a_outer Offsets of each outer index of `A`.
+ * @param a_inner Inner index of each entry of `A`.
+ * @param a_values Value of each entry of `A`.
+ * @param b Pointer to `B`.
+ * @param b_rs Row stride of `B`.
+ * @param b_cs Column stride of `B`.
+ * @param c Pointer to `C`.
+ * @param c_rs Row stride of `C`.
+ * @param c_cs Column stride of `C`.
+ */
+template <typename _Ta, typename _Tb, typename _Tc>
+void SparseDense(std::size_t m,
+                 std::size_t n,
+                 std::size_t a_outer_size,
+                 bool a_compressed_rows,
+                 const std::size_t* a_outer,
+                 const std::size_t* a_inner,
+                 const _Ta* a_values,
+                 const _Tb* b,
+                 std::size_t b_rs,
+                 std::size_t b_cs,
+                 _Tc* c,
+                 std::size_t c_rs,
+                 std::size_t c_cs);
+
+/**
+ * @brief Computes `C = A * B` for a strided dense `A` and compressed sparse
+ * `B`.
+ *
+ * Evaluated as `C^T = B^T * A^T` through `SparseDense`: the compressed
+ * buffers of `B` describe `B^T` with the other compressed axis, and the
+ * dense transposes are obtained by swapping strides.
+ *
+ * `C` is overwritten and must not overlap `A`.
+ *
+ * @param m Rows of `A` and `C`.
+ * @param n Columns of `B` and `C`.
+ * @param a Pointer to `A`.
+ * @param a_rs Row stride of `A`.
+ * @param a_cs Column stride of `A`.
+ * @param b_outer_size Rows (CSR) or columns (CSC) of `B`.
+ * @param b_compressed_rows Whether `B` is stored as CSR.
+ * @param b_outer Offsets of each outer index of `B`.
+ * @param b_inner Inner index of each entry of `B`.
+ * @param b_values Value of each entry of `B`.
+ * @param c Pointer to `C`.
+ * @param c_rs Row stride of `C`.
+ * @param c_cs Column stride of `C`.
+ */
+template <typename _Ta, typename _Tb, typename _Tc>
+void DenseSparse(std::size_t m,
+                 std::size_t n,
+                 const _Ta* a,
+                 std::size_t a_rs,
+                 std::size_t a_cs,
+                 std::size_t b_outer_size,
+                 bool b_compressed_rows,
+                 const std::size_t* b_outer,
+                 const std::size_t* b_inner,
+                 const _Tb* b_values,
+                 _Tc* c,
+                 std::size_t c_rs,
+                 std::size_t c_cs);
+
+/**
+ * @brief Computes `C = A * B` for compressed sparse `A`, `B` and `C` sharing
+ * the same compressed axis.
+ *
+ * Written in CSR terms: outer index `o` of `C` accumulates row `p` of `B`
+ * scaled by every entry `(o, p)` of `A` (Gustavson's algorithm), using a
+ * dense accumulator of `inner_size` elements. For CSC operands the same
+ * kernel computes `C^T = B^T * A^T` when called with `A` and `B` swapped.
+ *
+ * Entries of `C` are sorted by inner index; results that cancel to zero are
+ * not stored. Throws `std::length_error` if `C` would need more than
+ * `c_capacity` entries.
+ *
+ * `C` must not overlap `A` or `B`.
+ *
+ * @param outer_size Outer size of `A` and `C`.
+ * @param inner_size Inner size of `B` and `C`.
+ * @param a_outer Offsets of each outer index of `A`.
+ * @param a_inner Inner index of each entry of `A`.
+ * @param a_values Value of each entry of `A`.
+ * @param b_outer Offsets of each outer index of `B`.
+ * @param b_inner Inner index of each entry of `B`.
+ * @param b_values Value of each entry of `B`.
+ * @param c_outer Offsets of each outer index of `C` (written).
+ * @param c_inner Inner index of each entry of `C` (written).
+ * @param c_values Value of each entry of `C` (written).
+ * @param c_capacity Maximum number of entries `C` can hold.
+ */
+template <typename _Ta, typename _Tb, typename _Tc>
+void SparseSparse(std::size_t outer_size,
+                  std::size_t inner_size,
+                  const std::size_t* a_outer,
+                  const std::size_t* a_inner,
+                  const _Ta* a_values,
+                  const std::size_t* b_outer,
+                  const std::size_t* b_inner,
+                  const _Tb* b_values,
+                  std::size_t* c_outer,
+                  std::size_t* c_inner,
+                  _Tc* c_values,
+                  std::size_t c_capacity);
+
+/**
+ * @brief Computes `C = fn(A, B)` element-wise for compressed sparse `A`, `B`
+ * and `C` sharing the same shape and compressed axis.
+ *
+ * Merges the sorted entries of each outer index, so work is proportional to
+ * `nnz(A) + nnz(B)`. `fn(a, b)` is called with a value-initialized argument
+ * where only one operand stores an entry, and must map two zeros to zero
+ * (e.g. addition or subtraction). Results equal to zero are not stored.
+ * Throws `std::length_error` if `C` would need more than `c_capacity`
+ * entries.
+ *
+ * `C` must not overlap `A` or `B`.
+ *
+ * @param outer_size Outer size of all three matrices.
+ * @param a_outer Offsets of each outer index of `A`.
+ * @param a_inner Inner index of each entry of `A`.
+ * @param a_values Value of each entry of `A`.
+ * @param b_outer Offsets of each outer index of `B`.
+ * @param b_inner Inner index of each entry of `B`.
+ * @param b_values Value of each entry of `B`.
+ * @param c_outer Offsets of each outer index of `C` (written).
+ * @param c_inner Inner index of each entry of `C` (written).
+ * @param c_values Value of each entry of `C` (written).
+ * @param c_capacity Maximum number of entries `C` can hold.
+ * @param fn The element-wise operation.
+ */
+template <typename _Ta, typename _Tb, typename _Tc, typename _Func>
+void SparseMerge(std::size_t outer_size,
+                 const std::size_t* a_outer,
+                 const std::size_t* a_inner,
+                 const _Ta* a_values,
+                 const std::size_t* b_outer,
+                 const std::size_t* b_inner,
+                 const _Tb* b_values,
+                 std::size_t* c_outer,
+                 std::size_t* c_inner,
+                 _Tc* c_values,
+                 std::size_t c_capacity,
+                 _Func&& fn);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Sparse.tpp"
+
+// Singularity/Kernel/Sparse.hpp
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Calls `fn(k)` for every `k` in `[0, _n)`, fully unrolled at compile
+ * time.
+ *
+ * Expands to a fold expression over `std::make_index_sequence<_n>`, so the
+ * calls are emitted in order without a loop counter or branch. `k` is passed
+ * as a `std::integral_constant<std::size_t, k>`, which converts to
+ * `std::size_t` and can also be used as a template argument.
+ *
+ * Meant for the tiny fixed extents selected by
+ * `Sglty::Traits::Size::is_unrolled_v`.
+ *
+ * @tparam _n  The number of calls.
+ * @tparam _fn The callable type.
+ * @param fn The function to call.
+ */
+template <std::size_t _n, typename _fn>
+constexpr void Unroll(_fn&& fn);
+
+/**
+ * @brief Checks `fn(k)` for every `k` in `[0, _n)`, fully unrolled and
+ * stopping at the first `false`.
+ *
+ * @tparam _n  The number of checks.
+ * @tparam _fn The predicate type.
+ * @param fn The predicate to evaluate.
+ * @return `true` if every call returned `true`.
+ */
+template <std::size_t _n, typename _fn>
+constexpr bool UnrollAll(_fn&& fn);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Unroll.tpp"
+
+// Singularity/Kernel/Unroll.hpp
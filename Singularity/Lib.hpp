@@ -1,18 +1,51 @@
 #pragma once
 
 #include "Types/Matrix.hpp"
+#include "Types/Batch.hpp"
 
 #include "Core/Enums.hpp"
+#include "Core/Banded.hpp"
 #include "Core/Dense.hpp"
+#include "Core/DenseAligned.hpp"
+#include "Core/DenseHeap.hpp"
+#include "Core/Dynamic.hpp"
+#include "Core/Half.hpp"
+#include "Core/Identity.hpp"
+#include "Core/Map.hpp"
+#include "Core/MapStrided.hpp"
+#include "Core/Sparse.hpp"
+#include "Core/Symmetric.hpp"
 
+#include "Op/Alg/Cast.hpp"
+#include "Op/Alg/Factor.hpp"
 #include "Op/Alg/Trp.hpp"
 #include "Op/Arthm/Add.hpp"
 #include "Op/Arthm/Mul.hpp"
 #include "Op/Arthm/Neg.hpp"
 #include "Op/Arthm/Sub.hpp"
 #include "Op/Cmp/Eql.hpp"
+#include "Op/Red/Reduce.hpp"
 
+#include "Expr/Assign.hpp"
+#include "Expr/Broadcast.hpp"
+#include "Expr/Constant.hpp"
 #include "Expr/Evaluate.hpp"
+#include "Expr/Materialized.hpp"
+#include "Expr/NoAlias.hpp"
+
+#include "Exec/Executor.hpp"
+#include "Exec/ThreadPool.hpp"
+
+#include "Memory/Allocator.hpp"
+#include "Memory/Workspace.hpp"
+
+#include "IO/Binary.hpp"
+#include "IO/Text.hpp"
+
+#include "Trace/Tracer.hpp"
+
+#include "Simd/Lanes.hpp"
+#include "Simd/Packet.hpp"
 
 #include "Traits/Size.hpp"
 #include "Traits/Type.hpp"
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "Workspace.hpp"
+#include "../Core/Enums.hpp"
+
+namespace Sglty::Core {
+
+template <typename, std::size_t, std::size_t, Core::Major, typename>
+class DenseHeap;
+
+template <typename, Core::Major, typename>
+class Dynamic;
+
+}  // namespace Sglty::Core
+
+namespace Sglty::Memory {
+
+/**
+ * @brief Standard allocator drawing from a `Workspace`.
+ *
+ * A default-constructed allocator binds to the workspace installed on the
+ * calling thread (see `GetWorkspace()`), and allocates from the heap when
+ * there is none. Copies and rebinds keep the workspace, so elements of a
+ * `Core::DenseHeap` or `Core::Dynamic` using this allocator, and of their
+ * `Cast()`, `Reorder()` and `Expr::Evaluate()` results, come from the
+ * workspace installed when they were created. Such matrices must not outlive
+ * the `Scope` they were allocated in.
+ *
+ * Example Usage:
+ * ```
+ * using Scratch = Sglty::DynamicMat<float,
+ *                                   Sglty::Core::Major::Row,
+ *                                   Sglty::Memory::Allocator<float>>;
+ *
+ * Sglty::Memory::UseWorkspace use(ws);
+ * Scratch t(rows, cols);  // no `operator new` once `ws` is large enough
+ * ```
+ *
+ * @tparam _Tp The element type.
+ */
+template <typename _Tp>
+class Allocator {
+ public:
+  using value_type = _Tp;
+
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap            = std::true_type;
+
+  /**
+   * @brief Binds to the workspace installed on the calling thread.
+   */
+  Allocator() noexcept;
+
+  /**
+   * @brief Binds to `_workspace`, or to the heap if it is `nullptr`.
+   *
+   * @param _workspace The workspace to allocate from.
+   */
+  explicit Allocator(Workspace* _workspace) noexcept;
+
+  /**
+   * @brief Binds to the workspace of `_other`.
+   *
+   * @param _other The allocator to rebind.
+   */
+  template <typename _Up>
+  Allocator(const Allocator<_Up>& _other) noexcept;
+
+  /**
+   * @brief Allocates storage for `_n` elements.
+   *
+   * @param _n The number of elements.
+   * @return Uninitialized storage aligned to at least `Workspace::alignment`
+   * when drawn from a workspace.
+   */
+  _Tp* allocate(std::size_t _n);
+
+  /**
+   * @brief Gives back storage obtained from `allocate(_n)`.
+   *
+   * @param _p The storage.
+   * @param _n The number of elements it was allocated for.
+   */
+  void deallocate(_Tp* _p, std::size_t _n);
+
+  /**
+   * @brief Returns the workspace allocated from, or `nullptr` for the heap.
+   */
+  Workspace* GetWorkspace() const noexcept;
+
+ private:
+  static constexpr std::size_t _m_align = alignof(_Tp) > Workspace::alignment
+                                              ? alignof(_Tp)
+                                              : Workspace::alignment;
+
+  Workspace* _m_workspace;
+};
+
+/**
+ * @brief Checks whether two allocators draw from the same workspace.
+ */
+template <typename _Tp, typename _Up>
+bool operator==(const Allocator<_Tp>& _lhs, const Allocator<_Up>& _rhs);
+
+template <typename _Tp, typename _Up>
+bool operator!=(const Allocator<_Tp>& _lhs, const Allocator<_Up>& _rhs);
+
+/**
+ * @brief Fixed-size array of trivial elements allocated through `Allocator`.
+ *
+ * Used for scratch buffers of kernels, e.g. the packing buffers of
+ * `Sglty::Kernel::GemmAccumulate`. Elements are left uninitialized.
+ *
+ * @tparam _Tp The element type.
+ */
+template <typename _Tp>
+class Buffer {
+  static_assert(std::is_trivially_default_constructible_v<_Tp> &&
+                    std::is_trivially_destructible_v<_Tp>,
+                "Error: `_Tp` must be a trivial type.");
+
+ public:
+  /**
+   * @brief Allocates `_size` elements from the current workspace.
+   *
+   * @param _size The number of elements.
+   */
+  explicit Buffer(std::size_t _size);
+
+  Buffer(const Buffer&)            = delete;
+  Buffer& operator=(const Buffer&) = delete;
+
+  ~Buffer();
+
+  /**
+   * @brief Returns a pointer to the first element.
+   */
+  _Tp* Data() const;
+
+ private:
+  Allocator<_Tp> _m_alloc;
+  std::size_t _m_size;
+  _Tp* _m_data;
+};
+
+namespace Impl {
+
+template <typename _core_impl>
+struct Scratch {
+  using type = _core_impl;
+};
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major>
+struct Scratch<
+    Core::DenseHeap<_Tp, _rows, _cols, _core_major, std::allocator<_Tp>>> {
+  using type = Core::DenseHeap<_Tp, _rows, _cols, _core_major, Allocator<_Tp>>;
+};
+
+template <typename _Tp, Core::Major _core_major>
+struct Scratch<Core::Dynamic<_Tp, _core_major, std::allocator<_Tp>>> {
+  using type = Core::Dynamic<_Tp, _core_major, Allocator<_Tp>>;
+};
+
+}  // namespace Impl
+
+/**
+ * @brief The core temporaries of `_core_impl` are evaluated into.
+ *
+ * Heap-backed cores using `std::allocator` are rebound to `Memory::Allocator`,
+ * so their temporaries come from the current workspace; every other core is
+ * kept as is.
+ *
+ * @tparam _core_impl An owning core implementation.
+ */
+template <typename _core_impl>
+using scratch_t = typename Impl::Scratch<_core_impl>::type;
+
+}  // namespace Sglty::Memory
+
+#include "Impl/Allocator.tpp"
+
+// Singularity/Memory/Allocator.hpp
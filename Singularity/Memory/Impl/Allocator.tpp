@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../Allocator.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+
+namespace Sglty::Memory {
+
+template <typename _Tp>
+Allocator<_Tp>::Allocator() noexcept
+    : _m_workspace(Memory::GetWorkspace()) {}
+
+template <typename _Tp>
+Allocator<_Tp>::Allocator(Workspace* _workspace) noexcept
+    : _m_workspace(_workspace) {}
+
+template <typename _Tp>
+template <typename _Up>
+Allocator<_Tp>::Allocator(const Allocator<_Up>& _other) noexcept
+    : _m_workspace(_other.GetWorkspace()) {}
+
+template <typename _Tp>
+_Tp* Allocator<_Tp>::allocate(std::size_t _n) {
+  if (_m_workspace == nullptr) {
+    return std::allocator<_Tp>().allocate(_n);
+  }
+  if (_n > std::numeric_limits<std::size_t>::max() / sizeof(_Tp)) {
+    throw std::bad_array_new_length();
+  }
+  return static_cast<_Tp*>(_m_workspace->Allocate(_n * sizeof(_Tp), _m_align));
+}
+
+template <typename _Tp>
+void Allocator<_Tp>::deallocate(_Tp* _p, std::size_t _n) {
+  if (_m_workspace == nullptr) {
+    std::allocator<_Tp>().deallocate(_p, _n);
+    return;
+  }
+  _m_workspace->Deallocate(_p, _n * sizeof(_Tp), _m_align);
+}
+
+template <typename _Tp>
+Workspace* Allocator<_Tp>::GetWorkspace() const noexcept {
+  return _m_workspace;
+}
+
+template <typename _Tp, typename _Up>
+bool operator==(const Allocator<_Tp>& _lhs, const Allocator<_Up>& _rhs) {
+  return _lhs.GetWorkspace() == _rhs.GetWorkspace();
+}
+
+template <typename _Tp, typename _Up>
+bool operator!=(const Allocator<_Tp>& _lhs, const Allocator<_Up>& _rhs) {
+  return !(_lhs == _rhs);
+}
+
+template <typename _Tp>
+Buffer<_Tp>::Buffer(std::size_t _size)
+    : _m_size(_size), _m_data(_m_alloc.allocate(_size)) {}
+
+template <typename _Tp>
+Buffer<_Tp>::~Buffer() {
+  _m_alloc.deallocate(_m_data, _m_size);
+}
+
+template <typename _Tp>
+_Tp* Buffer<_Tp>::Data() const {
+  return _m_data;
+}
+
+}  // namespace Sglty::Memory
+
+// Singularity/Memory/Impl/Allocator.tpp
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "../Workspace.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace Sglty::Memory {
+
+namespace Impl {
+
+inline Workspace*& Current() {
+  thread_local Workspace* current = nullptr;
+  return current;
+}
+
+// Zero-byte allocations still get a distinct address.
+inline std::size_t AllocationSize(std::size_t bytes) {
+  return bytes == 0 ? 1 : bytes;
+}
+
+}  // namespace Impl
+
+inline Workspace::Workspace(std::size_t _bytes)
+    : _m_data(static_cast<unsigned char*>(
+          ::operator new(_bytes, std::align_val_t{alignment}))),
+      _m_capacity(_bytes),
+      _m_owned(true) {}
+
+inline Workspace::Workspace(void* _buffer, std::size_t _bytes)
+    : _m_data(static_cast<unsigned char*>(_buffer)),
+      _m_capacity(_bytes),
+      _m_owned(false) {}
+
+inline Workspace::~Workspace() {
+  if (_m_owned) {
+    ::operator delete(_m_data, std::align_val_t{alignment});
+  }
+}
+
+inline void* Workspace::Allocate(std::size_t _bytes, std::size_t _align) {
+  const std::size_t bytes    = Impl::AllocationSize(_bytes);
+  const std::uintptr_t base  = reinterpret_cast<std::uintptr_t>(_m_data);
+  const std::uintptr_t top   = base + _m_offset;
+  const std::size_t offset   = ((top + _align - 1) & ~(_align - 1)) - base;
+
+  void* p;
+  if (offset <= _m_capacity && bytes <= _m_capacity - offset) {
+    p         = _m_data + offset;
+    _m_offset = offset + bytes;
+  } else {
+    p = ::operator new(bytes, std::align_val_t{_align});
+    _m_overflow += bytes;
+    _m_misses++;
+  }
+  _m_peak = std::max(_m_peak, Used());
+  return p;
+}
+
+inline void Workspace::Deallocate(void* _p,
+                                  std::size_t _bytes,
+                                  std::size_t _align) {
+  const std::size_t bytes = Impl::AllocationSize(_bytes);
+
+  if (!Owns(_p)) {
+    ::operator delete(_p, std::align_val_t{_align});
+    _m_overflow -= bytes;
+    return;
+  }
+  const std::size_t offset = static_cast<unsigned char*>(_p) - _m_data;
+  if (offset + bytes == _m_offset) {
+    _m_offset = offset;
+  }
+}
+
+inline std::size_t Workspace::Mark() const {
+  return _m_offset;
+}
+
+inline void Workspace::Release(std::size_t _mark) {
+  _m_offset = std::min(_m_offset, _mark);
+}
+
+inline bool Workspace::Owns(const void* _p) const {
+  const std::less<const void*> less;
+  return !less(_p, _m_data) && less(_p, _m_data + _m_capacity);
+}
+
+inline std::size_t Workspace::Capacity() const {
+  return _m_capacity;
+}
+
+inline std::size_t Workspace::Used() const {
+  return _m_offset + _m_overflow;
+}
+
+inline std::size_t Workspace::Peak() const {
+  return _m_peak;
+}
+
+inline std::size_t Workspace::Misses() const {
+  return _m_misses;
+}
+
+inline void Workspace::ResetPeak() {
+  _m_peak   = Used();
+  _m_misses = 0;
+}
+
+inline Scope::Scope(Workspace& _workspace)
+    : _m_workspace(_workspace), _m_mark(_workspace.Mark()) {}
+
+inline Scope::~Scope() {
+  _m_workspace.Release(_m_mark);
+}
+
+inline Workspace* GetWorkspace() {
+  return Impl::Current();
+}
+
+inline Workspace* SetWorkspace(Workspace* _workspace) {
+  return std::exchange(Impl::Current(), _workspace);
+}
+
+inline UseWorkspace::UseWorkspace(Workspace& _workspace)
+    : _m_previous(SetWorkspace(&_workspace)) {}
+
+inline UseWorkspace::~UseWorkspace() {
+  SetWorkspace(_m_previous);
+}
+
+}  // namespace Sglty::Memory
+
+// Singularity/Memory/Impl/Workspace.tpp
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Memory {
+
+/**
+ * @brief Bump allocator handing out scratch space from one preallocated
+ * buffer.
+ *
+ * Allocations advance an offset into the buffer; only the most recent one is
+ * given back by `Deallocate()`, everything else is reclaimed at once by
+ * `Release()` (or a `Scope`). Once sized, evaluations drawing from a
+ * workspace never call `operator new`.
+ *
+ * Requests that do not fit are served by `operator new` instead, counted by
+ * `Misses()` and still included in `Peak()`, so one run with a small (or
+ * empty) workspace tells the capacity to reserve.
+ *
+ * A workspace is not thread-safe: it serves the threads it is installed on
+ * (see `SetWorkspace()`) one at a time.
+ *
+ * Example Usage:
+ * ```
+ * Sglty::Memory::Workspace ws(1 << 20);
+ * Sglty::Memory::UseWorkspace use(ws);
+ *
+ * for (;;) {
+ *   Sglty::Memory::Scope scope(ws);
+ *   y = a * x + b;  // packing buffers and temporaries come from `ws`
+ * }
+ * ```
+ */
+class Workspace {
+ public:
+  /// Alignment of the buffer and default alignment of allocations.
+  static constexpr std::size_t alignment = 64;
+
+  /**
+   * @brief Allocates a buffer of `_bytes` bytes, once.
+   *
+   * @param _bytes The capacity.
+   */
+  explicit Workspace(std::size_t _bytes);
+
+  /**
+   * @brief Hands out space from a caller-owned buffer, which must outlive
+   * the workspace.
+   *
+   * @param _buffer The buffer.
+   * @param _bytes  The size of `_buffer`.
+   */
+  Workspace(void* _buffer, std::size_t _bytes);
+
+  Workspace(const Workspace&)            = delete;
+  Workspace& operator=(const Workspace&) = delete;
+
+  ~Workspace();
+
+  /**
+   * @brief Returns `_bytes` bytes aligned to `_align`, a power of two.
+   *
+   * @param _bytes The size of the allocation.
+   * @param _align The alignment of the allocation.
+   * @return The allocation, from the buffer if it fits.
+   */
+  void* Allocate(std::size_t _bytes, std::size_t _align = alignment);
+
+  /**
+   * @brief Gives back an allocation of `Allocate(_bytes, _align)`.
+   *
+   * Space in the buffer is reused only if `_p` is the most recent
+   * allocation; the rest is reclaimed by `Release()`.
+   *
+   * @param _p     The allocation.
+   * @param _bytes The size it was allocated with.
+   * @param _align The alignment it was allocated with.
+   */
+  void Deallocate(void* _p, std::size_t _bytes, std::size_t _align = alignment);
+
+  /**
+   * @brief Returns the current offset, to be passed to `Release()`.
+   */
+  std::size_t Mark() const;
+
+  /**
+   * @brief Reclaims every allocation made from the buffer since `_mark` was
+   * taken.
+   *
+   * Their storage must no longer be used; allocations served by
+   * `operator new` are unaffected.
+   *
+   * @param _mark A value returned by `Mark()`.
+   */
+  void Release(std::size_t _mark);
+
+  /**
+   * @brief Checks whether `_p` points into the buffer.
+   */
+  bool Owns(const void* _p) const;
+
+  /**
+   * @brief Returns the size of the buffer in bytes.
+   */
+  std::size_t Capacity() const;
+
+  /**
+   * @brief Returns the bytes currently in use, including alignment padding
+   * and allocations served by `operator new`.
+   */
+  std::size_t Used() const;
+
+  /**
+   * @brief Returns the highest `Used()` since construction or `ResetPeak()`.
+   *
+   * A workspace of this capacity would have served every allocation (up to
+   * alignment padding of the misses).
+   */
+  std::size_t Peak() const;
+
+  /**
+   * @brief Returns the number of allocations served by `operator new`.
+   */
+  std::size_t Misses() const;
+
+  /**
+   * @brief Restarts `Peak()` from `Used()` and `Misses()` from `0`.
+   */
+  void ResetPeak();
+
+ private:
+  unsigned char* _m_data;
+  std::size_t _m_capacity;
+  bool _m_owned;
+
+  std::size_t _m_offset   = 0;  // end of the last allocation in the buffer
+  std::size_t _m_overflow = 0;  // bytes currently served by `operator new`
+  std::size_t _m_peak     = 0;
+  std::size_t _m_misses   = 0;
+};
+
+/**
+ * @brief Releases everything allocated from a workspace during its lifetime.
+ *
+ * Matrices and buffers drawing from the workspace must not outlive the scope
+ * they were created in.
+ */
+class Scope {
+ public:
+  /**
+   * @brief Takes the mark of `_workspace`.
+   *
+   * @param _workspace The workspace to release on destruction.
+   */
+  explicit Scope(Workspace& _workspace);
+
+  Scope(const Scope&)            = delete;
+  Scope& operator=(const Scope&) = delete;
+
+  ~Scope();
+
+ private:
+  Workspace& _m_workspace;
+  std::size_t _m_mark;
+};
+
+/**
+ * @brief Returns the workspace installed on the calling thread, or `nullptr`.
+ *
+ * Scratch space of evaluations (packing buffers of the product kernel,
+ * temporaries of products, sparse merges, aliasing assignments and
+ * `Expr::Materialized`) and storage of cores using `Memory::Allocator` come
+ * from it when set, and from `operator new` otherwise.
+ *
+ * @return The current workspace.
+ */
+Workspace* GetWorkspace();
+
+/**
+ * @brief Installs `_workspace` on the calling thread.
+ *
+ * Only affects the calling thread: panels handed to the parallel executor
+ * allocate from the workspace installed on the thread running them.
+ *
+ * @param _workspace The new workspace, or `nullptr` to allocate from the
+ * heap.
+ * @return The previous workspace.
+ */
+Workspace* SetWorkspace(Workspace* _workspace);
+
+/**
+ * @brief Installs a workspace on the calling thread for its lifetime and
+ * restores the previous one on destruction.
+ */
+class UseWorkspace {
+ public:
+  /**
+   * @brief Installs `_workspace`.
+   *
+   * @param _workspace The workspace to install.
+   */
+  explicit UseWorkspace(Workspace& _workspace);
+
+  UseWorkspace(const UseWorkspace&)            = delete;
+  UseWorkspace& operator=(const UseWorkspace&) = delete;
+
+  ~UseWorkspace();
+
+ private:
+  Workspace* _m_previous;
+};
+
+}  // namespace Sglty::Memory
+
+#include "Impl/Workspace.tpp"
+
+// Singularity/Memory/Workspace.hpp
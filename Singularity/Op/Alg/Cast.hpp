@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../Expr/Unary.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
+#include "../../Traits/Type.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time element type conversion.
+ *
+ * Used as the `op_type` in `Unary<_operand, CastTo<_Up>>` nodes. Each element
+ * of the operand is converted with `static_cast<_Up>` when it is read, so
+ * unlike `Matrix::Cast()` no converted copy of the operand is made. Dense
+ * product kernels read a cast matrix in place and convert while packing it.
+ *
+ * @tparam _Up The value type of the result.
+ */
+template <typename _Up>
+struct CastTo {
+  /**
+   * @brief Row count of the result.
+   *
+   * Matches the input operand.
+   */
+  template <typename _operand>
+  constexpr static std::size_t rows = _operand::rows;
+
+  /**
+   * @brief Column count of the result.
+   *
+   * Matches the input operand.
+   */
+  template <typename _operand>
+  constexpr static std::size_t cols = _operand::cols;
+
+  /**
+   * @brief Resulting core implementation.
+   *
+   * The operand's core, or the owning core a view evaluates into, rebound to
+   * `_Up`.
+   */
+  template <typename _operand>
+  using core_impl = typename Traits::Core::plain_t<
+      typename _operand::core_impl>::template core_rebind_value<_Up>;
+
+  /**
+   * @brief Always valid—conversion preserves the core layout.
+   */
+  template <typename>
+  constexpr static bool is_valid_core_impl = true;
+
+  /**
+   * @brief Always valid—conversion does not change dimensions.
+   */
+  template <typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Runtime row count of the result.
+   *
+   * Equals `rows` unless the operand is runtime-sized.
+   */
+  template <typename _operand>
+  constexpr std::size_t Rows(const _operand& op) const;
+
+  /**
+   * @brief Runtime column count of the result.
+   *
+   * Equals `cols` unless the operand is runtime-sized.
+   */
+  template <typename _operand>
+  constexpr std::size_t Cols(const _operand& op) const;
+
+  /**
+   * @brief Converts the operand element at a given coordinate.
+   *
+   * @param op Operand expression.
+   * @param i Row index.
+   * @param j Column index.
+   * @return `static_cast<_Up>(op(i, j))`
+   */
+  template <typename _operand>
+  constexpr _Up operator()(const _operand& op,
+                           std::size_t i,
+                           std::size_t j) const;
+
+  /**
+   * @brief Each result element only reads the operand at its own position.
+   */
+  template <typename>
+  constexpr static bool elementwise = true;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Alg {
+
+/**
+ * @brief Converts the elements of an expression to `_Up` lazily.
+ *
+ * Wraps the operand in a `Unary<_operand, Expr::CastTo<_Up>>` node. An
+ * operand whose elements already are of type `_Up` is returned as is (a
+ * reference to an lvalue, a copy of an rvalue).
+ *
+ * `Op::Arthm::Add`, `Sub` and `Mul` insert these nodes themselves when their
+ * operands only differ in element type, e.g. `a * b` for a `float` `a` and a
+ * `double` `b` is `Cast<double>(a) * b` (see
+ * `Sglty::Traits::Type::promote_t`).
+ *
+ * @tparam _Up The value type of the result.
+ * @tparam _operand The operand expression type.
+ * @param _o The operand to convert.
+ * @return The conversion expression, or the operand itself.
+ */
+template <typename _Up, typename _operand>
+constexpr decltype(auto) Cast(_operand&& _o);
+
+namespace Impl {
+
+/**
+ * @brief Value type of the elements of expression `_expr`.
+ */
+template <typename _expr>
+using value_t = typename std::decay_t<_expr>::core_impl::value_type;
+
+/**
+ * @brief Value type that the operands of `_lhs` and `_rhs` are promoted to.
+ */
+template <typename _lhs, typename _rhs>
+using promoted_t = Traits::Type::promote_t<value_t<_lhs>, value_t<_rhs>>;
+
+/**
+ * @brief Whether an `_op` node over `_lhs` and `_rhs` needs its operands
+ * promoted: the element types differ, and the operands are valid for `_op`
+ * once both are cast to `promoted_t`.
+ *
+ * @tparam _op The binary operation.
+ * @tparam _lhs The decayed left-hand side expression type.
+ * @tparam _rhs The decayed right-hand side expression type.
+ */
+template <typename _op, typename _lhs, typename _rhs, typename = void>
+struct IsMixed : std::false_type {};
+
+template <typename _op, typename _lhs, typename _rhs>
+struct IsMixed<
+    _op,
+    _lhs,
+    _rhs,
+    std::enable_if_t<Traits::Expr::is_valid_v<_lhs> &&
+                     Traits::Expr::is_valid_v<_rhs> &&
+                     !std::is_same_v<value_t<_lhs>, value_t<_rhs>> &&
+                     Traits::Type::is_numeric_v<value_t<_lhs>> &&
+                     Traits::Type::is_numeric_v<value_t<_rhs>>>>
+    : std::bool_constant<_op::template is_valid_core_impl<
+          Expr::Unary<_lhs, Expr::CastTo<promoted_t<_lhs, _rhs>>>,
+          Expr::Unary<_rhs, Expr::CastTo<promoted_t<_lhs, _rhs>>>>> {};
+
+}  // namespace Impl
+
+}  // namespace Sglty::Op::Alg
+
+#include "Impl/Cast.tpp"
+
+// Singularity/Op/Alg/Cast.hpp
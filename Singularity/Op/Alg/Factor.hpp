@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Types {
+
+template <typename>
+class Matrix;
+
+}  // namespace Sglty::Types
+
+namespace Sglty::Op::Alg {
+
+/**
+ * @brief Factors `_a` in place as `P * _a = L * U` with partial pivoting.
+ *
+ * `_a` must be dense row- or column-major storage of floating-point values
+ * (`Core::Dense`, `Core::DenseHeap`, `Core::Dynamic`, a `Core::Map` view,
+ * ...); any shape is accepted. On return its strict lower part holds the unit
+ * lower `L` and its upper part `U`, and row `k` was swapped with row
+ * `_pivots[k]` at step `k` (see `Sglty::Kernel::Lu`). Large matrices are
+ * factored in panels whose trailing updates go through the blocked product
+ * kernel; constant evaluation uses the unblocked algorithm.
+ *
+ * Example Usage:
+ * ```
+ * Sglty::DenseMat<double, 3, 3> a = ...;
+ * Sglty::DenseMat<double, 3, 1> b = ...;
+ *
+ * std::size_t pivots[3];
+ * if (Sglty::Op::Alg::Lu(a, pivots)) {
+ *   Sglty::Op::Alg::LuSolve(a, pivots, b);  // b = A^-1 * b
+ * }
+ * ```
+ *
+ * @tparam _core_impl The core implementation of `_a`.
+ * @param _a The matrix to factor.
+ * @param _pivots Caller-provided storage for `min(rows, cols)` indices.
+ * @return `false` if `U` has a zero on its diagonal, i.e. `_a` is singular.
+ */
+template <typename _core_impl>
+constexpr bool Lu(Types::Matrix<_core_impl>& _a, std::size_t* _pivots);
+
+/**
+ * @brief Overwrites `_b` with `A^-1 * _b`, given the factors of a square `A`
+ * computed by `Lu()`.
+ *
+ * Applies the row swaps and solves with `L` and `U` in turn; no inverse is
+ * formed. Mismatching fixed shapes are a compile error; mismatching runtime
+ * shapes throw `std::invalid_argument`.
+ *
+ * @param _lu The factors of `A`.
+ * @param _pivots The pivots of `A`.
+ * @param _b The right-hand sides, one per column.
+ */
+template <typename _core_impl, typename _core_other>
+constexpr void LuSolve(const Types::Matrix<_core_impl>& _lu,
+                       const std::size_t* _pivots,
+                       Types::Matrix<_core_other>& _b);
+
+/**
+ * @brief Computes the determinant of a square `A` from the factors computed
+ * by `Lu()`.
+ *
+ * @param _lu The factors of `A`.
+ * @param _pivots The pivots of `A`.
+ * @return The product of the diagonal of `U`, negated for an odd number of
+ * row swaps.
+ */
+template <typename _core_impl>
+constexpr auto LuDeterminant(const Types::Matrix<_core_impl>& _lu,
+                             const std::size_t* _pivots);
+
+/**
+ * @brief Solves `_a * X = _b` for a square `_a`, overwriting `_b` with `X`.
+ *
+ * `_a` is overwritten by its `Lu()` factors, so they can be reused with
+ * `LuSolve()` for further right-hand sides.
+ *
+ * @param _a The matrix of the system.
+ * @param _b The right-hand sides, one per column.
+ * @param _pivots Caller-provided storage for `rows` indices.
+ * @return `false` if `_a` is singular, in which case `_b` is unchanged.
+ */
+template <typename _core_impl, typename _core_other>
+constexpr bool Solve(Types::Matrix<_core_impl>& _a,
+                     Types::Matrix<_core_other>& _b,
+                     std::size_t* _pivots);
+
+/**
+ * @brief Factors the symmetric positive definite `_a` in place as
+ * `_a = L * Trp(L)`.
+ *
+ * Only the lower triangle of `_a` is read and overwritten by `L`; the strict
+ * upper triangle is left untouched. Non-square fixed shapes are a compile
+ * error; non-square runtime shapes throw `std::invalid_argument`.
+ *
+ * @param _a The matrix to factor.
+ * @return `false` if `_a` is not positive definite.
+ */
+template <typename _core_impl>
+constexpr bool Cholesky(Types::Matrix<_core_impl>& _a);
+
+/**
+ * @brief Overwrites `_b` with `A^-1 * _b`, given the factor `L` of `A`
+ * computed by `Cholesky()`.
+ *
+ * @param _l The factor of `A`.
+ * @param _b The right-hand sides, one per column.
+ */
+template <typename _core_impl, typename _core_other>
+constexpr void CholeskySolve(const Types::Matrix<_core_impl>& _l,
+                             Types::Matrix<_core_other>& _b);
+
+/**
+ * @brief Number of elements `Qr()` needs as workspace for `_a`.
+ *
+ * `0` for matrices small enough to be factored unblocked.
+ */
+template <typename _core_impl>
+constexpr std::size_t QrWorkspaceSize(const Types::Matrix<_core_impl>& _a);
+
+/**
+ * @brief Factors `_a` in place as `_a = Q * R` with Householder reflections.
+ *
+ * On return the upper part of `_a` holds `R` and the part below the
+ * diagonal, together with `_tau`, the reflectors forming `Q` (see
+ * `Sglty::Kernel::Qr`).
+ *
+ * @param _a The matrix to factor.
+ * @param _tau Caller-provided storage for `min(rows, cols)` factors.
+ * @param _work Caller-provided storage for `QrWorkspaceSize(_a)` elements,
+ * which may be `nullptr` when that is `0`.
+ */
+template <typename _core_impl>
+constexpr void Qr(Types::Matrix<_core_impl>& _a,
+                  typename Types::Matrix<_core_impl>::value_type* _tau,
+                  typename Types::Matrix<_core_impl>::value_type* _work =
+                      nullptr);
+
+/**
+ * @brief Solves `A * X = _b` in the least-squares sense, given the factors
+ * of an `m` x `n` matrix `A` with `m >= n` computed by `Qr()`.
+ *
+ * `_b` (`m` rows) is overwritten by `Trp(Q) * _b`, whose first `n` rows are
+ * then solved with `R`: they hold `X` on return.
+ *
+ * @param _qr The factors of `A`.
+ * @param _tau The reflector factors of `A`.
+ * @param _b The right-hand sides, one per column.
+ * @return `false` if `R` has a zero on its diagonal, i.e. `A` does not have
+ * full column rank, in which case `_b` is unchanged.
+ */
+template <typename _core_impl, typename _core_other>
+constexpr bool QrSolve(const Types::Matrix<_core_impl>& _qr,
+                       const typename Types::Matrix<_core_impl>::value_type*
+                           _tau,
+                       Types::Matrix<_core_other>& _b);
+
+}  // namespace Sglty::Op::Alg
+
+#include "Impl/Factor.tpp"
+
+// Singularity/Op/Alg/Factor.hpp
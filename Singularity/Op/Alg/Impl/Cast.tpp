@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../Cast.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../../../Expr/Unary.hpp"
+#include "../../../Traits/Expr.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _Up>
+template <typename _operand>
+constexpr std::size_t CastTo<_Up>::Rows(const _operand& op) const {
+  return op.Rows();
+}
+
+template <typename _Up>
+template <typename _operand>
+constexpr std::size_t CastTo<_Up>::Cols(const _operand& op) const {
+  return op.Cols();
+}
+
+template <typename _Up>
+template <typename _operand>
+constexpr _Up CastTo<_Up>::operator()(const _operand& op,
+                                      std::size_t i,
+                                      std::size_t j) const {
+  return static_cast<_Up>(op(i, j));
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Alg {
+
+template <typename _Up, typename _operand>
+constexpr decltype(auto) Cast(_operand&& _o) {
+  static_assert(Traits::Expr::is_valid_v<std::decay_t<_operand>>,
+                "Error: `_operand` is not a valid expression type.");
+
+  if constexpr (!std::is_same_v<Impl::value_t<_operand>, _Up>) {
+    return Expr::Unary<Traits::Expr::nested_t<_operand>, Expr::CastTo<_Up>>(
+        std::forward<_operand>(_o));
+  } else if constexpr (std::is_lvalue_reference_v<_operand>) {
+    return static_cast<const std::remove_reference_t<_operand>&>(_o);
+  } else {
+    return std::decay_t<_operand>(std::move(_o));
+  }
+}
+
+}  // namespace Sglty::Op::Alg
+
+// Singularity/Op/Alg/Impl/Cast.tpp
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "../Factor.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../../../Core/Enums.hpp"
+#include "../../../Expr/Assign.hpp"
+#include "../../../Kernel/Factor.hpp"
+#include "../../../Traits/Expr.hpp"
+#include "../../../Traits/Size.hpp"
+#include "../../../Types/Matrix.hpp"
+
+namespace Sglty::Op::Alg {
+
+namespace Impl {
+
+// Matrices the factorization kernels work on in place.
+template <typename _matrix>
+struct IsFactorable
+    : std::bool_constant<
+          Expr::Impl::IsDirectAccess<_matrix>::value &&
+          std::is_floating_point_v<typename _matrix::value_type>> {};
+
+template <typename _matrix>
+constexpr std::size_t RowStride(const _matrix& m) {
+  return _matrix::core_major == Core::Major::Row ? m.OuterStride() : 1;
+}
+
+template <typename _matrix>
+constexpr std::size_t ColStride(const _matrix& m) {
+  return _matrix::core_major == Core::Major::Row ? 1 : m.OuterStride();
+}
+
+template <typename _matrix>
+constexpr void CheckSquare(const _matrix& _a) {
+  static_assert(Traits::Size::is_compatible_v<_matrix::rows, _matrix::cols>,
+                "Error: `_a` is not square.");
+
+  if constexpr (Traits::Expr::is_dynamic_v<_matrix>) {
+    if (_a.Rows() != _a.Cols()) {
+      throw std::invalid_argument("Error: `_a` is not square.");
+    }
+  }
+}
+
+// `_b` holds right-hand sides of a system whose matrix is `_a`.
+template <typename _matrix, typename _other>
+constexpr void CheckSystem(const _matrix& _a, const _other& _b) {
+  static_assert(IsFactorable<_other>::value,
+                "Error: `_b` must be dense row- or column-major storage of "
+                "floating-point values.");
+  static_assert(std::is_same_v<typename _matrix::value_type,
+                               typename _other::value_type>,
+                "Error: `_a` and `_b` have different value types.");
+  static_assert(Traits::Size::is_compatible_v<_matrix::rows, _other::rows>,
+                "Error: `_a` and `_b` have different row counts.");
+
+  if constexpr (Traits::Expr::is_dynamic_v<_matrix> ||
+                Traits::Expr::is_dynamic_v<_other>) {
+    if (_a.Rows() != _b.Rows()) {
+      throw std::invalid_argument(
+          "Error: `_a` and `_b` have different row counts.");
+    }
+  }
+}
+
+}  // namespace Impl
+
+template <typename _core_impl>
+constexpr bool Lu(Types::Matrix<_core_impl>& _a, std::size_t* _pivots) {
+  using matrix_type = Types::Matrix<_core_impl>;
+
+  static_assert(Impl::IsFactorable<matrix_type>::value,
+                "Error: `_a` must be dense row- or column-major storage of "
+                "floating-point values.");
+
+  return Kernel::Lu(_a.Rows(),
+                    _a.Cols(),
+                    _a.Data(),
+                    Impl::RowStride(_a),
+                    Impl::ColStride(_a),
+                    _pivots);
+}
+
+template <typename _core_impl, typename _core_other>
+constexpr void LuSolve(const Types::Matrix<_core_impl>& _lu,
+                       const std::size_t* _pivots,
+                       Types::Matrix<_core_other>& _b) {
+  static_assert(Impl::IsFactorable<Types::Matrix<_core_impl>>::value,
+                "Error: `_lu` must be dense row- or column-major storage of "
+                "floating-point values.");
+
+  Impl::CheckSquare(_lu);
+  Impl::CheckSystem(_lu, _b);
+
+  const std::size_t n     = _lu.Rows();
+  const std::size_t k     = _b.Cols();
+  const std::size_t lu_rs = Impl::RowStride(_lu);
+  const std::size_t lu_cs = Impl::ColStride(_lu);
+  const std::size_t b_rs  = Impl::RowStride(_b);
+  const std::size_t b_cs  = Impl::ColStride(_b);
+
+  auto* b = _b.Data();
+  for (std::size_t i = 0; i < n; i++) {
+    if (_pivots[i] != i) {
+      for (std::size_t j = 0; j < k; j++) {
+        const auto t                    = b[i * b_rs + j * b_cs];
+        b[i * b_rs + j * b_cs]          = b[_pivots[i] * b_rs + j * b_cs];
+        b[_pivots[i] * b_rs + j * b_cs] = t;
+      }
+    }
+  }
+  Kernel::TriangularSolve<true, true>(
+      n, k, _lu.Data(), lu_rs, lu_cs, b, b_rs, b_cs);
+  Kernel::TriangularSolve<false, false>(
+      n, k, _lu.Data(), lu_rs, lu_cs, b, b_rs, b_cs);
+}
+
+template <typename _core_impl>
+constexpr auto LuDeterminant(const Types::Matrix<_core_impl>& _lu,
+                             const std::size_t* _pivots) {
+  using value_type = typename Types::Matrix<_core_impl>::value_type;
+
+  Impl::CheckSquare(_lu);
+
+  value_type det(1);
+  for (std::size_t i = 0; i < _lu.Rows(); i++) {
+    det *= _pivots[i] == i ? _lu(i, i) : -_lu(i, i);
+  }
+  return det;
+}
+
+template <typename _core_impl, typename _core_other>
+constexpr bool Solve(Types::Matrix<_core_impl>& _a,
+                     Types::Matrix<_core_other>& _b,
+                     std::size_t* _pivots) {
+  Impl::CheckSquare(_a);
+  Impl::CheckSystem(_a, _b);
+
+  if (!Lu(_a, _pivots)) {
+    return false;
+  }
+  LuSolve(_a, _pivots, _b);
+  return true;
+}
+
+template <typename _core_impl>
+constexpr bool Cholesky(Types::Matrix<_core_impl>& _a) {
+  using matrix_type = Types::Matrix<_core_impl>;
+
+  static_assert(Impl::IsFactorable<matrix_type>::value,
+                "Error: `_a` must be dense row- or column-major storage of "
+                "floating-point values.");
+
+  Impl::CheckSquare(_a);
+
+  return Kernel::Cholesky(
+      _a.Rows(), _a.Data(), Impl::RowStride(_a), Impl::ColStride(_a));
+}
+
+template <typename _core_impl, typename _core_other>
+constexpr void CholeskySolve(const Types::Matrix<_core_impl>& _l,
+                             Types::Matrix<_core_other>& _b) {
+  static_assert(Impl::IsFactorable<Types::Matrix<_core_impl>>::value,
+                "Error: `_l` must be dense row- or column-major storage of "
+                "floating-point values.");
+
+  Impl::CheckSquare(_l);
+  Impl::CheckSystem(_l, _b);
+
+  const std::size_t n    = _l.Rows();
+  const std::size_t l_rs = Impl::RowStride(_l);
+  const std::size_t l_cs = Impl::ColStride(_l);
+
+  // L * Y = B, then Trp(L) * X = Y through the swapped strides of `L`.
+  Kernel::TriangularSolve<true, false>(n,
+                                       _b.Cols(),
+                                       _l.Data(),
+                                       l_rs,
+                                       l_cs,
+                                       _b.Data(),
+                                       Impl::RowStride(_b),
+                                       Impl::ColStride(_b));
+  Kernel::TriangularSolve<false, false>(n,
+                                        _b.Cols(),
+                                        _l.Data(),
+                                        l_cs,
+                                        l_rs,
+                                        _b.Data(),
+                                        Impl::RowStride(_b),
+                                        Impl::ColStride(_b));
+}
+
+template <typename _core_impl>
+constexpr std::size_t QrWorkspaceSize(const Types::Matrix<_core_impl>& _a) {
+  using value_type = typename Types::Matrix<_core_impl>::value_type;
+
+  return Kernel::QrWorkspaceSize<value_type>(_a.Rows(), _a.Cols());
+}
+
+template <typename _core_impl>
+constexpr void Qr(Types::Matrix<_core_impl>& _a,
+                  typename Types::Matrix<_core_impl>::value_type* _tau,
+                  typename Types::Matrix<_core_impl>::value_type* _work) {
+  using matrix_type = Types::Matrix<_core_impl>;
+
+  static_assert(Impl::IsFactorable<matrix_type>::value,
+                "Error: `_a` must be dense row- or column-major storage of "
+                "floating-point values.");
+
+  Kernel::Qr(_a.Rows(),
+             _a.Cols(),
+             _a.Data(),
+             Impl::RowStride(_a),
+             Impl::ColStride(_a),
+             _tau,
+             _work);
+}
+
+template <typename _core_impl, typename _core_other>
+constexpr bool QrSolve(const Types::Matrix<_core_impl>& _qr,
+                       const typename Types::Matrix<_core_impl>::value_type*
+                           _tau,
+                       Types::Matrix<_core_other>& _b) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  static_assert(Impl::IsFactorable<matrix_type>::value,
+                "Error: `_qr` must be dense row- or column-major storage of "
+                "floating-point values.");
+  static_assert(matrix_type::rows == Traits::Size::dynamic ||
+                    matrix_type::cols == Traits::Size::dynamic ||
+                    matrix_type::rows >= matrix_type::cols,
+                "Error: `_qr` has fewer rows than columns.");
+
+  Impl::CheckSystem(_qr, _b);
+
+  const std::size_t m = _qr.Rows();
+  const std::size_t n = _qr.Cols();
+  if constexpr (Traits::Expr::is_dynamic_v<matrix_type>) {
+    if (m < n) {
+      throw std::invalid_argument("Error: `_qr` has fewer rows than columns.");
+    }
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    if (_qr(i, i) == value_type{}) {
+      return false;
+    }
+  }
+
+  const std::size_t b_rs = Impl::RowStride(_b);
+  const std::size_t b_cs = Impl::ColStride(_b);
+  Kernel::ApplyQt(m,
+                  n,
+                  _b.Cols(),
+                  _qr.Data(),
+                  Impl::RowStride(_qr),
+                  Impl::ColStride(_qr),
+                  _tau,
+                  _b.Data(),
+                  b_rs,
+                  b_cs);
+  Kernel::TriangularSolve<false, false>(n,
+                                        _b.Cols(),
+                                        _qr.Data(),
+                                        Impl::RowStride(_qr),
+                                        Impl::ColStride(_qr),
+                                        _b.Data(),
+                                        b_rs,
+                                        b_cs);
+  return true;
+}
+
+}  // namespace Sglty::Op::Alg
+
+// Singularity/Op/Alg/Impl/Factor.tpp
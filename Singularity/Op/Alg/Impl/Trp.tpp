@@ -3,10 +3,29 @@
 #include "../Trp.hpp"
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../../../Core/Enums.hpp"
+#include "../../../Expr/Binary.hpp"
 #include "../../../Expr/Unary.hpp"
+#include "../../Arthm/Mul.hpp"
+#include "../../../Traits/Core.hpp"
+#include "../../../Traits/Expr.hpp"
+#include "../../../Types/Matrix.hpp"
 
 namespace Sglty::Expr {
 
+template <typename _operand>
+constexpr std::size_t Trp::Rows(const _operand& op) const {
+  return op.Cols();
+}
+
+template <typename _operand>
+constexpr std::size_t Trp::Cols(const _operand& op) const {
+  return op.Rows();
+}
+
 template <typename _operand>
 constexpr auto Trp::operator()(const _operand& op,
                                std::size_t i,
@@ -18,9 +37,94 @@ constexpr auto Trp::operator()(const _operand& op,
 
 namespace Sglty::Op::Alg {
 
+namespace Impl {
+
+template <typename _expr>
+struct IsTrp : std::false_type {};
+
 template <typename _operand>
-constexpr auto Trp(const _operand& _o) {
-  return Expr::Unary<_operand, Expr::Trp>(_o);
+struct IsTrp<Expr::Unary<_operand, Expr::Trp>> : std::true_type {};
+
+// Products of two lvalue dense matrices: `Trp(a * b)` is `Trp(b) * Trp(a)`,
+// whose transposed operands the product kernels read in place.
+template <typename _expr>
+struct IsDenseProduct : std::false_type {};
+
+template <typename _lhs, typename _rhs>
+struct IsDenseProduct<Expr::Binary<const _lhs&, const _rhs&, Expr::MulMatrix>>
+    : std::bool_constant<_lhs::core_type == Core::Type::Dense &&
+                         _rhs::core_type == Core::Type::Dense &&
+                         !Traits::Core::is_sparse_v<typename _lhs::core_impl> &&
+                         !Traits::Core::is_sparse_v<typename _rhs::core_impl> &&
+                         std::is_arithmetic_v<typename _lhs::value_type> &&
+                         std::is_arithmetic_v<typename _rhs::value_type>> {};
+
+// Owning, tightly packed dense matrices, whose storage read in the other
+// major is their transpose.
+template <typename _operand, typename _enable = void>
+struct IsFlippable : std::false_type {};
+
+template <typename _operand>
+struct IsFlippable<_operand,
+                   std::enable_if_t<Traits::Expr::is_terminal_v<_operand>>> {
+  using core_impl = typename _operand::core_impl;
+
+  static constexpr bool row = _operand::core_major == Core::Major::Row;
+
+  /// Same elements, transposed shape, other major.
+  using flipped_core = typename core_impl::template core_rebind_size<
+      _operand::cols,
+      _operand::rows>::template core_rebind_major<row ? Core::Major::Col
+                                                      : Core::Major::Row>;
+
+  static constexpr std::size_t inner = row ? _operand::cols : _operand::rows;
+
+  static constexpr bool value =
+      !Traits::Core::is_view_v<core_impl> &&
+      !Traits::Core::is_sparse_v<core_impl> &&
+      Traits::Core::tile_v<core_impl> == 0 &&
+      _operand::core_type == Core::Type::Dense &&
+      (row || _operand::core_major == Core::Major::Col) &&
+      std::is_arithmetic_v<typename _operand::value_type> &&
+      (Traits::Core::is_dynamic_v<core_impl> ||
+       (Traits::Core::leading_dim_v<core_impl> == inner &&
+        Traits::Core::leading_dim_v<flipped_core> == inner));
+};
+
+template <typename _matrix>
+constexpr auto Flip(const _matrix& _m) {
+  using result_core = typename IsFlippable<_matrix>::flipped_core;
+
+  Types::Matrix<result_core> result;
+  if constexpr (Traits::Core::is_dynamic_v<result_core>) {
+    result.Resize(_m.Cols(), _m.Rows());
+  }
+  const std::size_t size = _m.Rows() * _m.Cols();
+  for (std::size_t k = 0; k < size; k++) {
+    result.Data()[k] = _m.Data()[k];
+  }
+  return result;
+}
+
+}  // namespace Impl
+
+template <typename _operand>
+constexpr decltype(auto) Trp(_operand&& _o) {
+  using operand_type = std::remove_cv_t<std::remove_reference_t<_operand>>;
+
+  if constexpr (Impl::IsTrp<operand_type>::value) {
+    // `Trp(Trp(x))` is `x`, kept the way the inner expression holds it.
+    return Expr::Impl::Operand(std::forward<_operand>(_o));
+  } else if constexpr (Impl::IsDenseProduct<operand_type>::value) {
+    return Arthm::Mul(Trp(_o._r), Trp(_o._l));
+  } else if constexpr (!std::is_lvalue_reference_v<_operand> &&
+                       Impl::IsFlippable<operand_type>::value) {
+    // A temporary, e.g. from `Reorder()`, is re-read in the other major.
+    return Impl::Flip(_o);
+  } else {
+    return Expr::Unary<Traits::Expr::nested_t<_operand>, Expr::Trp>(
+        std::forward<_operand>(_o));
+  }
 }
 
 }  // namespace Sglty::Op::Alg
@@ -2,6 +2,9 @@
 
 #include <cstddef>
 
+#include "../../Expr/Enums.hpp"
+#include "../../Traits/Core.hpp"
+
 namespace Sglty::Expr {
 
 /**
@@ -39,14 +42,13 @@ struct Trp {
    * @brief The core implementation type for the transposed result.
    *
    * This is derived by rebinding the operand's `core_impl` to its transposed
-   * shape.
+   * shape, or its `core_transpose` (e.g. an upper triangle becomes a lower
+   * one, see `Sglty::Traits::Core::transpose_t`).
    *
    * @tparam _operand The operand expression.
    */
   template <typename _operand>
-  using core_impl =
-      typename _operand::core_impl::template core_rebind_size<rows<_operand>,
-                                                              cols<_operand> >;
+  using core_impl = Traits::Core::transpose_t<typename _operand::core_impl>;
 
   /**
    * @brief Whether the operand is valid for core rebinding.
@@ -64,6 +66,35 @@ struct Trp {
   template <typename>
   constexpr static bool is_valid_dimension = true;
 
+  /**
+   * @brief Runtime row count of the result.
+   *
+   * Equals `rows` unless the operand is runtime-sized.
+   */
+  template <typename _operand>
+  constexpr std::size_t Rows(const _operand& op) const;
+
+  /**
+   * @brief Runtime column count of the result.
+   *
+   * Equals `cols` unless the operand is runtime-sized.
+   */
+  template <typename _operand>
+  constexpr std::size_t Cols(const _operand& op) const;
+
+  /**
+   * @brief Transposition only remaps indices and performs no arithmetic.
+   */
+  template <typename>
+  constexpr static std::size_t cost = 0;
+
+  /**
+   * @brief The result keeps the storage order of the operand, so consecutive
+   * elements read the operand across it.
+   */
+  template <typename>
+  constexpr static Access access = Access::Strided;
+
   /**
    * @brief Evaluates the transpose at a given coordinate.
    *
@@ -89,15 +120,30 @@ namespace Sglty::Op::Alg {
  * @brief Creates a transposed matrix expression.
  *
  * Wraps the given operand in a unary expression using the `Expr::Trp`
- * operation.
+ * operation. Three rewrites are applied at compile time:
+ *
+ * - `Trp(Trp(x))` returns `x` itself (a reference to a matrix, or the inner
+ *   expression)
+ *
+ * - `Trp(a * b)` of two dense matrices becomes `Trp(b) * Trp(a)`, which the
+ *   product kernels evaluate by reading `a` and `b` with swapped strides
+ *   instead of recomputing a dot product per transposed element
+ *
+ * - the transpose of a temporary owning dense matrix, such as the result of
+ *   `Reorder()`, is the same elements in the other major: they are copied
+ *   linearly into a matrix of the flipped layout instead of being read with
+ *   a stride later
+ *
+ * Evaluating a transpose of a dense matrix into one goes through the tiled
+ * `Sglty::Kernel::Copy`; `a = Trp(a)` transposes in place.
  *
  * @tparam _operand The operand expression type.
  * @param _o The operand to transpose.
  * @return A `Unary<_operand, Expr::Trp>` representing the transposed
- * expression.
+ * expression, or the result of a rewrite.
  */
 template <typename _operand>
-constexpr auto Trp(const _operand& _o);
+constexpr decltype(auto) Trp(_operand&& _o);
 
 }  // namespace Sglty::Op::Alg
 
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
 
 namespace Sglty::Expr {
 
@@ -12,7 +17,10 @@ namespace Sglty::Expr {
  *
  * Both operands must:
  * - Be the same shape (`rows` and `cols` match)
- * - Have the same `core_impl` type
+ * - Have the same `core_impl` type, views counting as the core they evaluate
+ *   into (see `Sglty::Traits::Core::plain_t`), unless one of them is
+ *   structured (see `Sglty::Traits::Core::is_structured_v`) and both share
+ *   their value type
  */
 struct Add {
   /**
@@ -40,20 +48,29 @@ struct Add {
   /**
    * @brief The core implementation used by the resulting expression.
    *
-   * Only valid if both operands share the same core implementation.
+   * Only valid if both operands share the same core implementation. Views
+   * are replaced by the owning core they evaluate into, and structured
+   * operands combine as by `Sglty::Traits::Core::sum_t`.
    *
    * @tparam _lhs Left-hand side expression.
    * @tparam _rhs Right-hand side expression.
    */
   template <typename _lhs, typename _rhs>
-  using core_impl = typename _lhs::core_impl;
+  using core_impl = Traits::Core::sum_t<typename _lhs::core_impl,
+                                        typename _rhs::core_impl>;
 
   /**
-   * @brief Verifies that both operands use the same core implementation.
+   * @brief Verifies that both operands use the same core implementation,
+   * or that a structured one shares the value type of the other.
    */
   template <typename _lhs, typename _rhs>
   constexpr static bool is_valid_core_impl =
-      std::is_same_v<typename _lhs::core_impl, typename _rhs::core_impl>;
+      std::is_same_v<Traits::Core::plain_t<typename _lhs::core_impl>,
+                     Traits::Core::plain_t<typename _rhs::core_impl>> ||
+      ((Traits::Core::is_structured_v<typename _lhs::core_impl> ||
+        Traits::Core::is_structured_v<typename _rhs::core_impl>) &&
+       std::is_same_v<typename _lhs::core_impl::type_traits::value_type,
+                      typename _rhs::core_impl::type_traits::value_type>);
 
   /**
    * @brief Verifies that both operands have the same shape.
@@ -62,6 +79,29 @@ struct Add {
   constexpr static bool is_valid_dimension =
       (_lhs::rows == _rhs::rows) && (_lhs::cols == _rhs::cols);
 
+  /**
+   * @brief Runtime row count of the result.
+   *
+   * Equals `rows` unless an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr std::size_t Rows(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Runtime column count of the result.
+   *
+   * Equals `cols` unless an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr std::size_t Cols(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Runtime counterpart of `is_valid_dimension`, checked by `Binary`
+   * when an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr bool IsValidDimension(const _lhs& _l, const _rhs& _r) const;
+
   /**
    * @brief Evaluates the sum of two matrix expressions at a given position.
    *
@@ -78,6 +118,109 @@ struct Add {
                             const _rhs& _r,
                             std::size_t i,
                             std::size_t j) const;
+
+  /**
+   * @brief Element-wise addition always has a packet form.
+   */
+  template <typename, typename>
+  constexpr static bool vectorizable = true;
+
+  /**
+   * @brief Each result element only reads the operands at its own position.
+   */
+  template <typename, typename>
+  constexpr static bool elementwise = true;
+
+  /**
+   * @brief Evaluates the sum of two packets at a given position.
+   *
+   * @param _l Left operand.
+   * @param _r Right operand.
+   * @param i Row index of the first lane.
+   * @param j Column index of the first lane.
+   * @return `_l.Packet(i, j) + _r.Packet(i, j)`.
+   */
+  template <typename _lhs, typename _rhs>
+  auto Packet(const _lhs& _l,
+              const _rhs& _r,
+              std::size_t i,
+              std::size_t j) const;
+};
+
+/**
+ * @brief Fused scaled addition `x * s + y`.
+ *
+ * Used as the `op_type` of a `Binary<_lhs, _rhs, Axpy>` node whose `_lhs` is
+ * the scaled operand `Binary<x, s, MulScalar>` and whose `_rhs` is `y`.
+ * `Op::Arthm::Add` builds it from `x * s + y` (or `y + x * s`) over
+ * floating-point elements, so each element is one `Sglty::Simd::Fma` with a
+ * single rounding instead of a multiply, an add and two roundings.
+ *
+ * Shape, core and dimension rules are those of `Expr::Add`.
+ */
+struct Axpy : Add {
+  /**
+   * @brief The multiply is already counted by the scaled operand.
+   */
+  template <typename, typename>
+  constexpr static std::size_t cost = 0;
+
+  /**
+   * @brief Evaluates `x(i, j) * s + y(i, j)` with one rounding.
+   *
+   * @param _l Scaled operand `x * s`.
+   * @param _r Added operand `y`.
+   * @param i Row index.
+   * @param j Column index.
+   * @return The fused multiply-add at (i, j). The return type is spelled out
+   * so that probing the op with `Expr::Dummy` does not instantiate the body.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr auto operator()(const _lhs& _l,
+                            const _rhs& _r,
+                            std::size_t i,
+                            std::size_t j) const
+      -> decltype(std::declval<const _lhs&>()(i, j) +
+                  std::declval<const _rhs&>()(i, j));
+
+  /**
+   * @brief Evaluates the fused multiply-add of a packet at a given position.
+   *
+   * @param _l Scaled operand `x * s`, whose scalar is broadcast.
+   * @param _r Added operand `y`.
+   * @param i Row index of the first lane.
+   * @param j Column index of the first lane.
+   * @return `Fma(x.Packet(i, j), Broadcast(s), y.Packet(i, j))`.
+   */
+  template <typename _lhs, typename _rhs>
+  auto Packet(const _lhs& _l,
+              const _rhs& _r,
+              std::size_t i,
+              std::size_t j) const;
+};
+
+/**
+ * @brief Product accumulated into an addend, `C = alpha * A * B + beta * C`.
+ *
+ * Used as the `op_type` of a `Binary<_lhs, _rhs, GemmAccumulate>` node whose
+ * `_rhs` is a dense product `a * b`, optionally scaled (`a * b * alpha`), and
+ * whose `_lhs` is the addend. `Op::Arthm::Add` and `Op::Arthm::Sub` build it
+ * from `c + a * b`, `c - a * b` and their scaled forms, including the ones
+ * behind `c += a * b` and `c -= a * b`.
+ *
+ * Elements are still `l(i, j) + r(i, j)` (see `Expr::Add`), which is what
+ * constant evaluation uses. At runtime `Expr::AssignNoAlias` writes the
+ * addend into the destination (or keeps it, when the addend is the
+ * destination itself, possibly scaled by `beta`) and lets
+ * `Sglty::Kernel::GemmAccumulate` add the product to it in place, without a
+ * temporary for the product.
+ */
+struct GemmAccumulate : Add {
+  /**
+   * @brief Products have no packet form.
+   */
+  template <typename, typename>
+  constexpr static bool vectorizable = false;
 };
 
 }  // namespace Sglty::Expr
@@ -88,7 +231,15 @@ namespace Sglty::Op::Arthm {
  * @brief Constructs a binary expression for matrix addition.
  *
  * Wraps `_l` and `_r` in a `Binary` expression node using the `Expr::Add`
- * operation.
+ * operation. A negated operand is subtracted instead: `x + (-y)` is `x - y`
+ * and `(-x) + y` is `y - x`. A dense (scaled) product operand builds an
+ * `Expr::GemmAccumulate` node, and a scaled floating-point operand an
+ * `Expr::Axpy` node.
+ *
+ * A placeholder such as `Sglty::Constant(1.0f)` first takes the shape of the
+ * other operand (see `Expr::Unshaped`). An `Expr::Zero` operand is dropped:
+ * `x + z` and `z + x` are `x` itself, a reference to lvalue terminals, when
+ * `x` already has the core of the sum.
  *
  * @tparam _lhs Left-hand side expression.
  * @tparam _rhs Right-hand side expression.
@@ -97,7 +248,7 @@ namespace Sglty::Op::Arthm {
  * @return A compile-time binary addition expression.
  */
 template <typename _lhs, typename _rhs>
-constexpr auto Add(const _lhs& _l, const _rhs& _r);
+constexpr decltype(auto) Add(_lhs&& _l, _rhs&& _r);
 
 }  // namespace Sglty::Op::Arthm
 
@@ -107,7 +258,9 @@ namespace Sglty::Types {
  * @brief Operator overload for matrix addition.
  *
  * Enables using `+` between any two valid matrix expressions.
- * Internally forwards to `Op::Arthm::Add`.
+ * Internally forwards to `Op::Arthm::Add`. Enabled only if either operand
+ * is a valid expression, so types merely sharing the namespace of a matrix
+ * (e.g. iterators of a `std::vector` of matrices) keep their own `+`.
  *
  * @tparam _lhs Left-hand side expression.
  * @tparam _rhs Right-hand side expression.
@@ -115,8 +268,12 @@ namespace Sglty::Types {
  * @param _r The right operand.
  * @return A binary addition expression.
  */
-template <typename _lhs, typename _rhs>
-constexpr auto operator+(const _lhs& _l, const _rhs& _r);
+template <typename _lhs,
+          typename _rhs,
+          bool _enable = Traits::Expr::is_valid_v<std::decay_t<_lhs>> ||
+                         Traits::Expr::is_valid_v<std::decay_t<_rhs>>,
+          typename     = std::enable_if_t<_enable>>
+constexpr decltype(auto) operator+(_lhs&& _l, _rhs&& _r);
 
 }  // namespace Sglty::Types
 
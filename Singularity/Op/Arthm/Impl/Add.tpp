@@ -3,8 +3,17 @@
 #include "../Add.hpp"
 
 #include <type_traits>
+#include <utility>
 
 #include "../../../Expr/Binary.hpp"
+#include "../../../Expr/Constant.hpp"
+#include "../../../Expr/Unary.hpp"
+#include "../../Alg/Cast.hpp"
+#include "../Mul.hpp"
+#include "../Neg.hpp"
+#include "../Sub.hpp"
+#include "../../../Simd/Packet.hpp"
+#include "../../../Traits/Expr.hpp"
 
 namespace Sglty::Expr {
 
@@ -21,22 +30,134 @@ constexpr auto Add::operator()(const _lhs& _l,
   return _l(i, j) + _r(i, j);
 }
 
+template <typename _lhs, typename _rhs>
+constexpr std::size_t Add::Rows(const _lhs& _l, const _rhs&) const {
+  return _l.Rows();
+}
+
+template <typename _lhs, typename _rhs>
+constexpr std::size_t Add::Cols(const _lhs& _l, const _rhs&) const {
+  return _l.Cols();
+}
+
+template <typename _lhs, typename _rhs>
+constexpr bool Add::IsValidDimension(const _lhs& _l, const _rhs& _r) const {
+  return _l.Rows() == _r.Rows() && _l.Cols() == _r.Cols();
+}
+
+template <typename _lhs, typename _rhs>
+auto Add::Packet(const _lhs& _l,
+                 const _rhs& _r,
+                 std::size_t i,
+                 std::size_t j) const {
+  return _l.Packet(i, j) + _r.Packet(i, j);
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto Axpy::operator()(const _lhs& _l,
+                                const _rhs& _r,
+                                std::size_t i,
+                                std::size_t j) const
+    -> decltype(std::declval<const _lhs&>()(i, j) +
+                std::declval<const _rhs&>()(i, j)) {
+  static_assert(is_valid_core_impl<_lhs, _rhs>,
+                "Error: `_lhs` and `_rhs` have different `core_impl` types.");
+  static_assert(is_valid_dimension<_lhs, _rhs>,
+                "Error: `_lhs` and `_rhs` have incompatible dimensions.");
+
+  using value_type = decltype(_l(i, j));
+
+  return Simd::Fma<value_type>(_l._l(i, j), _l._r, _r(i, j));
+}
+
+template <typename _lhs, typename _rhs>
+auto Axpy::Packet(const _lhs& _l,
+                  const _rhs& _r,
+                  std::size_t i,
+                  std::size_t j) const {
+  const auto packet = _l._l.Packet(i, j);
+  return Simd::Fma(packet, decltype(packet)::Broadcast(_l._r), _r.Packet(i, j));
+}
+
 }  // namespace Sglty::Expr
 
 namespace Sglty::Op::Arthm {
 
 template <typename _lhs, typename _rhs>
-constexpr auto Add(const _lhs& _l, const _rhs& _r) {
-  return Expr::Binary<_lhs, _rhs, Expr::Add>(_l, _r);
+constexpr decltype(auto) Add(_lhs&& _l, _rhs&& _r) {
+  using lhs_type = std::decay_t<_lhs>;
+  using rhs_type = std::decay_t<_rhs>;
+
+  if constexpr (Expr::Impl::IsUnshaped<lhs_type>::value ||
+                Expr::Impl::IsUnshaped<rhs_type>::value) {
+    static_assert(!Expr::Impl::IsUnshaped<lhs_type>::value ||
+                      !Expr::Impl::IsUnshaped<rhs_type>::value,
+                  "Error: neither operand has a shape.");
+    if constexpr (Expr::Impl::IsUnshaped<rhs_type>::value) {
+      return Add(std::forward<_lhs>(_l), _r.Shape(_l));
+    } else {
+      return Add(_l.Shape(_r), std::forward<_rhs>(_r));
+    }
+  } else if constexpr (Alg::Impl::IsMixed<Expr::Add,
+                                   std::decay_t<_lhs>,
+                                   std::decay_t<_rhs>>::value) {
+    // Both sides are converted to the promoted type as they are read.
+    using value_type = Alg::Impl::promoted_t<_lhs, _rhs>;
+    return Add(Alg::Cast<value_type>(std::forward<_lhs>(_l)),
+               Alg::Cast<value_type>(std::forward<_rhs>(_r)));
+  } else if constexpr (Expr::Impl::IsZeroSum<Expr::Add, lhs_type, rhs_type>::
+                           value) {
+    // `x + 0` is `x`, without reading the zero.
+    Expr::Impl::CheckDimension<Expr::Add>(_l, _r);
+    return Expr::Impl::Nest(std::forward<_lhs>(_l));
+  } else if constexpr (Expr::Impl::IsZeroSum<Expr::Add, rhs_type, lhs_type>::
+                           value) {
+    Expr::Impl::CheckDimension<Expr::Add>(_l, _r);
+    return Expr::Impl::Nest(std::forward<_rhs>(_r));
+  } else if constexpr (Impl::IsNeg<std::decay_t<_rhs>>::value) {
+    // `x + (-y)` is `x - y`: one node and one negation less per element.
+    return Sub(std::forward<_lhs>(_l),
+               Expr::Impl::Operand(std::forward<_rhs>(_r)));
+  } else if constexpr (Impl::IsNeg<std::decay_t<_lhs>>::value) {
+    return Sub(std::forward<_rhs>(_r),
+               Expr::Impl::Operand(std::forward<_lhs>(_l)));
+  } else if constexpr (Impl::IsAccumulateTerm<std::decay_t<_rhs>>::value) {
+    // `c + a * b` adds the product to `c` in place (see `GemmAccumulate`).
+    return Expr::Binary<Traits::Expr::nested_t<_lhs>,
+                        Traits::Expr::nested_t<_rhs>,
+                        Expr::GemmAccumulate>(std::forward<_lhs>(_l),
+                                              std::forward<_rhs>(_r));
+  } else if constexpr (Impl::IsAccumulateTerm<std::decay_t<_lhs>>::value) {
+    return Expr::Binary<Traits::Expr::nested_t<_rhs>,
+                        Traits::Expr::nested_t<_lhs>,
+                        Expr::GemmAccumulate>(std::forward<_rhs>(_r),
+                                              std::forward<_lhs>(_l));
+  } else if constexpr (Impl::IsAxpyTerm<std::decay_t<_lhs>>::value) {
+    // `x * s + y` is one fused multiply-add per element.
+    return Expr::Binary<Traits::Expr::nested_t<_lhs>,
+                        Traits::Expr::nested_t<_rhs>,
+                        Expr::Axpy>(std::forward<_lhs>(_l),
+                                    std::forward<_rhs>(_r));
+  } else if constexpr (Impl::IsAxpyTerm<std::decay_t<_rhs>>::value) {
+    return Expr::Binary<Traits::Expr::nested_t<_rhs>,
+                        Traits::Expr::nested_t<_lhs>,
+                        Expr::Axpy>(std::forward<_rhs>(_r),
+                                    std::forward<_lhs>(_l));
+  } else {
+    return Expr::Binary<Traits::Expr::nested_t<_lhs>,
+                        Traits::Expr::nested_t<_rhs>,
+                        Expr::Add>(std::forward<_lhs>(_l),
+                                   std::forward<_rhs>(_r));
+  }
 }
 
 }  // namespace Sglty::Op::Arthm
 
 namespace Sglty::Types {
 
-template <typename _lhs, typename _rhs>
-constexpr auto operator+(const _lhs& _l, const _rhs& _r) {
-  return Op::Arthm::Add(_l, _r);
+template <typename _lhs, typename _rhs, bool _enable, typename>
+constexpr decltype(auto) operator+(_lhs&& _l, _rhs&& _r) {
+  return Op::Arthm::Add(std::forward<_lhs>(_l), std::forward<_rhs>(_r));
 }
 
 }  // namespace Sglty::Types
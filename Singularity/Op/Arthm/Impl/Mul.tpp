@@ -2,10 +2,19 @@
 
 #include "../Mul.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #include "../../../Expr/Binary.hpp"
+#include "../../../Expr/Unary.hpp"
+#include "../../../Expr/Materialized.hpp"
+#include "../../../Kernel/Unroll.hpp"
+#include "../../Alg/Cast.hpp"
+#include "../../../Traits/Core.hpp"
 #include "../../../Traits/Expr.hpp"
+#include "../../../Traits/Size.hpp"
 
 namespace Sglty::Expr {
 
@@ -17,6 +26,46 @@ constexpr auto MulScalar::operator()(const _lhs& _l,
   return _l(i, j) * _r;
 }
 
+template <typename _lhs, typename _rhs>
+constexpr std::size_t MulScalar::Rows(const _lhs& _l, const _rhs&) const {
+  return _l.Rows();
+}
+
+template <typename _lhs, typename _rhs>
+constexpr std::size_t MulScalar::Cols(const _lhs& _l, const _rhs&) const {
+  return _l.Cols();
+}
+
+template <typename _lhs, typename _rhs>
+constexpr bool MulScalar::IsValidDimension(const _lhs&, const _rhs&) const {
+  return true;
+}
+
+template <typename _lhs, typename _rhs>
+auto MulScalar::Packet(const _lhs& _l,
+                       const _rhs& _r,
+                       std::size_t i,
+                       std::size_t j) const {
+  const auto packet = _l.Packet(i, j);
+  return packet * decltype(packet)::Broadcast(_r);
+}
+
+template <typename _lhs, typename _rhs>
+constexpr std::size_t MulMatrix::Rows(const _lhs& _l, const _rhs&) const {
+  return _l.Rows();
+}
+
+template <typename _lhs, typename _rhs>
+constexpr std::size_t MulMatrix::Cols(const _lhs&, const _rhs& _r) const {
+  return _r.Cols();
+}
+
+template <typename _lhs, typename _rhs>
+constexpr bool MulMatrix::IsValidDimension(const _lhs& _l,
+                                           const _rhs& _r) const {
+  return _l.Cols() == _r.Rows();
+}
+
 template <typename _lhs, typename _rhs>
 constexpr auto MulMatrix::operator()(const _lhs& _l,
                                      const _rhs& _r,
@@ -29,13 +78,49 @@ constexpr auto MulMatrix::operator()(const _lhs& _l,
 
   using value_type = decltype(std::declval<const _lhs&>()(0, 0) *
                               std::declval<const _rhs&>()(0, 0));
-  using value_type = decltype(std::declval<const _lhs&>()(0, 0) *
-                              std::declval<const _rhs&>()(0, 0));
 
-  std::size_t inner_dim = _lhs::cols;  // = rhs_type::rows
-  value_type sum        = _l(i, 0) * _r(0, j);
-  for (std::size_t k = 1; k < inner_dim; k++) {
-    sum += _l(i, k) * _r(k, j);
+  using lhs_core = typename _lhs::core_impl;
+  using rhs_core = typename _rhs::core_impl;
+
+  if constexpr (Traits::Core::is_structured_v<lhs_core> ||
+                Traits::Core::is_structured_v<rhs_core>) {
+    constexpr std::size_t l_lower = Traits::Core::lower_bandwidth_v<lhs_core>;
+    constexpr std::size_t l_upper = Traits::Core::upper_bandwidth_v<lhs_core>;
+    constexpr std::size_t r_lower = Traits::Core::lower_bandwidth_v<rhs_core>;
+    constexpr std::size_t r_upper = Traits::Core::upper_bandwidth_v<rhs_core>;
+
+    const std::size_t inner_dim = _l.Cols();  // = _r.Rows()
+
+    // One past `x + band`, clamped to the inner dimension.
+    const auto until = [inner_dim](std::size_t x, std::size_t band) {
+      return band < inner_dim && x < inner_dim - band ? x + band + 1
+                                                      : inner_dim;
+    };
+
+    // Row `i` of `_l` may be non-zero from column `i - l_lower` to
+    // `i + l_upper`, column `j` of `_r` from row `j - r_upper` to
+    // `j + r_lower`.
+    const std::size_t begin =
+        std::max(i > l_lower ? i - l_lower : 0, j > r_upper ? j - r_upper : 0);
+    const std::size_t end = std::min(until(i, l_upper), until(j, r_lower));
+
+    value_type sum{};
+    for (std::size_t k = begin; k < end; k++) {
+      sum += _l(i, k) * _r(k, j);
+    }
+    return sum;
+  }
+
+  value_type sum = _l(i, 0) * _r(0, j);
+  if constexpr (_lhs::cols > 0 && Traits::Size::is_unrolled_v<_lhs::cols>) {
+    // Same summation order as the loop below, without the counter.
+    Kernel::Unroll<_lhs::cols - 1>(
+        [&](auto k) { sum += _l(i, k + 1) * _r(k + 1, j); });
+  } else {
+    std::size_t inner_dim = _l.Cols();  // = _r.Rows()
+    for (std::size_t k = 1; k < inner_dim; k++) {
+      sum += _l(i, k) * _r(k, j);
+    }
   }
   return sum;
 }
@@ -45,27 +130,99 @@ constexpr auto MulMatrix::operator()(const _lhs& _l,
 namespace Sglty::Op::Arthm {
 
 template <typename _lhs, typename _rhs>
-constexpr auto Mul(const _lhs& _l, const _rhs& _r)
-    -> std::enable_if_t<Traits::Expr::is_valid_v<_lhs> &&
-                            std::is_arithmetic_v<_rhs>,
-                        Expr::Binary<_lhs, _rhs, Expr::MulScalar>> {
-  return Expr::Binary<_lhs, _rhs, Expr::MulScalar>(_l, _r);
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_lhs>> &&
+                            std::is_arithmetic_v<std::decay_t<_rhs>>,
+                        Impl::scaled_t<_lhs, _rhs>> {
+  if constexpr (Impl::Scaled<_lhs, _rhs>::fold) {
+    // `(x * s) * t` is `x * (s * t)`, with `x` moved out of a temporary.
+    return Impl::scaled_t<_lhs, _rhs>(std::forward<_lhs>(_l)._l,
+                                      _l._r * _r);
+  } else {
+    return Impl::scaled_t<_lhs, _rhs>(std::forward<_lhs>(_l),
+                                      std::forward<_rhs>(_r));
+  }
 }
 
 template <typename _lhs, typename _rhs>
-constexpr auto Mul(const _lhs& _l, const _rhs& _r)
-    -> std::enable_if_t<Traits::Expr::is_valid_v<_rhs> &&
-                            std::is_arithmetic_v<_lhs>,
-                        Expr::Binary<_rhs, _lhs, Expr::MulScalar>> {
-  return Expr::Binary<_rhs, _lhs, Expr::MulScalar>(_r, _l);
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_rhs>> &&
+                            std::is_arithmetic_v<std::decay_t<_lhs>>,
+                        Impl::scaled_t<_rhs, _lhs>> {
+  if constexpr (Impl::Scaled<_rhs, _lhs>::fold) {
+    // `(x * s) * t` is `x * (s * t)`, with `x` moved out of a temporary.
+    return Impl::scaled_t<_rhs, _lhs>(std::forward<_rhs>(_r)._l,
+                                      _r._r * _l);
+  } else {
+    return Impl::scaled_t<_rhs, _lhs>(std::forward<_rhs>(_r),
+                                      std::forward<_lhs>(_l));
+  }
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_lhs>> &&
+                            Traits::Expr::is_valid_v<std::decay_t<_rhs>> &&
+                            !Impl::is_mixed_product_v<_lhs, _rhs> &&
+                            !Impl::FoldedProduct<_lhs, _rhs>::value,
+                        Expr::Binary<Impl::product_operand_t<_lhs, _lhs, _rhs>,
+                                     Impl::product_operand_t<_rhs, _lhs, _rhs>,
+                                     Expr::MulMatrix>> {
+  return Expr::Binary<Impl::product_operand_t<_lhs, _lhs, _rhs>,
+                      Impl::product_operand_t<_rhs, _lhs, _rhs>,
+                      Expr::MulMatrix>(std::forward<_lhs>(_l),
+                                       std::forward<_rhs>(_r));
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Impl::FoldedProduct<_lhs, _rhs>::value,
+                        typename Impl::FoldedProduct<_lhs, _rhs>::type> {
+  using folded = Impl::FoldedProduct<_lhs, _rhs>;
+
+  Expr::Impl::CheckDimension<Expr::MulMatrix>(_l, _r);
+  if constexpr (folded::zero) {
+    // A product with a zero is a zero, without reading the other operand.
+    return typename folded::type(Expr::MulMatrix{}.Rows(_l, _r),
+                                 Expr::MulMatrix{}.Cols(_l, _r));
+  } else if constexpr (folded::right_identity) {
+    return std::forward<_lhs>(_l);
+  } else {
+    return std::forward<_rhs>(_r);
+  }
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto Mul(_lhs&& _l, _rhs&&)
+    -> typename Impl::UnshapedProduct<_lhs, _rhs>::type {
+  using type = typename Impl::UnshapedProduct<_lhs, _rhs>::type;
+
+  if constexpr (std::is_same_v<std::decay_t<_rhs>, Expr::UnshapedZero>) {
+    return type(_l.Rows(), _l.Cols());
+  } else {
+    return std::forward<_lhs>(_l);
+  }
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto Mul(_lhs&&, _rhs&& _r)
+    -> typename Impl::UnshapedProduct<_rhs, _lhs>::type {
+  using type = typename Impl::UnshapedProduct<_rhs, _lhs>::type;
+
+  if constexpr (std::is_same_v<std::decay_t<_lhs>, Expr::UnshapedZero>) {
+    return type(_r.Rows(), _r.Cols());
+  } else {
+    return std::forward<_rhs>(_r);
+  }
 }
 
 template <typename _lhs, typename _rhs>
-constexpr auto Mul(const _lhs& _l, const _rhs& _r)
-    -> std::enable_if_t<Traits::Expr::is_valid_v<_lhs> &&
-                            Traits::Expr::is_valid_v<_rhs>,
-                        Expr::Binary<_lhs, _rhs, Expr::MulMatrix>> {
-  return Expr::Binary<_lhs, _rhs, Expr::MulMatrix>(_l, _r);
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Impl::is_mixed_product_v<_lhs, _rhs>,
+                        Impl::mixed_product_t<_lhs, _rhs>> {
+  using value_type = Alg::Impl::promoted_t<_lhs, _rhs>;
+  return Mul(Alg::Cast<value_type>(std::forward<_lhs>(_l)),
+             Alg::Cast<value_type>(std::forward<_rhs>(_r)));
 }
 
 }  // namespace Sglty::Op::Arthm
@@ -73,11 +230,12 @@ constexpr auto Mul(const _lhs& _l, const _rhs& _r)
 namespace Sglty::Types {
 
 template <typename _lhs, typename _rhs>
-constexpr auto operator*(const _lhs& _l, const _rhs& _r)
-    -> std::enable_if_t<Traits::Expr::is_valid_v<_lhs> ||
-                            Traits::Expr::is_valid_v<_rhs>,
-                        decltype(Op::Arthm::Mul(_l, _r))> {
-  return Op::Arthm::Mul(_l, _r);
+constexpr auto operator*(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_lhs>> ||
+                            Traits::Expr::is_valid_v<std::decay_t<_rhs>>,
+                        decltype(Op::Arthm::Mul(std::forward<_lhs>(_l),
+                                                std::forward<_rhs>(_r)))> {
+  return Op::Arthm::Mul(std::forward<_lhs>(_l), std::forward<_rhs>(_r));
 }
 
 }  // namespace Sglty::Types
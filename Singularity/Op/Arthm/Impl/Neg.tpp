@@ -3,10 +3,24 @@
 #include "../Neg.hpp"
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
+
 #include "../../../Expr/Unary.hpp"
+#include "../../../Traits/Expr.hpp"
 
 namespace Sglty::Expr {
 
+template <typename _operand>
+constexpr std::size_t Neg::Rows(const _operand& op) const {
+  return op.Rows();
+}
+
+template <typename _operand>
+constexpr std::size_t Neg::Cols(const _operand& op) const {
+  return op.Cols();
+}
+
 template <typename _operand>
 constexpr auto Neg::operator()(const _operand& op,
                                std::size_t i,
@@ -14,22 +28,43 @@ constexpr auto Neg::operator()(const _operand& op,
   return -op(i, j);
 }
 
+template <typename _operand>
+auto Neg::Packet(const _operand& op, std::size_t i, std::size_t j) const {
+  return -op.Packet(i, j);
+}
+
 }  // namespace Sglty::Expr
 
 namespace Sglty::Op::Arthm {
 
+namespace Impl {
+
+template <typename _expr>
+struct IsNeg : std::false_type {};
+
 template <typename _operand>
-constexpr auto Neg(const _operand& _o) {
-  return Expr::Unary<_operand, Expr::Neg>(_o);
+struct IsNeg<Expr::Unary<_operand, Expr::Neg>> : std::true_type {};
+
+}  // namespace Impl
+
+template <typename _operand>
+constexpr decltype(auto) Neg(_operand&& _o) {
+  if constexpr (Impl::IsNeg<std::decay_t<_operand>>::value) {
+    // `-(-x)` is `x`, kept the way the inner expression holds it.
+    return Expr::Impl::Operand(std::forward<_operand>(_o));
+  } else {
+    return Expr::Unary<Traits::Expr::nested_t<_operand>, Expr::Neg>(
+        std::forward<_operand>(_o));
+  }
 }
 
 }  // namespace Sglty::Op::Arthm
 
 namespace Sglty::Types {
 
-template <typename _operand>
-constexpr auto operator-(const _operand& _o) {
-  return Op::Arthm::Neg(_o);
+template <typename _operand, typename>
+constexpr decltype(auto) operator-(_operand&& _o) {
+  return Op::Arthm::Neg(std::forward<_operand>(_o));
 }
 
 }  // namespace Sglty::Types
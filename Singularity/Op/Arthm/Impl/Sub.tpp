@@ -3,8 +3,16 @@
 #include "../Sub.hpp"
 
 #include <type_traits>
+#include <utility>
 
 #include "../../../Expr/Binary.hpp"
+#include "../../../Expr/Constant.hpp"
+#include "../../../Expr/Unary.hpp"
+#include "../../Alg/Cast.hpp"
+#include "../Mul.hpp"
+#include "../Neg.hpp"
+#include "../Add.hpp"
+#include "../../../Traits/Expr.hpp"
 
 namespace Sglty::Expr {
 
@@ -21,22 +29,88 @@ constexpr auto Sub::operator()(const _lhs& _l,
   return _l(i, j) - _r(i, j);
 }
 
+template <typename _lhs, typename _rhs>
+constexpr std::size_t Sub::Rows(const _lhs& _l, const _rhs&) const {
+  return _l.Rows();
+}
+
+template <typename _lhs, typename _rhs>
+constexpr std::size_t Sub::Cols(const _lhs& _l, const _rhs&) const {
+  return _l.Cols();
+}
+
+template <typename _lhs, typename _rhs>
+constexpr bool Sub::IsValidDimension(const _lhs& _l, const _rhs& _r) const {
+  return _l.Rows() == _r.Rows() && _l.Cols() == _r.Cols();
+}
+
+template <typename _lhs, typename _rhs>
+auto Sub::Packet(const _lhs& _l,
+                 const _rhs& _r,
+                 std::size_t i,
+                 std::size_t j) const {
+  return _l.Packet(i, j) - _r.Packet(i, j);
+}
+
 }  // namespace Sglty::Expr
 
 namespace Sglty::Op::Arthm {
 
 template <typename _lhs, typename _rhs>
-constexpr auto Sub(const _lhs& _l, const _rhs& _r) {
-  return Expr::Binary<_lhs, _rhs, Expr::Add>(_l, _r);
+constexpr decltype(auto) Sub(_lhs&& _l, _rhs&& _r) {
+  using lhs_type = std::decay_t<_lhs>;
+  using rhs_type = std::decay_t<_rhs>;
+
+  if constexpr (Expr::Impl::IsUnshaped<lhs_type>::value ||
+                Expr::Impl::IsUnshaped<rhs_type>::value) {
+    static_assert(!Expr::Impl::IsUnshaped<lhs_type>::value ||
+                      !Expr::Impl::IsUnshaped<rhs_type>::value,
+                  "Error: neither operand has a shape.");
+    if constexpr (Expr::Impl::IsUnshaped<rhs_type>::value) {
+      return Sub(std::forward<_lhs>(_l), _r.Shape(_l));
+    } else {
+      return Sub(_l.Shape(_r), std::forward<_rhs>(_r));
+    }
+  } else if constexpr (Alg::Impl::IsMixed<Expr::Sub,
+                                   std::decay_t<_lhs>,
+                                   std::decay_t<_rhs>>::value) {
+    using value_type = Alg::Impl::promoted_t<_lhs, _rhs>;
+    return Sub(Alg::Cast<value_type>(std::forward<_lhs>(_l)),
+               Alg::Cast<value_type>(std::forward<_rhs>(_r)));
+  } else if constexpr (Expr::Impl::IsZeroSum<Expr::Sub, lhs_type, rhs_type>::
+                           value) {
+    // `x - 0` is `x`, without reading the zero.
+    Expr::Impl::CheckDimension<Expr::Sub>(_l, _r);
+    return Expr::Impl::Nest(std::forward<_lhs>(_l));
+  } else if constexpr (Expr::Impl::IsZeroSum<Expr::Sub, rhs_type, lhs_type>::
+                           value) {
+    // `0 - x` is `-x`.
+    Expr::Impl::CheckDimension<Expr::Sub>(_l, _r);
+    return Neg(std::forward<_rhs>(_r));
+  } else if constexpr (Impl::IsNeg<std::decay_t<_rhs>>::value) {
+    // `x - (-y)` is `x + y`.
+    return Add(std::forward<_lhs>(_l),
+               Expr::Impl::Operand(std::forward<_rhs>(_r)));
+  } else if constexpr (Impl::IsNegatedProduct<std::decay_t<_rhs>>::value) {
+    // `c - a * b` is `c + a * b * -1`, accumulated in place.
+    using value_type = typename std::decay_t<_rhs>::core_impl::value_type;
+    return Add(std::forward<_lhs>(_l),
+               Mul(std::forward<_rhs>(_r), value_type(-1)));
+  } else {
+    return Expr::Binary<Traits::Expr::nested_t<_lhs>,
+                        Traits::Expr::nested_t<_rhs>,
+                        Expr::Sub>(std::forward<_lhs>(_l),
+                                   std::forward<_rhs>(_r));
+  }
 }
 
 }  // namespace Sglty::Op::Arthm
 
 namespace Sglty::Types {
 
-template <typename _lhs, typename _rhs>
-constexpr auto operator-(const _lhs& _l, const _rhs& _r) {
-  return Op::Arthm::Sub(_l, _r);
+template <typename _lhs, typename _rhs, bool _enable, typename>
+constexpr decltype(auto) operator-(_lhs&& _l, _rhs&& _r) {
+  return Op::Arthm::Sub(std::forward<_lhs>(_l), std::forward<_rhs>(_r));
 }
 
 }  // namespace Sglty::Types
@@ -1,7 +1,17 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
+#include <utility>
+
+#include "../../Expr/Binary.hpp"
+#include "../../Expr/Constant.hpp"
+#include "../Alg/Cast.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
+#include "../../Traits/Op.hpp"
+#include "../../Traits/Size.hpp"
 
 namespace Sglty::Expr {
 
@@ -31,10 +41,45 @@ struct MulScalar {
   /**
    * @brief Resulting core implementation.
    *
-   * Same as the matrix operand's core implementation.
+   * Same as the matrix operand's core implementation, or the owning core a
+   * view evaluates into.
+   */
+  template <typename _lhs, typename _rhs>
+  using core_impl = Traits::Core::plain_t<typename _lhs::core_impl>;
+
+  /**
+   * @brief Always valid—scaling preserves the matrix operand's core.
+   */
+  template <typename, typename>
+  constexpr static bool is_valid_core_impl = true;
+
+  /**
+   * @brief Always valid—scaling does not change dimensions.
+   */
+  template <typename, typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Runtime row count of the result.
+   *
+   * Equals `rows` unless an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr std::size_t Rows(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Runtime column count of the result.
+   *
+   * Equals `cols` unless an operand is runtime-sized.
    */
   template <typename _lhs, typename _rhs>
-  using core_impl = typename _lhs::core_impl;
+  constexpr std::size_t Cols(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Always valid—scaling does not change dimensions.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr bool IsValidDimension(const _lhs& _l, const _rhs& _r) const;
 
   /**
    * @brief Evaluates scalar multiplication at the given position.
@@ -52,6 +97,40 @@ struct MulScalar {
                             const _rhs& _r,
                             std::size_t i,
                             std::size_t j) const;
+
+  /**
+   * @brief Packet form is available when scaling does not widen the matrix
+   * element type.
+   *
+   * Scalars of a wider type (e.g. `double` on a `float` matrix) are computed
+   * in the wider type by `operator()`, so they stay element-wise to keep
+   * results identical.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static bool vectorizable = std::is_same_v<
+      std::common_type_t<typename _lhs::core_impl::value_type, _rhs>,
+      typename _lhs::core_impl::value_type>;
+
+  /**
+   * @brief Each result element only reads the matrix at its own position.
+   */
+  template <typename, typename>
+  constexpr static bool elementwise = true;
+
+  /**
+   * @brief Evaluates scalar multiplication of a packet at a given position.
+   *
+   * @param _l Matrix operand.
+   * @param _r Scalar operand, broadcast to every lane.
+   * @param i Row index of the first lane.
+   * @param j Column index of the first lane.
+   * @return The product `_l.Packet(i, j) * _r`.
+   */
+  template <typename _lhs, typename _rhs>
+  auto Packet(const _lhs& _l,
+              const _rhs& _r,
+              std::size_t i,
+              std::size_t j) const;
 };
 
 /**
@@ -60,6 +139,14 @@ struct MulScalar {
  * Represents matrix-matrix multiplication. Both operands must be valid
  * matrix expressions and have compatible shapes.
  *
+ * A sparse operand (see `Sglty::Traits::Core::is_sparse_v`) may be multiplied
+ * with a dense one of the same value type; the result then uses the dense
+ * operand's core. So may a structured one (see
+ * `Sglty::Traits::Core::is_structured_v`) with any other, and each element
+ * then only sums over the inner indices where both operands may be non-zero:
+ * one term for a diagonal operand, half of them on average for a triangular
+ * one.
+ *
  * Used as `op_type` in a `Binary<_lhs, _rhs, MulMatrix>` expression node.
  */
 struct MulMatrix {
@@ -82,22 +169,31 @@ struct MulMatrix {
   /**
    * @brief Resulting core implementation.
    *
-   * Rebinds the left-hand side core to the new shape.
+   * Rebinds the left-hand side core to the new shape, the right-hand side
+   * core for sparse x dense products, or the band of a product of bands (see
+   * `Sglty::Traits::Core::product_t`).
    */
   template <typename _lhs, typename _rhs>
-  using core_impl =
-      typename _lhs::core_impl::template core_rebind_size<rows<_lhs, _rhs>,
-                                                          cols<_lhs, _rhs>>;
+  using core_impl = Traits::Core::product_t<typename _lhs::core_impl,
+                                            typename _rhs::core_impl>;
 
   /**
    * @brief Verifies that both operands use compatible core bases.
    *
-   * Required so the result can be bound to a shared underlying core.
+   * Required so the result can be bound to a shared underlying core. Mixed
+   * sparse, dense and structured operands only need to share their value
+   * type.
    */
   template <typename _lhs, typename _rhs>
   constexpr static bool is_valid_core_impl =
       std::is_same_v<typename _lhs::core_impl::core_base,
-                     typename _rhs::core_impl::core_base>;
+                     typename _rhs::core_impl::core_base> ||
+      ((Traits::Core::is_sparse_v<typename _lhs::core_impl> !=
+            Traits::Core::is_sparse_v<typename _rhs::core_impl> ||
+        Traits::Core::is_structured_v<typename _lhs::core_impl> ||
+        Traits::Core::is_structured_v<typename _rhs::core_impl>) &&
+       std::is_same_v<typename _lhs::core_impl::type_traits::value_type,
+                      typename _rhs::core_impl::type_traits::value_type>);
 
   /**
    * @brief Verifies that matrix multiplication is shape-compatible.
@@ -107,10 +203,78 @@ struct MulMatrix {
   template <typename _lhs, typename _rhs>
   constexpr static bool is_valid_dimension = (_lhs::cols == _rhs::rows);
 
+  /**
+   * @brief Runtime row count of the result.
+   *
+   * Equals `rows` unless an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr std::size_t Rows(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Runtime column count of the result.
+   *
+   * Equals `cols` unless an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr std::size_t Cols(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Runtime counterpart of `is_valid_dimension`, checked by `Binary`
+   * when an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr bool IsValidDimension(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Inner indices at which a row of `_lhs` and a column of `_rhs` may
+   * both be non-zero: the narrowest of the inner dimension and the widths of
+   * both bands (see `Sglty::Traits::Core::lower_bandwidth_v`).
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static std::size_t terms = std::min(
+      {_lhs::cols,
+       Traits::Size::SaturatedAdd(
+           Traits::Size::SaturatedAdd(
+               Traits::Core::lower_bandwidth_v<typename _lhs::core_impl>,
+               Traits::Core::upper_bandwidth_v<typename _lhs::core_impl>),
+           1),
+       Traits::Size::SaturatedAdd(
+           Traits::Size::SaturatedAdd(
+               Traits::Core::lower_bandwidth_v<typename _rhs::core_impl>,
+               Traits::Core::upper_bandwidth_v<typename _rhs::core_impl>),
+           1)});
+
+  /**
+   * @brief Scalar operations per output element: one multiply and one add
+   * per inner index that may be non-zero (see `terms`).
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static std::size_t cost =
+      Traits::Size::SaturatedMul(2, terms<_lhs, _rhs>);
+
+  /**
+   * @brief Every row of `_lhs` and column of `_rhs` is read for a whole row
+   * or column of results.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static Access access = Access::Reuse;
+
+  /**
+   * @brief Operand elements read per output element (a row and a column).
+   *
+   * Being greater than one marks `MulMatrix` as a product, so nested products
+   * get materialized before use (see
+   * `Sglty::Traits::Op::evaluate_before_use_v`).
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static std::size_t reads = _lhs::cols;
+
   /**
    * @brief Computes the (i, j) element of the matrix product.
    *
-   * Performs the dot product of row `i` of lhs and column `j` of rhs.
+   * Performs the dot product of row `i` of lhs and column `j` of rhs, over
+   * the inner indices within the bands of both when either is structured.
    *
    * @param _l Left-hand side matrix.
    * @param _r Right-hand side matrix.
@@ -125,37 +289,319 @@ struct MulMatrix {
                             std::size_t j) const;
 };
 
+template <typename>
+struct Materialized;
+
 }  // namespace Sglty::Expr
 
+namespace Sglty::Op::Arthm::Impl {
+
+/**
+ * @brief Storage type of a `MulMatrix` operand.
+ *
+ * Operands that should be evaluated before use (nested products) are stored
+ * as `Expr::Materialized`; everything else follows
+ * `Sglty::Traits::Expr::nested_t`. The cost model is only consulted when both
+ * sides are matrix expressions, so that the scalar overloads of `Mul` can be
+ * discarded without instantiating it.
+ *
+ * @tparam _operand The forwarded operand type.
+ * @tparam _lhs     The forwarded left-hand side type.
+ * @tparam _rhs     The forwarded right-hand side type.
+ */
+template <typename _operand, typename _lhs, typename _rhs, typename = void>
+struct ProductOperand {
+  using type = Traits::Expr::nested_t<_operand>;
+};
+
+template <typename _operand, typename _lhs, typename _rhs>
+struct ProductOperand<
+    _operand,
+    _lhs,
+    _rhs,
+    std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_lhs>> &&
+                     Traits::Expr::is_valid_v<std::decay_t<_rhs>>>>
+    : std::conditional<
+          Traits::Op::evaluate_before_use_v<Expr::MulMatrix,
+                                            std::decay_t<_operand>,
+                                            std::decay_t<_lhs>,
+                                            std::decay_t<_rhs>>,
+          Expr::Materialized<std::decay_t<_operand>>,
+          Traits::Expr::nested_t<_operand>> {};
+
+template <typename _operand, typename _lhs, typename _rhs>
+using product_operand_t = typename ProductOperand<_operand, _lhs, _rhs>::type;
+
+template <typename _expr, typename _scalar>
+struct IsScaledBy : std::false_type {};
+
+template <typename _operand, typename _scalar>
+struct IsScaledBy<Expr::Binary<_operand, _scalar, Expr::MulScalar>, _scalar>
+    : std::is_same<decltype(std::declval<_scalar>() * std::declval<_scalar>()),
+                   _scalar> {};
+
+/**
+ * @brief Result of scaling `_operand` by `_scalar`.
+ *
+ * An operand that is already scaled by a scalar of the same type folds both
+ * factors, `(x * s) * t` to `x * (s * t)`, and keeps its node type. Factors
+ * whose product would be promoted (e.g. `short`) are not folded. For floating
+ * point the combined factor is rounded once, so results may differ from the
+ * two separate products in the last bit.
+ *
+ * @tparam _operand The forwarded matrix operand type.
+ * @tparam _scalar  The forwarded scalar type.
+ */
+template <typename _operand, typename _scalar, typename = void>
+struct Scaled {
+  using type = Expr::Binary<Traits::Expr::nested_t<_operand>,
+                            Traits::Expr::nested_t<_scalar>,
+                            Expr::MulScalar>;
+
+  static constexpr bool fold = false;
+};
+
+template <typename _operand, typename _scalar>
+struct Scaled<_operand,
+              _scalar,
+              std::enable_if_t<IsScaledBy<std::decay_t<_operand>,
+                                          std::decay_t<_scalar>>::value>> {
+  using type = std::decay_t<_operand>;
+
+  static constexpr bool fold = true;
+};
+
+template <typename _operand, typename _scalar>
+using scaled_t = typename Scaled<_operand, _scalar>::type;
+
+/**
+ * @brief Whether `_lhs * _rhs` multiplies matrices of different element
+ * types, which `Mul` promotes (see `Sglty::Op::Alg::Impl::IsMixed`).
+ */
+template <typename _lhs, typename _rhs>
+constexpr inline bool is_mixed_product_v =
+    Alg::Impl::IsMixed<Expr::MulMatrix,
+                       std::decay_t<_lhs>,
+                       std::decay_t<_rhs>>::value;
+
+/**
+ * @brief Whether `_lhs * _rhs` folds without being computed: a product with
+ * an `Expr::Zero` is an `Expr::Zero` of the product's shape, and a product
+ * with an identity (an `Expr::Identity` or the `Matrix<Core::Identity>` of
+ * `Matrix::Identity()`) is the other operand, when that already has the
+ * core of the product.
+ *
+ * Provides `type`, the folded result.
+ *
+ * @tparam _lhs The forwarded left-hand side type.
+ * @tparam _rhs The forwarded right-hand side type.
+ */
+template <typename _lhs, typename _rhs, typename = void>
+struct FoldedProduct : std::false_type {};
+
+template <typename _lhs, typename _rhs>
+struct FoldedProduct<
+    _lhs,
+    _rhs,
+    std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_lhs>> &&
+                     Traits::Expr::is_valid_v<std::decay_t<_rhs>> &&
+                     !is_mixed_product_v<_lhs, _rhs>>> {
+ private:
+  using lhs_type     = std::decay_t<_lhs>;
+  using rhs_type     = std::decay_t<_rhs>;
+  using product_core = typename Expr::MulMatrix::core_impl<lhs_type, rhs_type>;
+
+ public:
+  static constexpr bool zero = Expr::Impl::IsZero<lhs_type>::value ||
+                               Expr::Impl::IsZero<rhs_type>::value;
+
+  static constexpr bool left_identity =
+      Expr::Impl::IsIdentity<lhs_type>::value &&
+      std::is_same_v<product_core, typename rhs_type::core_impl>;
+
+  static constexpr bool right_identity =
+      Expr::Impl::IsIdentity<rhs_type>::value &&
+      std::is_same_v<product_core, typename lhs_type::core_impl>;
+
+  static constexpr bool value =
+      (zero || left_identity || right_identity) &&
+      Expr::MulMatrix::is_valid_core_impl<lhs_type, rhs_type> &&
+      Expr::MulMatrix::is_valid_dimension<lhs_type, rhs_type>;
+
+  using type = std::conditional_t<
+      zero,
+      Expr::Zero<typename Expr::Impl::ShapedCore<product_core>::type>,
+      std::conditional_t<right_identity,
+                         Traits::Expr::nested_t<_lhs>,
+                         Traits::Expr::nested_t<_rhs>>>;
+};
+
+/**
+ * @brief Result of `_operand * _unshaped` (or `_unshaped * _operand`), for a
+ * placeholder `_unshaped` (see `Sglty::Expr::Unshaped`).
+ *
+ * A product with `Sglty::Identity()` is `_operand`, and a product with
+ * `Sglty::Zero()` an `Expr::Zero` of the shape of `_operand`; other
+ * placeholders have no shape in a product.
+ */
+template <typename _operand, typename _unshaped, typename = void>
+struct UnshapedProduct {};
+
+template <typename _operand, typename _unshaped>
+struct UnshapedProduct<
+    _operand,
+    _unshaped,
+    std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_operand>> &&
+                     Expr::Impl::IsUnshaped<std::decay_t<_unshaped>>::value>> {
+ private:
+  using operand_type  = std::decay_t<_operand>;
+  using unshaped_type = std::decay_t<_unshaped>;
+
+ public:
+  static_assert(std::is_same_v<unshaped_type, Expr::UnshapedZero> ||
+                    std::is_same_v<unshaped_type, Expr::UnshapedIdentity>,
+                "Error: only `Sglty::Zero()` and `Sglty::Identity()` take "
+                "the shape of the other operand of a product.");
+
+  using type = std::conditional_t<
+      std::is_same_v<unshaped_type, Expr::UnshapedZero>,
+      Expr::Zero<Expr::Impl::shaped_core_t<
+          operand_type,
+          typename operand_type::core_impl::value_type>>,
+      Traits::Expr::nested_t<_operand>>;
+};
+
+/**
+ * @brief Recognizes the product term of a `GemmAccumulate`: `a * b` or
+ * `a * b * alpha`.
+ *
+ * A scaled product only qualifies when `alpha` does not widen the element
+ * type, so the kernel can take it as an element.
+ *
+ * Provides `product_type`, `Product()` for the `a * b` node and
+ * `Factor<_Tp>()` for `alpha` (1 for an unscaled product).
+ *
+ * @tparam _expr The candidate expression type.
+ */
+template <typename _expr, typename _enable = void>
+struct ProductTerm : std::false_type {};
+
+template <typename _lhs, typename _rhs>
+struct ProductTerm<Expr::Binary<_lhs, _rhs, Expr::MulMatrix>>
+    : std::true_type {
+  using product_type = Expr::Binary<_lhs, _rhs, Expr::MulMatrix>;
+
+  static constexpr const product_type& Product(const product_type& _e) {
+    return _e;
+  }
+
+  template <typename _Tp>
+  static constexpr _Tp Factor(const product_type&) {
+    return _Tp{1};
+  }
+};
+
+template <typename _product, typename _scalar>
+struct ProductTerm<
+    Expr::Binary<_product, _scalar, Expr::MulScalar>,
+    std::enable_if_t<
+        Traits::Expr::is_product_v<
+            std::remove_cv_t<std::remove_reference_t<_product>>> &&
+        Expr::MulScalar::vectorizable<
+            std::remove_cv_t<std::remove_reference_t<_product>>,
+            _scalar>>>
+    : ProductTerm<std::remove_cv_t<std::remove_reference_t<_product>>> {
+  using scaled_type  = Expr::Binary<_product, _scalar, Expr::MulScalar>;
+  using product_type = std::remove_cv_t<std::remove_reference_t<_product>>;
+
+  static constexpr const product_type& Product(const scaled_type& _e) {
+    return _e._l;
+  }
+
+  template <typename _Tp>
+  static constexpr _Tp Factor(const scaled_type& _e) {
+    return static_cast<_Tp>(_e._r);
+  }
+};
+
+/**
+ * @brief Whether `_expr` can be the product term of a `GemmAccumulate` node:
+ * a (scaled) product of non-sparse operands with arithmetic elements.
+ */
+template <typename _expr, typename _enable = void>
+struct IsAccumulateTerm : std::false_type {};
+
+template <typename _expr>
+struct IsAccumulateTerm<_expr, std::enable_if_t<ProductTerm<_expr>::value>> {
+ private:
+  using product_type = typename ProductTerm<_expr>::product_type;
+  using lhs_core     = typename product_type::lhs_type::core_impl;
+  using rhs_core     = typename product_type::rhs_type::core_impl;
+
+ public:
+  static constexpr bool value =
+      !Traits::Core::is_sparse_v<lhs_core> &&
+      !Traits::Core::is_sparse_v<rhs_core> &&
+      std::is_arithmetic_v<typename product_type::core_impl::value_type>;
+};
+
+/**
+ * @brief Whether `_expr` can be the scaled operand of an `Axpy` node: `x * s`
+ * over dense floating-point elements, where `s` does not widen them.
+ *
+ * Sparse sums keep their `Expr::Add` node, which only visits stored entries.
+ */
+template <typename _expr>
+struct IsAxpyTerm : std::false_type {};
+
+template <typename _operand, typename _scalar>
+struct IsAxpyTerm<Expr::Binary<_operand, _scalar, Expr::MulScalar>>
+    : std::bool_constant<
+          !Traits::Core::is_sparse_v<typename Expr::Binary<
+              _operand,
+              _scalar,
+              Expr::MulScalar>::core_impl> &&
+          std::is_floating_point_v<typename Expr::Binary<
+              _operand,
+              _scalar,
+              Expr::MulScalar>::core_impl::value_type> &&
+          Expr::MulScalar::vectorizable<
+              std::remove_cv_t<std::remove_reference_t<_operand>>,
+              _scalar>> {};
+
+}  // namespace Sglty::Op::Arthm::Impl
+
 namespace Sglty::Op::Arthm {
 
 /**
  * @brief Multiplies a matrix expression with a scalar (matrix * scalar).
  *
  * Enabled if the left-hand side is a matrix expression and the right-hand side
- * is an arithmetic scalar.
+ * is an arithmetic scalar. Repeated scaling is folded into one factor (see
+ * `Impl::Scaled`).
  *
  * @return A Binary expression using `MulScalar`.
  */
 template <typename _lhs, typename _rhs>
-constexpr auto Mul(const _lhs& _l, const _rhs& _r)
-    -> std::enable_if_t<Traits::Expr::is_valid_v<_lhs> &&
-                            std::is_arithmetic_v<_rhs>,
-                        Expr::Binary<_lhs, _rhs, Expr::MulScalar>>;
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_lhs>> &&
+                            std::is_arithmetic_v<std::decay_t<_rhs>>,
+                        Impl::scaled_t<_lhs, _rhs>>;
 
 /**
  * @brief Multiplies a scalar with a matrix expression (scalar * matrix).
  *
  * Enabled if the right-hand side is a matrix expression and the left-hand side
- * is an arithmetic scalar.
+ * is an arithmetic scalar. Repeated scaling is folded into one factor (see
+ * `Impl::Scaled`).
  *
  * @return A Binary expression using `MulScalar`.
  */
 template <typename _lhs, typename _rhs>
-constexpr auto Mul(const _lhs& _l, const _rhs& _r)
-    -> std::enable_if_t<Traits::Expr::is_valid_v<_rhs> &&
-                            std::is_arithmetic_v<_lhs>,
-                        Expr::Binary<_rhs, _lhs, Expr::MulScalar>>;
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_rhs>> &&
+                            std::is_arithmetic_v<std::decay_t<_lhs>>,
+                        Impl::scaled_t<_rhs, _lhs>>;
 
 /**
  * @brief Multiplies two matrix expressions.
@@ -163,16 +609,99 @@ constexpr auto Mul(const _lhs& _l, const _rhs& _r)
  * Enabled only if both operands are valid expressions.
  * Performs standard matrix multiplication using `MulMatrix`.
  *
+ * Operands that contain a product themselves are evaluated once into an
+ * `Expr::Materialized` temporary here, so `(a * b) * c` costs two products
+ * instead of one product per output element.
+ *
  * @return A Binary expression using `MulMatrix`.
  */
 template <typename _lhs, typename _rhs>
-constexpr auto Mul(const _lhs& _l, const _rhs& _r)
-    -> std::enable_if_t<Traits::Expr::is_valid_v<_lhs> &&
-                            Traits::Expr::is_valid_v<_rhs>,
-                        Expr::Binary<_lhs, _rhs, Expr::MulMatrix>>;
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_lhs>> &&
+                            Traits::Expr::is_valid_v<std::decay_t<_rhs>> &&
+                            !Impl::is_mixed_product_v<_lhs, _rhs> &&
+                            !Impl::FoldedProduct<_lhs, _rhs>::value,
+                        Expr::Binary<Impl::product_operand_t<_lhs, _lhs, _rhs>,
+                                     Impl::product_operand_t<_rhs, _lhs, _rhs>,
+                                     Expr::MulMatrix>>;
+
+/**
+ * @brief Multiplies two matrix expressions, one of them a zero or an
+ * identity, without computing the product (see `Impl::FoldedProduct`).
+ *
+ * @return An `Expr::Zero` of the product's shape, or the other operand.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Impl::FoldedProduct<_lhs, _rhs>::value,
+                        typename Impl::FoldedProduct<_lhs, _rhs>::type>;
+
+/**
+ * @brief Multiplies a matrix expression with `Sglty::Zero()` or
+ * `Sglty::Identity()`.
+ *
+ * @return An `Expr::Zero` of the shape of `_l`, or `_l`.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> typename Impl::UnshapedProduct<_lhs, _rhs>::type;
+
+/**
+ * @brief Multiplies `Sglty::Zero()` or `Sglty::Identity()` with a matrix
+ * expression.
+ *
+ * @return An `Expr::Zero` of the shape of `_r`, or `_r`.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> typename Impl::UnshapedProduct<_rhs, _lhs>::type;
+
+namespace Impl {
+
+template <typename _lhs, typename _rhs>
+using mixed_product_t = decltype(Mul(
+    Alg::Cast<Alg::Impl::promoted_t<_lhs, _rhs>>(std::declval<_lhs>()),
+    Alg::Cast<Alg::Impl::promoted_t<_lhs, _rhs>>(std::declval<_rhs>())));
+
+}  // namespace Impl
+
+/**
+ * @brief Multiplies two matrix expressions of different element types.
+ *
+ * Both operands are converted to their promoted type while they are read
+ * (see `Sglty::Traits::Type::promote_t` and `Sglty::Op::Alg::Cast`), e.g. a
+ * `float` matrix times a `double` matrix is `Cast<double>(a) * b`. Dense
+ * product kernels convert while packing, without a converted copy.
+ *
+ * @return A Binary expression using `MulMatrix` over the converted operands.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto Mul(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Impl::is_mixed_product_v<_lhs, _rhs>,
+                        Impl::mixed_product_t<_lhs, _rhs>>;
 
 }  // namespace Sglty::Op::Arthm
 
+namespace Sglty::Op::Arthm::Impl {
+
+/**
+ * @brief Whether `_expr` is a product term that stays one when negated, so
+ * `c - _expr` can be built as `c + _expr * -1`.
+ */
+template <typename _expr, typename _enable = void>
+struct IsNegatedProduct : std::false_type {};
+
+template <typename _expr>
+struct IsNegatedProduct<
+    _expr,
+    std::enable_if_t<IsAccumulateTerm<_expr>::value &&
+                     std::is_signed_v<typename _expr::core_impl::value_type>>>
+    : IsAccumulateTerm<std::decay_t<decltype(Mul(
+          std::declval<const _expr&>(),
+          typename _expr::core_impl::value_type(-1)))>> {};
+
+}  // namespace Sglty::Op::Arthm::Impl
+
 namespace Sglty::Types {
 
 /**
@@ -186,10 +715,11 @@ namespace Sglty::Types {
  * Internally dispatches to `Op::Arthm::Mul`.
  */
 template <typename _lhs, typename _rhs>
-constexpr auto operator*(const _lhs& _l, const _rhs& _r)
-    -> std::enable_if_t<Traits::Expr::is_valid_v<_lhs> ||
-                            Traits::Expr::is_valid_v<_rhs>,
-                        decltype(Op::Arthm::Mul(_l, _r))>;
+constexpr auto operator*(_lhs&& _l, _rhs&& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<std::decay_t<_lhs>> ||
+                            Traits::Expr::is_valid_v<std::decay_t<_rhs>>,
+                        decltype(Op::Arthm::Mul(std::forward<_lhs>(_l),
+                                                std::forward<_rhs>(_r)))>;
 
 }  // namespace Sglty::Types
 
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
 #include "../../Expr/Unary.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
 
 namespace Sglty::Expr {
 
@@ -34,10 +37,11 @@ struct Neg {
   /**
    * @brief Resulting core implementation.
    *
-   * Propagates the operand’s `core_impl` type.
+   * Propagates the operand’s `core_impl` type, or the owning core a view
+   * evaluates into.
    */
   template <typename _operand>
-  using core_impl = typename _operand::core_impl;
+  using core_impl = Traits::Core::plain_t<typename _operand::core_impl>;
 
   /**
    * @brief Always valid—negation preserves core layout.
@@ -51,6 +55,22 @@ struct Neg {
   template <typename>
   constexpr static bool is_valid_dimension = true;
 
+  /**
+   * @brief Runtime row count of the result.
+   *
+   * Equals `rows` unless the operand is runtime-sized.
+   */
+  template <typename _operand>
+  constexpr std::size_t Rows(const _operand& op) const;
+
+  /**
+   * @brief Runtime column count of the result.
+   *
+   * Equals `cols` unless the operand is runtime-sized.
+   */
+  template <typename _operand>
+  constexpr std::size_t Cols(const _operand& op) const;
+
   /**
    * @brief Computes the element-wise negation of the operand.
    *
@@ -63,6 +83,29 @@ struct Neg {
   constexpr auto operator()(const _operand& op,
                             std::size_t i,
                             std::size_t j) const;
+
+  /**
+   * @brief Negation always has a packet form.
+   */
+  template <typename>
+  constexpr static bool vectorizable = true;
+
+  /**
+   * @brief Each result element only reads the operand at its own position.
+   */
+  template <typename>
+  constexpr static bool elementwise = true;
+
+  /**
+   * @brief Computes the negation of a packet starting at a given position.
+   *
+   * @param op Operand expression.
+   * @param i Row index of the first lane.
+   * @param j Column index of the first lane.
+   * @return `-op.Packet(i, j)`
+   */
+  template <typename _operand>
+  auto Packet(const _operand& op, std::size_t i, std::size_t j) const;
 };
 
 }  // namespace Sglty::Expr
@@ -73,13 +116,15 @@ namespace Sglty::Op::Arthm {
  * @brief Wraps an expression in a compile-time negation node.
  *
  * Enables negation like `-matrix` by producing a `Unary<_operand, Expr::Neg>`.
+ * A double negation `-(-x)` cancels and returns `x` itself (a reference to a
+ * matrix, or the inner expression).
  *
  * @tparam _operand A valid matrix expression.
  * @param _o Operand to negate.
- * @return A unary negation expression.
+ * @return A unary negation expression, or the operand of a negated one.
  */
 template <typename _operand>
-constexpr auto Neg(const _operand& _o);
+constexpr decltype(auto) Neg(_operand&& _o);
 
 }  // namespace Sglty::Op::Arthm
 
@@ -89,13 +134,16 @@ namespace Sglty::Types {
  * @brief Overload of unary `-` for matrix expressions.
  *
  * Forwards to `Op::Arthm::Neg`. Produces a compile-time negation node.
+ * Enabled only for valid expressions.
  *
  * @tparam _operand A valid matrix expression.
  * @param _o Operand to negate.
  * @return A unary expression wrapping the negation.
  */
-template <typename _operand>
-constexpr auto operator-(const _operand& _o);
+template <typename _operand,
+          typename = std::enable_if_t<
+              Traits::Expr::is_valid_v<std::decay_t<_operand>>>>
+constexpr decltype(auto) operator-(_operand&& _o);
 
 }  // namespace Sglty::Types
 
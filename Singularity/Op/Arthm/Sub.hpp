@@ -1,6 +1,10 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
+
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
 
 namespace Sglty::Expr {
 
@@ -30,17 +34,26 @@ struct Sub {
   /**
    * @brief Resulting core implementation.
    *
-   * Assumes both operands share the same `core_impl`.
+   * Assumes both operands share the same `core_impl`. Views are replaced by
+   * the owning core they evaluate into, and structured operands combine as
+   * by `Sglty::Traits::Core::sum_t`.
    */
   template <typename _lhs, typename _rhs>
-  using core_impl = typename _lhs::core_impl;
+  using core_impl = Traits::Core::sum_t<typename _lhs::core_impl,
+                                        typename _rhs::core_impl>;
 
   /**
-   * @brief Valid if both operands use the same core implementation.
+   * @brief Valid if both operands use the same core implementation, or if a
+   * structured one shares the value type of the other.
    */
   template <typename _lhs, typename _rhs>
   constexpr static bool is_valid_core_impl =
-      std::is_same_v<typename _lhs::core_impl, typename _rhs::core_impl>;
+      std::is_same_v<Traits::Core::plain_t<typename _lhs::core_impl>,
+                     Traits::Core::plain_t<typename _rhs::core_impl>> ||
+      ((Traits::Core::is_structured_v<typename _lhs::core_impl> ||
+        Traits::Core::is_structured_v<typename _rhs::core_impl>) &&
+       std::is_same_v<typename _lhs::core_impl::type_traits::value_type,
+                      typename _rhs::core_impl::type_traits::value_type>);
 
   /**
    * @brief Valid if both operands have identical dimensions.
@@ -49,6 +62,29 @@ struct Sub {
   constexpr static bool is_valid_dimension =
       (_lhs::rows == _rhs::rows) && (_lhs::cols == _rhs::cols);
 
+  /**
+   * @brief Runtime row count of the result.
+   *
+   * Equals `rows` unless an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr std::size_t Rows(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Runtime column count of the result.
+   *
+   * Equals `cols` unless an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr std::size_t Cols(const _lhs& _l, const _rhs& _r) const;
+
+  /**
+   * @brief Runtime counterpart of `is_valid_dimension`, checked by `Binary`
+   * when an operand is runtime-sized.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr bool IsValidDimension(const _lhs& _l, const _rhs& _r) const;
+
   /**
    * @brief Computes the element-wise difference `_l(i, j) - _r(i, j)`.
    *
@@ -63,6 +99,33 @@ struct Sub {
                             const _rhs& _r,
                             std::size_t i,
                             std::size_t j) const;
+
+  /**
+   * @brief Element-wise subtraction always has a packet form.
+   */
+  template <typename, typename>
+  constexpr static bool vectorizable = true;
+
+  /**
+   * @brief Each result element only reads the operands at its own position.
+   */
+  template <typename, typename>
+  constexpr static bool elementwise = true;
+
+  /**
+   * @brief Evaluates the difference of two packets at a given position.
+   *
+   * @param _l Left operand.
+   * @param _r Right operand.
+   * @param i Row index of the first lane.
+   * @param j Column index of the first lane.
+   * @return `_l.Packet(i, j) - _r.Packet(i, j)`.
+   */
+  template <typename _lhs, typename _rhs>
+  auto Packet(const _lhs& _l,
+              const _rhs& _r,
+              std::size_t i,
+              std::size_t j) const;
 };
 
 }  // namespace Sglty::Expr
@@ -73,7 +136,15 @@ namespace Sglty::Op::Arthm {
  * @brief Constructs a compile-time subtraction expression.
  *
  * Subtracts two matrix expressions element-wise. Requires both operands to
- * satisfy expression and shape compatibility.
+ * satisfy expression and shape compatibility. A negated right-hand side is
+ * added instead: `x - (-y)` is `x + y`. A dense product over signed
+ * elements is added negated, `x - a * b` is `x + a * b * -1`, so it is
+ * accumulated in place (see `Expr::GemmAccumulate`).
+ *
+ * A placeholder such as `Sglty::Zero()` first takes the shape of the other
+ * operand (see `Expr::Unshaped`). With an `Expr::Zero` operand `x - z` is
+ * `x` itself and `z - x` is `-x`, when `x` already has the core of the
+ * difference.
  *
  * @tparam _lhs Left-hand side expression type.
  * @tparam _rhs Right-hand side expression type.
@@ -82,7 +153,7 @@ namespace Sglty::Op::Arthm {
  * @return A `Binary<_lhs, _rhs, Expr::Sub>` expression node.
  */
 template <typename _lhs, typename _rhs>
-constexpr auto Sub(const _lhs& _l, const _rhs& _r);
+constexpr decltype(auto) Sub(_lhs&& _l, _rhs&& _r);
 
 }  // namespace Sglty::Op::Arthm
 
@@ -92,7 +163,9 @@ namespace Sglty::Types {
  * @brief Overload of binary `-` for matrix expressions.
  *
  * Allows writing `A - B` for two compatible matrix expressions.
- * Forwards to `Op::Arthm::Sub`.
+ * Forwards to `Op::Arthm::Sub`. Enabled only if either operand is a valid
+ * expression, so types merely sharing the namespace of a matrix (e.g.
+ * iterators of a `std::vector` of matrices) keep their own `-`.
  *
  * @tparam _lhs Left-hand side expression type.
  * @tparam _rhs Right-hand side expression type.
@@ -100,8 +173,12 @@ namespace Sglty::Types {
  * @param _r Right operand.
  * @return A subtraction expression node.
  */
-template <typename _lhs, typename _rhs>
-constexpr auto operator-(const _lhs& _l, const _rhs& _r);
+template <typename _lhs,
+          typename _rhs,
+          bool _enable = Traits::Expr::is_valid_v<std::decay_t<_lhs>> ||
+                         Traits::Expr::is_valid_v<std::decay_t<_rhs>>,
+          typename     = std::enable_if_t<_enable>>
+constexpr decltype(auto) operator-(_lhs&& _l, _rhs&& _r);
 
 }  // namespace Sglty::Types
 
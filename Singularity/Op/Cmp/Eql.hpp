@@ -2,12 +2,57 @@
 
 namespace Sglty::Op::Cmp {
 
+/**
+ * @brief Checks whether two matrices of the same type hold equal elements.
+ *
+ * Elements are compared with `!=` in storage order and the comparison stops
+ * at the first mismatch. Dense cores of arithmetic types are compared over
+ * `Data()` outside constant evaluation: byte-wise for types whose equal
+ * values have equal bytes (integers), a SIMD packet at a time for `float`
+ * and `double`, so `-0.0 == 0.0` and `NaN != NaN` still hold.
+ *
+ * Either side may also be the `Matrix<Core::Identity>` returned by
+ * `Identity()` of the other's type, so `m == M::Identity()` compiles.
+ *
+ * @tparam _lhs The left-hand type.
+ * @tparam _rhs The right-hand type, must equal `_lhs` or be its identity.
+ * @param _l The left-hand matrix.
+ * @param _r The right-hand matrix.
+ * @return `true` if shapes and all elements are equal.
+ */
 template <typename _lhs, typename _rhs>
 constexpr bool IsEqual(const _lhs& _l, const _rhs& _r);
 
+/**
+ * @brief Negation of `IsEqual`.
+ */
 template <typename _lhs, typename _rhs>
 constexpr bool IsNotEqual(const _lhs& _l, const _rhs& _r);
 
+/**
+ * @brief Checks whether two expressions are equal up to a relative tolerance.
+ *
+ * For floating-point elements, true when
+ * `SquaredNorm(_l - _r) <= prec * prec * min(SquaredNorm(_l),
+ * SquaredNorm(_r))` (see `Sglty::Op::Red`), with `prec` defaulting to the
+ * square root of the machine epsilon of the element type. Neither side is
+ * materialized. For other element types this is `IsEqual`.
+ *
+ * @tparam _lhs The left-hand expression type.
+ * @tparam _rhs The right-hand expression type.
+ * @param _l The left-hand expression.
+ * @param _r The right-hand expression.
+ * @return `true` if the expressions are approximately equal.
+ */
+template <typename _lhs, typename _rhs>
+constexpr bool IsApprox(const _lhs& _l, const _rhs& _r);
+
+/**
+ * @brief `IsApprox` with an explicit relative tolerance `prec`.
+ */
+template <typename _lhs, typename _rhs, typename _Tp>
+constexpr bool IsApprox(const _lhs& _l, const _rhs& _r, _Tp prec);
+
 }  // namespace Sglty::Op::Cmp
 
 namespace Sglty::Types {
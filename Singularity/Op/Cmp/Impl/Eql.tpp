@@ -4,23 +4,173 @@
 #include "../../../Expr/Evaluate.hpp"
 
 #include <cstddef>
+#include <cstring>
+#include <limits>
 #include <type_traits>
 
+#include "../../../Config.hpp"
+#include "../../../Core/Enums.hpp"
+#include "../../../Core/Identity.hpp"
+#include "../../../Expr/Assign.hpp"
+#include "../../../Kernel/Unroll.hpp"
+#include "../../../Simd/Packet.hpp"
+#include "../../Arthm/Sub.hpp"
+#include "../../Red/Reduce.hpp"
+#include "../../../Traits/Expr.hpp"
+#include "../../../Traits/Size.hpp"
+
 namespace Sglty::Op::Cmp {
 
+namespace Impl {
+
+// Whether `_matrix` is the `Matrix<Core::Identity>` that `_other::Identity()`
+// returns for a fixed-size `_other`, which compares equal to its elements.
+template <typename _matrix, typename _other>
+struct IsIdentityOf : std::false_type {};
+
+template <typename _Tp, std::size_t _size, typename _other>
+struct IsIdentityOf<Types::Matrix<Core::Identity<_Tp, _size>>, _other>
+    : std::bool_constant<
+          _other::rows == _size && _other::cols == _size &&
+          std::is_same_v<std::remove_const_t<typename _other::value_type>,
+                         _Tp>> {};
+
+// Compares `n` contiguous elements with the semantics of `!=` on `_Tp`.
+template <typename _Tp>
+bool IsEqualSpan(const _Tp* _l, const _Tp* _r, std::size_t n) {
+  if constexpr (std::has_unique_object_representations_v<_Tp>) {
+    // Equal values have equal bytes, e.g. integers.
+    return std::memcmp(_l, _r, n * sizeof(_Tp)) == 0;
+  } else if constexpr (Simd::is_vectorizable_v<_Tp>) {
+    using packet_type = Simd::Packet<_Tp>;
+
+    constexpr std::size_t width = packet_type::size;
+    constexpr std::size_t step  = 4 * width;
+
+    std::size_t k = 0;
+    for (; k + step <= n; k += step) {
+      bool equal = true;
+      Kernel::Unroll<4>([&](auto t) {
+        equal &= Simd::AllEqual(packet_type::Load(_l + k + t * width),
+                                packet_type::Load(_r + k + t * width));
+      });
+      if (!equal) {
+        return false;
+      }
+    }
+    for (; k + width <= n; k += width) {
+      if (!Simd::AllEqual(packet_type::Load(_l + k),
+                          packet_type::Load(_r + k))) {
+        return false;
+      }
+    }
+    for (; k < n; k++) {
+      if (_l[k] != _r[k]) {
+        return false;
+      }
+    }
+    return true;
+  } else {
+    for (std::size_t k = 0; k < n; k++) {
+      if (_l[k] != _r[k]) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+// Compares the storage of two dense matrices of the same type line by line,
+// or as one span when neither is padded.
+template <typename _matrix>
+bool IsEqualStorage(const _matrix& _l, const _matrix& _r) {
+  const bool row_lines    = _matrix::core_major == Core::Major::Row;
+  const std::size_t outer = row_lines ? _l.Rows() : _l.Cols();
+  const std::size_t inner = row_lines ? _l.Cols() : _l.Rows();
+
+  if (outer == 0 || inner == 0) {
+    return true;
+  }
+
+  const std::size_t l_ld = _l.OuterStride();
+  const std::size_t r_ld = _r.OuterStride();
+  if (l_ld == inner && r_ld == inner) {
+    return IsEqualSpan(_l.Data(), _r.Data(), outer * inner);
+  }
+  for (std::size_t o = 0; o < outer; o++) {
+    if (!IsEqualSpan(_l.Data() + o * l_ld, _r.Data() + o * r_ld, inner)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename _lhs, typename _rhs, typename _Tp>
+constexpr bool IsApproxSquared(const _lhs& _l, const _rhs& _r, _Tp prec2) {
+  const _Tp diff = Red::SquaredNorm(Arthm::Sub(_l, _r));
+  const _Tp l    = Red::SquaredNorm(_l);
+  const _Tp r    = Red::SquaredNorm(_r);
+  return diff <= prec2 * (l < r ? l : r);
+}
+
+}  // namespace Impl
+
 template <typename _lhs, typename _rhs>
 constexpr bool IsEqual(const _lhs& _l, const _rhs& _r) {
-  static_assert(std::is_same_v<_lhs, _rhs>,
+  static_assert(std::is_same_v<_lhs, _rhs> ||
+                    Impl::IsIdentityOf<_rhs, _lhs>::value ||
+                    Impl::IsIdentityOf<_lhs, _rhs>::value,
                 "Error: `_lhs` and `_rhs` have different dimensions.");
 
-  for (std::size_t i = 0; i < _lhs::rows; i++) {
-    for (std::size_t j = 0; j < _lhs::cols; j++) {
-      if (_l(i, j) != _r(i, j)) {
-        return false;
+  if constexpr (Impl::IsIdentityOf<_lhs, _rhs>::value &&
+                !std::is_same_v<_lhs, _rhs>) {
+    return IsEqual(_r, _l);  // traverse the stored side in its own order
+  }
+
+  if constexpr (Traits::Expr::is_dynamic_v<_lhs>) {
+    if (_l.Rows() != _r.Rows() || _l.Cols() != _r.Cols()) {
+      return false;
+    }
+  }
+
+  constexpr std::size_t rows = _lhs::rows;
+  constexpr std::size_t cols = _lhs::cols;
+  constexpr Core::Major major =
+      _lhs::core_impl::core_traits::core_major;  // storage order
+
+  if constexpr (Traits::Size::is_unrolled_v<rows> &&
+                Traits::Size::is_unrolled_v<cols> &&
+                Traits::Size::is_unrolled_v<rows * cols>) {
+    return Kernel::UnrollAll<rows * cols>([&](auto k) {
+      if constexpr (major == Core::Major::Row) {
+        return !(_l(k / cols, k % cols) != _r(k / cols, k % cols));
+      } else {
+        return !(_l(k % rows, k / rows) != _r(k % rows, k / rows));
+      }
+    });
+  } else {
+    if constexpr (std::is_same_v<_lhs, _rhs> &&
+                  Traits::Expr::is_terminal_v<_lhs> &&
+                  Expr::Impl::IsDirectAccess<_lhs>::value) {
+      if (!Config::IsConstantEvaluated()) {
+        return Impl::IsEqualStorage(_l, _r);
       }
     }
+
+    const bool row_lines    = major == Core::Major::Row;
+    const std::size_t outer = row_lines ? _l.Rows() : _l.Cols();
+    const std::size_t inner = row_lines ? _l.Cols() : _l.Rows();
+    for (std::size_t o = 0; o < outer; o++) {
+      for (std::size_t k = 0; k < inner; k++) {
+        const std::size_t i = row_lines ? o : k;
+        const std::size_t j = row_lines ? k : o;
+        if (_l(i, j) != _r(i, j)) {
+          return false;
+        }
+      }
+    }
+    return true;
   }
-  return true;
 }
 
 template <typename _lhs, typename _rhs>
@@ -28,6 +178,31 @@ constexpr bool IsNotEqual(const _lhs& _l, const _rhs& _r) {
   return !IsEqual(_l, _r);
 }
 
+template <typename _lhs, typename _rhs>
+constexpr bool IsApprox(const _lhs& _l, const _rhs& _r) {
+  using value_type = typename _lhs::core_impl::value_type;
+
+  if constexpr (std::is_floating_point_v<value_type>) {
+    // `prec * prec` for the default `prec = sqrt(epsilon)`.
+    return Impl::IsApproxSquared(
+        _l, _r, std::numeric_limits<value_type>::epsilon());
+  } else {
+    return IsEqual(_l, _r);
+  }
+}
+
+template <typename _lhs, typename _rhs, typename _Tp>
+constexpr bool IsApprox(const _lhs& _l, const _rhs& _r, _Tp prec) {
+  using value_type = typename _lhs::core_impl::value_type;
+
+  if constexpr (std::is_floating_point_v<value_type>) {
+    const value_type p = static_cast<value_type>(prec);
+    return Impl::IsApproxSquared(_l, _r, p * p);
+  } else {
+    return IsEqual(_l, _r);
+  }
+}
+
 }  // namespace Sglty::Op::Cmp
 
 namespace Sglty::Types {
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "../Reduce.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../../../Config.hpp"
+#include "../../../Core/Enums.hpp"
+#include "../../../Kernel/Reduce.hpp"
+#include "../../../Simd/Packet.hpp"
+#include "../../../Traits/Expr.hpp"
+#include "../../../Traits/Size.hpp"
+#include "../../../Traits/Type.hpp"
+
+namespace Sglty::Op::Red {
+
+namespace Impl {
+
+struct Plus {
+  template <typename _Tp>
+  constexpr _Tp operator()(const _Tp& _l, const _Tp& _r) const {
+    return _l + _r;
+  }
+};
+
+struct Min {
+  template <typename _Tp>
+  constexpr _Tp operator()(const _Tp& _l, const _Tp& _r) const {
+    return _r < _l ? _r : _l;
+  }
+
+  template <typename _Tp>
+  Simd::Packet<_Tp> operator()(const Simd::Packet<_Tp>& _l,
+                               const Simd::Packet<_Tp>& _r) const {
+    return Simd::Min(_l, _r);
+  }
+};
+
+struct Max {
+  template <typename _Tp>
+  constexpr _Tp operator()(const _Tp& _l, const _Tp& _r) const {
+    return _l < _r ? _r : _l;
+  }
+
+  template <typename _Tp>
+  Simd::Packet<_Tp> operator()(const Simd::Packet<_Tp>& _l,
+                               const Simd::Packet<_Tp>& _r) const {
+    return Simd::Max(_l, _r);
+  }
+};
+
+// Reductions accumulate in the element type of the expression's core, the
+// same type a packet of it holds (e.g. `short` for `a - b` over `short`).
+template <typename _expr>
+using value_t = typename _expr::core_impl::value_type;
+
+// Folds `at(i, j)` over the shape of `_e` in its storage order, a packet at a
+// time through `packet_at(i, j)` when `_vectorizable` allows it at runtime.
+// Accumulates in `_value`, the element type of `_e` unless given.
+template <bool _vectorizable,
+          typename _value = void,
+          typename _expr,
+          typename _at,
+          typename _packet_at,
+          typename _combine>
+constexpr auto Fold(const _expr& _e,
+                    _at at,
+                    _packet_at packet_at,
+                    _combine combine) {
+  using value_type =
+      std::conditional_t<std::is_void_v<_value>, value_t<_expr>, _value>;
+
+  constexpr Core::Major major = _expr::core_impl::core_traits::core_major;
+
+  auto value_at = [&](std::size_t i, std::size_t j) {
+    return static_cast<value_type>(at(i, j));
+  };
+
+  if constexpr (_vectorizable && Simd::is_vectorizable_v<value_type>) {
+    if (!Config::IsConstantEvaluated()) {
+      return Kernel::ReducePacket<major, value_type>(
+          _e.Rows(), _e.Cols(), value_at, packet_at, combine);
+    }
+  }
+  return Kernel::Reduce<major>(_e.Rows(), _e.Cols(), value_at, combine);
+}
+
+template <typename _expr>
+constexpr bool IsEmpty(const _expr& _e) {
+  if constexpr (Traits::Expr::is_dynamic_v<_expr>) {
+    return _e.Rows() == 0 || _e.Cols() == 0;
+  } else {
+    return false;
+  }
+}
+
+template <typename _expr, typename _combine>
+constexpr auto FoldElements(const _expr& _e, _combine combine) {
+  return Fold<Traits::Expr::is_vectorizable_v<_expr>>(
+      _e,
+      [&](std::size_t i, std::size_t j) { return _e(i, j); },
+      [&](auto i, auto j) { return _e.Packet(i, j); },
+      combine);
+}
+
+}  // namespace Impl
+
+template <typename _expr>
+constexpr auto Sum(const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  using value_type = Impl::value_t<_expr>;
+
+  if (Impl::IsEmpty(_e)) {
+    return value_type{};
+  }
+  return Impl::FoldElements(_e, Impl::Plus{});
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto Dot(const _lhs& _l, const _rhs& _r) {
+  static_assert(Traits::Expr::is_valid_v<_lhs> &&
+                    Traits::Expr::is_valid_v<_rhs>,
+                "Error: `_lhs` and `_rhs` must be valid expression types.");
+  static_assert(Traits::Size::is_compatible_v<_lhs::rows, _rhs::rows> &&
+                    Traits::Size::is_compatible_v<_lhs::cols, _rhs::cols>,
+                "Error: `_lhs` and `_rhs` have different dimensions.");
+
+  // Operands of different element types meet in their promoted type, so
+  // the result does not depend on their order.
+  using value_type =
+      Traits::Type::promote_t<Impl::value_t<_lhs>, Impl::value_t<_rhs>>;
+
+  if constexpr (Traits::Expr::is_dynamic_v<_lhs> ||
+                Traits::Expr::is_dynamic_v<_rhs>) {
+    if (_l.Rows() != _r.Rows() || _l.Cols() != _r.Cols()) {
+      throw std::invalid_argument(
+          "Error: `_lhs` and `_rhs` have different dimensions.");
+    }
+  }
+  if (Impl::IsEmpty(_l)) {
+    return value_type{};
+  }
+
+  // Packets of both sides must run along the same axis.
+  constexpr bool vectorizable =
+      Traits::Expr::is_vectorizable_v<_lhs> &&
+      Traits::Expr::is_vectorizable_v<_rhs> &&
+      std::is_same_v<Impl::value_t<_lhs>, Impl::value_t<_rhs>> &&
+      std::is_same_v<Impl::value_t<_lhs>, value_type> &&
+      _lhs::core_impl::core_traits::core_major ==
+          _rhs::core_impl::core_traits::core_major;
+
+  return Impl::Fold<vectorizable, value_type>(
+      _l,
+      [&](std::size_t i, std::size_t j) { return _l(i, j) * _r(i, j); },
+      [&](auto i, auto j) { return _l.Packet(i, j) * _r.Packet(i, j); },
+      Impl::Plus{});
+}
+
+template <typename _expr>
+constexpr auto SquaredNorm(const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  using value_type = Impl::value_t<_expr>;
+
+  if (Impl::IsEmpty(_e)) {
+    return value_type{};
+  }
+  return Impl::Fold<Traits::Expr::is_vectorizable_v<_expr>>(
+      _e,
+      [&](std::size_t i, std::size_t j) {
+        const auto value = _e(i, j);
+        return value * value;
+      },
+      [&](auto i, auto j) {
+        const auto p = _e.Packet(i, j);
+        return p * p;
+      },
+      Impl::Plus{});
+}
+
+template <typename _expr>
+auto Norm(const _expr& _e) {
+  using std::sqrt;
+  return sqrt(SquaredNorm(_e));
+}
+
+template <typename _expr>
+constexpr auto Min(const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  if (Impl::IsEmpty(_e)) {
+    throw std::invalid_argument("Error: `_expr` has no elements.");
+  }
+  return Impl::FoldElements(_e, Impl::Min{});
+}
+
+template <typename _expr>
+constexpr auto Max(const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  if (Impl::IsEmpty(_e)) {
+    throw std::invalid_argument("Error: `_expr` has no elements.");
+  }
+  return Impl::FoldElements(_e, Impl::Max{});
+}
+
+template <typename _expr>
+constexpr auto Trace(const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+  static_assert(Traits::Size::is_compatible_v<_expr::rows, _expr::cols>,
+                "Error: the trace is only defined for square matrices.");
+
+  using value_type = Impl::value_t<_expr>;
+
+  if constexpr (Traits::Expr::is_dynamic_v<_expr>) {
+    if (_e.Rows() != _e.Cols()) {
+      throw std::invalid_argument(
+          "Error: the trace is only defined for square matrices.");
+    }
+  }
+  if (Impl::IsEmpty(_e)) {
+    return value_type{};
+  }
+  return Kernel::Reduce<Core::Major::Row>(
+      1,
+      _e.Rows(),
+      [&](std::size_t, std::size_t k) { return value_type(_e(k, k)); },
+      Impl::Plus{});
+}
+
+}  // namespace Sglty::Op::Red
+
+// Singularity/Op/Red/Impl/Reduce.tpp
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Op::Red {
+
+/**
+ * @brief Sums every element of an expression.
+ *
+ * The expression is read in place, without materializing it, in the storage
+ * order of its `core_impl`. Elements are accumulated pairwise (see
+ * `Sglty::Kernel::Reduce`); vectorizable expressions use several SIMD
+ * accumulators outside constant evaluation.
+ *
+ * Example Usage:
+ * ```
+ * Sglty::DenseMat<float, 3, 3> a(2), b(1);
+ * float s = Sglty::Op::Red::Sum(a - b);  // 9
+ * ```
+ *
+ * @tparam _expr The expression type.
+ * @param _e The expression to reduce.
+ * @return The sum, or a value-initialized element for an empty runtime-sized
+ * expression.
+ */
+template <typename _expr>
+constexpr auto Sum(const _expr& _e);
+
+/**
+ * @brief Sums the element-wise products of two expressions of the same
+ * shape.
+ *
+ * Equivalent to `Sum()` over `_l(i, j) * _r(i, j)`, accumulated in
+ * `Sglty::Traits::Type::promote_t` of both element types (e.g. `double` for
+ * `int` and `double` operands). Mismatching fixed shapes are a compile
+ * error; mismatching runtime shapes throw `std::invalid_argument`.
+ *
+ * @tparam _lhs The left-hand expression type.
+ * @tparam _rhs The right-hand expression type.
+ * @param _l The left-hand expression.
+ * @param _r The right-hand expression.
+ * @return The dot product, or a value-initialized element for empty
+ * runtime-sized expressions.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto Dot(const _lhs& _l, const _rhs& _r);
+
+/**
+ * @brief Sums the squares of every element of an expression.
+ *
+ * Each element is evaluated once.
+ *
+ * @tparam _expr The expression type.
+ * @param _e The expression to reduce.
+ * @return The squared Frobenius norm.
+ */
+template <typename _expr>
+constexpr auto SquaredNorm(const _expr& _e);
+
+/**
+ * @brief Computes the Frobenius norm of an expression.
+ *
+ * `std::sqrt(SquaredNorm(_e))`, so not usable in constant expressions.
+ *
+ * @tparam _expr The expression type.
+ * @param _e The expression to reduce.
+ * @return The Frobenius norm.
+ */
+template <typename _expr>
+auto Norm(const _expr& _e);
+
+/**
+ * @brief Finds the smallest element of an expression.
+ *
+ * Throws `std::invalid_argument` for an empty runtime-sized expression.
+ *
+ * @tparam _expr The expression type.
+ * @param _e The expression to reduce.
+ * @return The smallest element.
+ */
+template <typename _expr>
+constexpr auto Min(const _expr& _e);
+
+/**
+ * @brief Finds the largest element of an expression.
+ *
+ * Throws `std::invalid_argument` for an empty runtime-sized expression.
+ *
+ * @tparam _expr The expression type.
+ * @param _e The expression to reduce.
+ * @return The largest element.
+ */
+template <typename _expr>
+constexpr auto Max(const _expr& _e);
+
+/**
+ * @brief Sums the diagonal of a square expression.
+ *
+ * Only the diagonal is evaluated, so `Trace(a * b)` computes `rows` inner
+ * products instead of the full product. Non-square fixed shapes are a
+ * compile error; non-square runtime shapes throw `std::invalid_argument`.
+ *
+ * @tparam _expr The expression type.
+ * @param _e The expression to reduce.
+ * @return The trace.
+ */
+template <typename _expr>
+constexpr auto Trace(const _expr& _e);
+
+}  // namespace Sglty::Op::Red
+
+#include "Impl/Reduce.tpp"
+
+// Singularity/Op/Red/Reduce.hpp
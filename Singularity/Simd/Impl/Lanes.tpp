@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../Lanes.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../Packet.hpp"
+#include "../../Config.hpp"
+
+namespace Sglty::Simd {
+
+namespace Impl {
+
+template <typename _Tp>
+struct IsLanes : std::false_type {};
+
+template <typename _Tp, std::size_t _lanes>
+struct IsLanes<Lanes<_Tp, _lanes>> : std::true_type {};
+
+template <typename _Tp, std::size_t _lanes, typename _enable = void>
+struct LanePackets : std::false_type {};
+
+template <typename _Tp, std::size_t _lanes>
+struct LanePackets<_Tp, _lanes, std::enable_if_t<is_vectorizable_v<_Tp>>>
+    : std::bool_constant<_lanes % Packet<_Tp>::size == 0> {};
+
+}  // namespace Impl
+
+template <typename _Tp>
+constexpr inline bool is_lanes_v = Impl::IsLanes<_Tp>::value;
+
+template <typename _Tp, std::size_t _lanes>
+constexpr Lanes<_Tp, _lanes>::Lanes(value_type _val) : _m_data() {
+  for (std::size_t k = 0; k < _lanes; k++) {
+    _m_data[k] = _val;
+  }
+}
+
+template <typename _Tp, std::size_t _lanes>
+template <typename _Up>
+constexpr Lanes<_Tp, _lanes>::Lanes(const Lanes<_Up, _lanes>& _other)
+    : _m_data() {
+  for (std::size_t k = 0; k < _lanes; k++) {
+    _m_data[k] = static_cast<_Tp>(_other[k]);
+  }
+}
+
+template <typename _Tp, std::size_t _lanes>
+constexpr typename Lanes<_Tp, _lanes>::value_type&
+Lanes<_Tp, _lanes>::operator[](const std::size_t _k) {
+  return _m_data[_k];
+}
+
+template <typename _Tp, std::size_t _lanes>
+constexpr const typename Lanes<_Tp, _lanes>::value_type&
+Lanes<_Tp, _lanes>::operator[](const std::size_t _k) const {
+  return _m_data[_k];
+}
+
+template <typename _Tp, std::size_t _lanes>
+constexpr Lanes<_Tp, _lanes>& Lanes<_Tp, _lanes>::operator+=(const Lanes& _r) {
+  return _m_Apply(_r, [](auto l, auto r) { return l + r; });
+}
+
+template <typename _Tp, std::size_t _lanes>
+constexpr Lanes<_Tp, _lanes>& Lanes<_Tp, _lanes>::operator-=(const Lanes& _r) {
+  return _m_Apply(_r, [](auto l, auto r) { return l - r; });
+}
+
+template <typename _Tp, std::size_t _lanes>
+constexpr Lanes<_Tp, _lanes>& Lanes<_Tp, _lanes>::operator*=(const Lanes& _r) {
+  return _m_Apply(_r, [](auto l, auto r) { return l * r; });
+}
+
+template <typename _Tp, std::size_t _lanes>
+template <typename _fn>
+constexpr Lanes<_Tp, _lanes>& Lanes<_Tp, _lanes>::_m_Apply(const Lanes& _r,
+                                                           _fn _f) {
+  if constexpr (Impl::LanePackets<_Tp, _lanes>::value) {
+    if (!Config::IsConstantEvaluated()) {
+      using packet = Packet<_Tp>;
+      for (std::size_t k = 0; k < _lanes; k += packet::size) {
+        const packet l = packet::Load(&_m_data[k]);
+        const packet r = packet::Load(&_r._m_data[k]);
+        _f(l, r).Store(&_m_data[k]);
+      }
+      return *this;
+    }
+  }
+  for (std::size_t k = 0; k < _lanes; k++) {
+    _m_data[k] = _f(_m_data[k], _r._m_data[k]);
+  }
+  return *this;
+}
+
+}  // namespace Sglty::Simd
+
+// Singularity/Simd/Impl/Lanes.tpp
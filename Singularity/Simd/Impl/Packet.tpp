@@ -0,0 +1,175 @@
+#pragma once
+
+#include "../Packet.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace Sglty::Simd {
+
+template <typename _Tp>
+constexpr inline bool is_vectorizable_v =
+    !std::is_same_v<_Tp, bool> &&
+    (std::is_integral_v<_Tp> || std::is_same_v<_Tp, float> ||
+     std::is_same_v<_Tp, double>) &&
+    sizeof(_Tp) < SGLTY_SIMD_BYTES;
+
+template <typename _Tp>
+Packet<_Tp> Packet<_Tp>::Load(const _Tp* _src) {
+  Packet ret;
+  std::memcpy(&ret._m_data, _src, sizeof(native_type));
+  return ret;
+}
+
+template <typename _Tp>
+Packet<_Tp> Packet<_Tp>::LoadAligned(const _Tp* _src) {
+  Packet ret;
+  std::memcpy(&ret._m_data,
+              __builtin_assume_aligned(_src, SGLTY_SIMD_BYTES),
+              sizeof(native_type));
+  return ret;
+}
+
+template <typename _Tp>
+Packet<_Tp> Packet<_Tp>::Broadcast(_Tp _val) {
+  Packet ret;
+  ret._m_data = native_type{} + _val;
+  return ret;
+}
+
+template <typename _Tp>
+void Packet<_Tp>::Store(_Tp* _dst) const {
+  std::memcpy(_dst, &_m_data, sizeof(native_type));
+}
+
+template <typename _Tp>
+void Packet<_Tp>::StoreAligned(_Tp* _dst) const {
+  std::memcpy(__builtin_assume_aligned(_dst, SGLTY_SIMD_BYTES),
+              &_m_data,
+              sizeof(native_type));
+}
+
+template <typename _Tp>
+Packet<_Tp> operator+(const Packet<_Tp>& _l, const Packet<_Tp>& _r) {
+  return {_l._m_data + _r._m_data};
+}
+
+template <typename _Tp>
+Packet<_Tp> operator-(const Packet<_Tp>& _l, const Packet<_Tp>& _r) {
+  return {_l._m_data - _r._m_data};
+}
+
+template <typename _Tp>
+Packet<_Tp> operator*(const Packet<_Tp>& _l, const Packet<_Tp>& _r) {
+  return {_l._m_data * _r._m_data};
+}
+
+template <typename _Tp>
+Packet<_Tp> operator-(const Packet<_Tp>& _p) {
+  return {-_p._m_data};
+}
+
+template <typename _Tp>
+Packet<_Tp> Min(const Packet<_Tp>& _l, const Packet<_Tp>& _r) {
+  return {_r._m_data < _l._m_data ? _r._m_data : _l._m_data};
+}
+
+template <typename _Tp>
+Packet<_Tp> Max(const Packet<_Tp>& _l, const Packet<_Tp>& _r) {
+  return {_l._m_data < _r._m_data ? _r._m_data : _l._m_data};
+}
+
+namespace Impl {
+
+// Interleaves the lower (`_high` false) or upper halves of `_l` and `_r`:
+// `l0 r0 l1 r1 ...`.
+template <bool _high, typename _native, std::size_t... _idx>
+_native Interleave(const _native& _l,
+                   const _native& _r,
+                   std::index_sequence<_idx...>) {
+  constexpr std::size_t n    = sizeof...(_idx);
+  constexpr std::size_t base = _high ? n / 2 : 0;
+#if defined(__clang__) || __GNUC__ >= 12
+  return __builtin_shufflevector(
+      _l, _r, (_idx % 2 == 0 ? base + _idx / 2 : n + base + _idx / 2)...);
+#else
+  using mask_type = decltype(_l != _r);
+  return __builtin_shuffle(
+      _l,
+      _r,
+      mask_type{(_idx % 2 == 0 ? base + _idx / 2 : n + base + _idx / 2)...});
+#endif
+}
+
+}  // namespace Impl
+
+template <typename _Tp>
+void Transpose(Packet<_Tp> (&_rows)[Packet<_Tp>::size]) {
+  constexpr std::size_t n = Packet<_Tp>::size;
+
+  // Each round perfect-shuffles row `k` with row `k + n / 2`; after
+  // `log2(n)` rounds row `l` holds column `l`.
+  for (std::size_t round = 1; round < n; round *= 2) {
+    Packet<_Tp> next[n];
+    for (std::size_t k = 0; k < n / 2; k++) {
+      const auto& l = _rows[k]._m_data;
+      const auto& r = _rows[k + n / 2]._m_data;
+      next[2 * k]._m_data =
+          Impl::Interleave<false>(l, r, std::make_index_sequence<n>{});
+      next[2 * k + 1]._m_data =
+          Impl::Interleave<true>(l, r, std::make_index_sequence<n>{});
+    }
+    for (std::size_t k = 0; k < n; k++) {
+      _rows[k] = next[k];
+    }
+  }
+}
+
+template <typename _Tp>
+Packet<_Tp> Fma(const Packet<_Tp>& _a,
+                const Packet<_Tp>& _b,
+                const Packet<_Tp>& _c) {
+  if constexpr (SGLTY_FMA && std::is_floating_point_v<_Tp>) {
+#if defined(__clang__) && defined(__has_builtin)
+#if __has_builtin(__builtin_elementwise_fma)
+    return {__builtin_elementwise_fma(_a._m_data, _b._m_data, _c._m_data)};
+#endif
+#endif
+    // Lane-wise `std::fma` is vectorized into one fused instruction.
+    Packet<_Tp> result;
+    for (std::size_t k = 0; k < Packet<_Tp>::size; k++) {
+      result._m_data[k] = std::fma(_a._m_data[k], _b._m_data[k], _c._m_data[k]);
+    }
+    return result;
+  } else {
+    return {_a._m_data * _b._m_data + _c._m_data};
+  }
+}
+
+template <typename _Tp>
+constexpr _Tp Fma(_Tp _a, _Tp _b, _Tp _c) {
+  if constexpr (SGLTY_FMA && std::is_floating_point_v<_Tp>) {
+    if (!Config::IsConstantEvaluated()) {
+      return std::fma(_a, _b, _c);
+    }
+  }
+  return _a * _b + _c;
+}
+
+template <typename _Tp>
+bool AllEqual(const Packet<_Tp>& _l, const Packet<_Tp>& _r) {
+  const auto mismatch = _l._m_data != _r._m_data;
+
+  bool any = false;
+  for (std::size_t k = 0; k < Packet<_Tp>::size; k++) {
+    any |= mismatch[k] != 0;
+  }
+  return !any;
+}
+
+}  // namespace Sglty::Simd
+
+// Singularity/Simd/Impl/Packet.tpp
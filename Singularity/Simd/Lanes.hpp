@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace Sglty::Simd {
+
+/**
+ * @brief One scalar per item of a batch, used as the element type of batched
+ * matrices.
+ *
+ * A `Matrix` whose `value_type` is `Lanes<_Tp, _lanes>` stores `_lanes`
+ * same-shaped matrices in structure-of-arrays form: element `(i, j)` of every
+ * item is contiguous. Every existing operation (`+`, `-`, `*`, `Trp`, ...)
+ * then applies to the whole batch at once, one `Lanes` operation per element,
+ * with lane `k` of the result only depending on lane `k` of the operands.
+ *
+ * At runtime, lane-wise arithmetic runs one `Simd::Packet` at a time when
+ * `_lanes` is a multiple of the packet size, so SIMD lanes map onto batch
+ * items; otherwise, and during constant evaluation, lanes are computed one
+ * by one.
+ *
+ * Scalars of `_Tp` convert implicitly by broadcasting, so batches can be
+ * scaled and `value_type{}` / `value_type(1)` keep their usual meaning.
+ *
+ * @tparam _Tp    The scalar element type.
+ * @tparam _lanes The number of batch items.
+ *
+ * @see Sglty::BatchMat
+ */
+template <typename _Tp, std::size_t _lanes>
+struct Lanes {
+  static_assert(_lanes > 0, "Error: `_lanes` must be greater than zero.");
+
+  using value_type = _Tp;
+
+  /// Number of batch items.
+  static constexpr std::size_t size = _lanes;
+
+  /**
+   * @brief Value-initializes every lane.
+   */
+  constexpr Lanes() = default;
+
+  /**
+   * @brief Broadcasts a scalar to every lane.
+   *
+   * @param _val The value of every lane.
+   */
+  constexpr Lanes(value_type _val);
+
+  /**
+   * @brief Converts every lane of another lane type.
+   *
+   * @tparam _Up The source scalar type.
+   * @param _other The lanes to convert.
+   */
+  template <typename _Up>
+  constexpr explicit Lanes(const Lanes<_Up, _lanes>& _other);
+
+  /**
+   * @brief Accesses lane `_k`.
+   *
+   * @param _k The lane index (zero-based).
+   * @return Reference to the lane.
+   */
+  constexpr value_type& operator[](const std::size_t _k);
+
+  /**
+   * @brief Reads lane `_k`.
+   *
+   * @param _k The lane index (zero-based).
+   * @return Const reference to the lane.
+   */
+  constexpr const value_type& operator[](const std::size_t _k) const;
+
+  /**
+   * @brief Adds `_r` lane by lane.
+   *
+   * @param _r The lanes to add.
+   * @return Reference to the current lanes.
+   */
+  constexpr Lanes& operator+=(const Lanes& _r);
+
+  /**
+   * @brief Subtracts `_r` lane by lane.
+   *
+   * @param _r The lanes to subtract.
+   * @return Reference to the current lanes.
+   */
+  constexpr Lanes& operator-=(const Lanes& _r);
+
+  /**
+   * @brief Multiplies by `_r` lane by lane.
+   *
+   * @param _r The lanes to multiply by.
+   * @return Reference to the current lanes.
+   */
+  constexpr Lanes& operator*=(const Lanes& _r);
+
+  // Hidden friends, so that a scalar on either side broadcasts implicitly.
+
+  friend constexpr Lanes operator+(Lanes _l, const Lanes& _r) {
+    return _l += _r;
+  }
+
+  friend constexpr Lanes operator-(Lanes _l, const Lanes& _r) {
+    return _l -= _r;
+  }
+
+  friend constexpr Lanes operator*(Lanes _l, const Lanes& _r) {
+    return _l *= _r;
+  }
+
+  friend constexpr Lanes operator-(const Lanes& _o) {
+    return Lanes() -= _o;
+  }
+
+  /**
+   * @brief Lanes compare equal if every lane does.
+   */
+  friend constexpr bool operator==(const Lanes& _l, const Lanes& _r) {
+    for (std::size_t k = 0; k < _lanes; k++) {
+      if (!(_l._m_data[k] == _r._m_data[k])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  friend constexpr bool operator!=(const Lanes& _l, const Lanes& _r) {
+    return !(_l == _r);
+  }
+
+ private:
+  std::array<_Tp, _lanes> _m_data{};
+
+  template <typename _fn>
+  constexpr Lanes& _m_Apply(const Lanes& _r, _fn _f);
+};
+
+/**
+ * @brief Checks whether `_Tp` is a `Lanes` specialization.
+ *
+ * @tparam _Tp The type to inspect.
+ */
+template <typename _Tp>
+extern const bool is_lanes_v;
+
+}  // namespace Sglty::Simd
+
+#include "Impl/Lanes.tpp"
+
+// Singularity/Simd/Lanes.hpp
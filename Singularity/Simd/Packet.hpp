@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Config.hpp"
+
+namespace Sglty::Simd {
+
+/**
+ * @brief Checks whether `_Tp` can be held in a native SIMD register.
+ *
+ * True for integral (except `bool`), `float` and `double` element types that
+ * are narrower than `SGLTY_SIMD_BYTES`. Always false when packet evaluation is
+ * disabled.
+ *
+ * @tparam _Tp The scalar element type.
+ */
+template <typename _Tp>
+extern const bool is_vectorizable_v;
+
+/**
+ * @brief A native-width SIMD register of `_Tp` lanes.
+ *
+ * Thin value wrapper over a GNU vector extension type of `SGLTY_SIMD_BYTES`
+ * bytes, so the same code maps onto SSE, AVX, AVX-512 or NEON depending on the
+ * target. Loads and stores are unaligned and never used during constant
+ * evaluation.
+ *
+ * Only element-wise arithmetic is provided — this is the subset needed by the
+ * packet forms of `Expr::Add`, `Expr::Sub`, `Expr::MulScalar` and `Expr::Neg`.
+ *
+ * @tparam _Tp The scalar element type, must satisfy `is_vectorizable_v`.
+ */
+template <typename _Tp>
+struct Packet {
+  static_assert(is_vectorizable_v<_Tp>,
+                "Error: `_Tp` cannot be held in a SIMD register.");
+
+  using value_type = _Tp;
+
+  /// Number of lanes in the packet.
+  static constexpr std::size_t size = SGLTY_SIMD_BYTES / sizeof(_Tp);
+
+#if SGLTY_SIMD_BYTES > 0
+  typedef _Tp native_type __attribute__((vector_size(SGLTY_SIMD_BYTES)));
+#else
+  typedef _Tp native_type[1];
+#endif
+
+  /**
+   * @brief Loads `size` consecutive elements starting at `_src`.
+   *
+   * @param _src Pointer to the first element, no alignment required.
+   * @return The loaded packet.
+   */
+  static Packet Load(const _Tp* _src);
+
+  /**
+   * @brief Loads `size` consecutive elements from an aligned address.
+   *
+   * @param _src Pointer to the first element, aligned to `SGLTY_SIMD_BYTES`.
+   * @return The loaded packet.
+   */
+  static Packet LoadAligned(const _Tp* _src);
+
+  /**
+   * @brief Fills every lane with the same value.
+   *
+   * @param _val The value to broadcast.
+   * @return The broadcast packet.
+   */
+  static Packet Broadcast(_Tp _val);
+
+  /**
+   * @brief Stores all lanes to `size` consecutive elements starting at `_dst`.
+   *
+   * @param _dst Pointer to the first element, no alignment required.
+   */
+  void Store(_Tp* _dst) const;
+
+  /**
+   * @brief Stores all lanes to an aligned address.
+   *
+   * @param _dst Pointer to the first element, aligned to `SGLTY_SIMD_BYTES`.
+   */
+  void StoreAligned(_Tp* _dst) const;
+
+  native_type _m_data;
+};
+
+template <typename _Tp>
+Packet<_Tp> operator+(const Packet<_Tp>& _l, const Packet<_Tp>& _r);
+
+template <typename _Tp>
+Packet<_Tp> operator-(const Packet<_Tp>& _l, const Packet<_Tp>& _r);
+
+template <typename _Tp>
+Packet<_Tp> operator*(const Packet<_Tp>& _l, const Packet<_Tp>& _r);
+
+template <typename _Tp>
+Packet<_Tp> operator-(const Packet<_Tp>& _p);
+
+/**
+ * @brief Lane-wise minimum of two packets.
+ */
+template <typename _Tp>
+Packet<_Tp> Min(const Packet<_Tp>& _l, const Packet<_Tp>& _r);
+
+/**
+ * @brief Lane-wise maximum of two packets.
+ */
+template <typename _Tp>
+Packet<_Tp> Max(const Packet<_Tp>& _l, const Packet<_Tp>& _r);
+
+/**
+ * @brief Transposes a `size` x `size` block held as one packet per row.
+ *
+ * Lane `l` of `_rows[k]` becomes lane `k` of `_rows[l]`, using `log2(size)`
+ * rounds of register interleaves and no memory round trip.
+ *
+ * @param _rows The rows of the block, overwritten with its columns.
+ */
+template <typename _Tp>
+void Transpose(Packet<_Tp> (&_rows)[Packet<_Tp>::size]);
+
+/**
+ * @brief Computes `_a * _b + _c` lane by lane.
+ *
+ * Rounds once for floating-point lanes when `SGLTY_FMA` is set, and
+ * multiplies and adds separately otherwise, exactly like the scalar overload
+ * of `Fma`, so packet and scalar tails of one evaluation agree.
+ */
+template <typename _Tp>
+Packet<_Tp> Fma(const Packet<_Tp>& _a,
+                const Packet<_Tp>& _b,
+                const Packet<_Tp>& _c);
+
+/**
+ * @brief Computes `_a * _b + _c` for one element.
+ *
+ * Floating-point values are rounded once through `std::fma` when `SGLTY_FMA`
+ * is set. Constant evaluation, and every other element type, multiplies and
+ * adds separately.
+ */
+template <typename _Tp>
+constexpr _Tp Fma(_Tp _a, _Tp _b, _Tp _c);
+
+/**
+ * @brief Checks whether every lane of `_l` compares equal to the same lane of
+ * `_r`, with the semantics of `==` on `_Tp`.
+ */
+template <typename _Tp>
+bool AllEqual(const Packet<_Tp>& _l, const Packet<_Tp>& _r);
+
+}  // namespace Sglty::Simd
+
+#include "Impl/Packet.tpp"
+
+// Singularity/Simd/Packet.hpp
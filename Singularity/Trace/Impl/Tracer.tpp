@@ -0,0 +1,173 @@
+#pragma once
+
+#include "../Tracer.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../Config.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
+
+namespace Sglty::Trace {
+
+namespace Impl {
+
+struct Counters {
+  std::atomic<std::uint64_t> count{0};
+  std::atomic<std::uint64_t> bytes{0};
+  std::atomic<std::uint64_t> flops{0};
+  std::atomic<std::uint64_t> nanoseconds{0};
+};
+
+inline std::array<Counters, kind_count>& Table() {
+  static std::array<Counters, kind_count> table;
+  return table;
+}
+
+inline Sink& CurrentSink() {
+  static Sink sink;
+  return sink;
+}
+
+inline std::uint64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+inline void Add(Kind _kind,
+                std::uint64_t _bytes,
+                std::uint64_t _flops,
+                std::uint64_t _nanoseconds) {
+  Counters& c = Table()[static_cast<std::size_t>(_kind)];
+  c.count.fetch_add(1, std::memory_order_relaxed);
+  c.bytes.fetch_add(_bytes, std::memory_order_relaxed);
+  c.flops.fetch_add(_flops, std::memory_order_relaxed);
+  c.nanoseconds.fetch_add(_nanoseconds, std::memory_order_relaxed);
+}
+
+inline std::uint64_t Open(Kind _kind,
+                          std::uint64_t _bytes,
+                          std::uint64_t _flops) {
+  if (const Sink& sink = CurrentSink()) {
+    sink(Record{_kind, Phase::Begin, _bytes, _flops, 0});
+  }
+  return Now();
+}
+
+inline void Close(const Span& _span) {
+  const std::uint64_t nanoseconds = Now() - _span.start;
+  Add(_span.kind, _span.bytes, _span.flops, nanoseconds);
+  if (const Sink& sink = CurrentSink()) {
+    sink(Record{
+        _span.kind, Phase::End, _span.bytes, _span.flops, nanoseconds});
+  }
+}
+
+template <typename _expr, typename = void>
+struct HasNonZeros : std::false_type {};
+
+template <typename _expr>
+struct HasNonZeros<_expr,
+                   std::void_t<decltype(std::declval<const _expr&>()
+                                            .NonZeros())>>
+    : std::bool_constant<
+          Traits::Core::is_sparse_v<typename _expr::core_impl>> {};
+
+}  // namespace Impl
+
+inline const char* Name(Kind _kind) {
+  constexpr const char* names[kind_count] = {"Evaluate",
+                                             "Assign",
+                                             "Temporary",
+                                             "Cast",
+                                             "Reorder",
+                                             "Product",
+                                             "Merge",
+                                             "Copy",
+                                             "Transpose"};
+  return names[static_cast<std::size_t>(_kind)];
+}
+
+inline Stats Read(Kind _kind) {
+  const Impl::Counters& c = Impl::Table()[static_cast<std::size_t>(_kind)];
+  return Stats{c.count.load(std::memory_order_relaxed),
+               c.bytes.load(std::memory_order_relaxed),
+               c.flops.load(std::memory_order_relaxed),
+               c.nanoseconds.load(std::memory_order_relaxed)};
+}
+
+inline void Reset() {
+  for (Impl::Counters& c : Impl::Table()) {
+    c.count.store(0, std::memory_order_relaxed);
+    c.bytes.store(0, std::memory_order_relaxed);
+    c.flops.store(0, std::memory_order_relaxed);
+    c.nanoseconds.store(0, std::memory_order_relaxed);
+  }
+}
+
+inline Sink SetSink(Sink _sink) {
+  return std::exchange(Impl::CurrentSink(), std::move(_sink));
+}
+
+constexpr void Count(Kind _kind, std::uint64_t _bytes, std::uint64_t _flops) {
+  if constexpr (SGLTY_INSTRUMENT != 0) {
+    if (!Config::IsConstantEvaluated()) {
+      Impl::Add(_kind, _bytes, _flops, 0);
+    }
+  }
+}
+
+constexpr Span Begin(Kind _kind, std::uint64_t _bytes, std::uint64_t _flops) {
+  Span span{_kind, _bytes, _flops, 0};
+  if constexpr (SGLTY_INSTRUMENT >= 2) {
+    if (!Config::IsConstantEvaluated()) {
+      span.start = Impl::Open(_kind, _bytes, _flops);
+    }
+  }
+  return span;
+}
+
+constexpr void End(const Span& _span) {
+  if constexpr (SGLTY_INSTRUMENT >= 2) {
+    if (!Config::IsConstantEvaluated()) {
+      Impl::Close(_span);
+    }
+  } else {
+    Count(_span.kind, _span.bytes, _span.flops);
+  }
+}
+
+template <typename _expr>
+constexpr std::uint64_t Bytes(const _expr& _e) {
+  using value_type = typename _expr::core_impl::value_type;
+
+  constexpr std::uint64_t size = sizeof(value_type);
+
+  if constexpr (Impl::HasNonZeros<_expr>::value) {
+    return std::uint64_t(_e.NonZeros()) * size;
+  } else {
+    return std::uint64_t(_e.Rows()) * std::uint64_t(_e.Cols()) * size;
+  }
+}
+
+template <typename _expr>
+constexpr std::uint64_t Flops(const _expr& _e) {
+  if constexpr (Traits::Expr::is_dynamic_v<_expr> &&
+                Traits::Expr::contains_product_v<_expr>) {
+    return 0;
+  } else {
+    return std::uint64_t(_e.Rows()) * std::uint64_t(_e.Cols()) *
+           Traits::Expr::element_cost_v<_expr>;
+  }
+}
+
+}  // namespace Sglty::Trace
+
+// Singularity/Trace/Impl/Tracer.tpp
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "../Config.hpp"
+
+namespace Sglty::Trace {
+
+/**
+ * @brief What an instrumented region does.
+ */
+enum class Kind {
+  /// `Expr::Evaluate()` and constructing a matrix from an expression.
+  Evaluate,
+
+  /// `Expr::Assign()`, i.e. `operator=` and the compound assignments.
+  Assign,
+
+  /// A matrix materialized for an expression: scratch space of an aliasing
+  /// assignment, `Expr::Materialized` operands, `Cast()` and `Reorder()`.
+  Temporary,
+
+  /// `Matrix::Cast()`.
+  Cast,
+
+  /// `Matrix::Reorder()`.
+  Reorder,
+
+  /// A dense or sparse product kernel, including accumulating ones.
+  Product,
+
+  /// A sparse sum or difference merged over the stored entries.
+  Merge,
+
+  /// A copy through `Kernel::Copy`.
+  Copy,
+
+  /// `Matrix::TransposeInPlace()` run by an assignment.
+  Transpose
+};
+
+/// Number of `Kind` enumerators.
+constexpr inline std::size_t kind_count = 9;
+
+/**
+ * @brief Returns the name of `_kind`, e.g. `"Assign"`.
+ */
+const char* Name(Kind _kind);
+
+/**
+ * @brief Totals recorded for one `Kind` since the last `Reset()`.
+ *
+ * `bytes` counts elements written (materialized for `Temporary`) times their
+ * size, `flops` the estimated scalar operations (`2 * m * n * k` for
+ * products). `nanoseconds` stays `0` below `SGLTY_INSTRUMENT` level 2.
+ */
+struct Stats {
+  std::uint64_t count       = 0;
+  std::uint64_t bytes       = 0;
+  std::uint64_t flops       = 0;
+  std::uint64_t nanoseconds = 0;
+};
+
+/**
+ * @brief Returns the totals of `_kind`.
+ */
+Stats Read(Kind _kind);
+
+/**
+ * @brief Clears the totals of every kind.
+ */
+void Reset();
+
+/**
+ * @brief Whether a `Record` opens or closes a region.
+ */
+enum class Phase { Begin, End };
+
+/**
+ * @brief One event reported to the sink.
+ *
+ * Regions nest: e.g. the `Product` of `c = a * b` is reported between the
+ * `Begin` and `End` of its `Assign`, on the thread that started it. The
+ * totals of an outer kind include the work of the regions nested in it.
+ * Sizes only known once a region ran (e.g. the entries of a sparse result)
+ * are `0` on `Begin`.
+ */
+struct Record {
+  Kind kind;
+  Phase phase;
+  std::uint64_t bytes;
+  std::uint64_t flops;
+  std::uint64_t nanoseconds;  ///< Duration of the region, `0` on `Begin`.
+};
+
+/**
+ * @brief Receives every `Record` at `SGLTY_INSTRUMENT` level 2, e.g. to
+ * forward regions as Perfetto slices or ITT tasks.
+ */
+using Sink = std::function<void(const Record&)>;
+
+/**
+ * @brief Replaces the sink.
+ *
+ * Must not be called while another thread is evaluating an expression.
+ *
+ * @param _sink The new sink, or an empty one to report nothing.
+ * @return The previous sink.
+ */
+Sink SetSink(Sink _sink);
+
+/**
+ * @brief An open region, returned by `Begin()` and closed by `End()`.
+ *
+ * Trivially destructible, so regions can be opened in `constexpr` functions.
+ */
+struct Span {
+  Kind kind;
+  std::uint64_t bytes;
+  std::uint64_t flops;
+  std::uint64_t start;
+};
+
+/**
+ * @brief Adds one event of `_kind` to the totals, without timing it.
+ *
+ * Does nothing when `SGLTY_INSTRUMENT` is `0` or during constant evaluation.
+ */
+constexpr void Count(Kind _kind, std::uint64_t _bytes, std::uint64_t _flops);
+
+/**
+ * @brief Opens a region of `_kind`.
+ *
+ * At level 2, starts its timer and reports `Phase::Begin` to the sink.
+ */
+constexpr Span Begin(Kind _kind, std::uint64_t _bytes, std::uint64_t _flops);
+
+/**
+ * @brief Closes `_span` and adds it to the totals.
+ *
+ * At level 2, adds its duration and reports `Phase::End` to the sink.
+ */
+constexpr void End(const Span& _span);
+
+/**
+ * @brief Bytes of the elements of `_e`, i.e. `Rows() * Cols()` elements, or
+ * only the stored ones of a sparse matrix.
+ */
+template <typename _expr>
+constexpr std::uint64_t Bytes(const _expr& _e);
+
+/**
+ * @brief Estimated scalar operations of evaluating `_e` element by element,
+ * see `Sglty::Traits::Expr::element_cost_v`.
+ *
+ * `0` when the estimate depends on the runtime inner dimension of a product;
+ * product kernels report their exact count as `Kind::Product`.
+ */
+template <typename _expr>
+constexpr std::uint64_t Flops(const _expr& _e);
+
+}  // namespace Sglty::Trace
+
+#include "Impl/Tracer.tpp"
+
+// Singularity/Trace/Tracer.hpp
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include "../Core/Enums.hpp"
 
 namespace Sglty::Traits::Core {
@@ -26,8 +28,18 @@ namespace Sglty::Traits::Core {
  *
  * - Dense + Col
  *
+ * - Dense + Tiled
+ *
+ * - Dense + Morton
+ *
+ * - Sparse + Row (compressed rows, CSR)
+ *
+ * - Sparse + Col (compressed columns, CSC)
+ *
  * - Sparse + Undefined
  *
+ * - Structured + Undefined (see `Sglty::Traits::Core::GetStructured`)
+ *
  * @tparam _core_type  Enum for core category
  * @tparam _core_major Enum for major variation
  *
@@ -39,6 +51,136 @@ namespace Sglty::Traits::Core {
 template <Sglty::Core::Type _core_type, Sglty::Core::Major _core_major>
 struct Get;
 
+/**
+ * @brief `Get` extended with the storage layout of a padded, aligned core.
+ *
+ * Adds two members to the trait group:
+ *
+ * - `alignment`: the byte alignment of the first element of the storage
+ *
+ * - `leading_dim`: the distance in elements between the starts of two
+ * consecutive rows (row-major) or columns (column-major)
+ *
+ * Example Usage:
+ * ```
+ * using core_traits = Sglty::Traits::Core::GetAligned<
+ *   Sglty::Core::Type::Dense,
+ *   Sglty::Core::Major::Row,
+ *   64,
+ *   16
+ * >;
+ * //! Row-major storage, 64-byte aligned, rows start every 16 elements.
+ * ```
+ *
+ * @tparam _core_type   Enum for core category
+ * @tparam _core_major  Enum for major variation
+ * @tparam _alignment   Byte alignment of the storage
+ * @tparam _leading_dim Elements between consecutive rows / columns
+ *
+ * @see Sglty::Traits::Core::alignment_v
+ * @see Sglty::Traits::Core::leading_dim_v
+ */
+template <Sglty::Core::Type _core_type,
+          Sglty::Core::Major _core_major,
+          std::size_t _alignment,
+          std::size_t _leading_dim>
+struct GetAligned;
+
+/**
+ * @brief `Get` extended with the layout of a core that views external storage.
+ *
+ * Adds two members to the trait group:
+ *
+ * - `is_view`: always `true`, the core neither owns nor allocates its elements
+ *
+ * - `leading_dim`: as in `GetAligned`, or `Sglty::Traits::Size::dynamic` when
+ * only known at runtime
+ *
+ * Example Usage:
+ * ```
+ * using core_traits = Sglty::Traits::Core::GetView<
+ *   Sglty::Core::Type::Dense,
+ *   Sglty::Core::Major::Row,
+ *   Sglty::Traits::Size::dynamic
+ * >;
+ * //! Row-major view, rows start every `OuterStride()` elements.
+ * ```
+ *
+ * @tparam _core_type   Enum for core category
+ * @tparam _core_major  Enum for major variation
+ * @tparam _leading_dim Elements between consecutive rows / columns
+ *
+ * @see Sglty::Traits::Core::is_view_v
+ * @see Sglty::Traits::Core::leading_dim_v
+ */
+template <Sglty::Core::Type _core_type,
+          Sglty::Core::Major _core_major,
+          std::size_t _leading_dim>
+struct GetView;
+
+/**
+ * @brief `Get` extended with the tile size of a core stored in square tiles.
+ *
+ * Adds one member to the trait group:
+ *
+ * - `tile`: the extent of a tile; elements are stored `tile` x `tile` at a
+ * time, tiles one after the other and the elements within a tile in `major`
+ * order, which is `Row` or `Col`
+ *
+ * Such storage is neither row- nor column-major as a whole, so the dense
+ * kernels reading `Data()` with strides do not apply to it.
+ *
+ * Example Usage:
+ * ```
+ * using core_traits = Sglty::Traits::Core::GetTiled<
+ *   Sglty::Core::Type::Dense,
+ *   Sglty::Core::Major::Row,
+ *   64
+ * >;
+ * //! 64 x 64 tiles, in row-major order of tiles and of elements.
+ * ```
+ *
+ * @tparam _core_type  Enum for core category
+ * @tparam _core_major Enum for major variation
+ * @tparam _tile       Extent of a tile
+ *
+ * @see Sglty::Traits::Core::tile_v
+ */
+template <Sglty::Core::Type _core_type,
+          Sglty::Core::Major _core_major,
+          std::size_t _tile>
+struct GetTiled;
+
+/**
+ * @brief `Get` for a `Structured` core, extended with the structure its type
+ * implies.
+ *
+ * Adds three members to the trait group:
+ *
+ * - `lower`, `upper`: the number of sub- and super-diagonals that may hold
+ * non-zero elements, `Sglty::Traits::Size::dynamic` when unbounded; every
+ * element further from the diagonal is zero
+ *
+ * - `is_symmetric`: element (i, j) equals element (j, i), and only the upper
+ * triangle is stored; both bands are then unbounded
+ *
+ * The major is `Undefined`, as such storage is neither row- nor column-major.
+ *
+ * Example Usage:
+ * ```
+ * using core_traits = Sglty::Traits::Core::GetStructured<1, 1, false>;
+ * //! Tridiagonal: the diagonal and one diagonal on either side.
+ * ```
+ *
+ * @tparam _lower     Sub-diagonals that may be non-zero
+ * @tparam _upper     Super-diagonals that may be non-zero
+ * @tparam _symmetric Whether the elements mirror along the diagonal
+ *
+ * @see Sglty::Traits::Core::is_structured_v
+ */
+template <std::size_t _lower, std::size_t _upper, bool _symmetric>
+struct GetStructured;
+
 }  // namespace Sglty::Traits::Core
 
 namespace Sglty::Traits::Core {
@@ -164,6 +306,289 @@ extern const bool has_rebind_size_traits_v;
 template <typename _core_impl>
 extern const bool has_member_functions_v;
 
+/**
+ * @brief Checks whether a core supports SIMD packet access.
+ *
+ * Optional part of the core interface, used by the packet evaluation path of
+ * `Sglty::Expr::Assign`. Expected signatures:
+ * ```
+ * Simd::Packet<value_type> LoadPacket(size_type, size_type) const;
+ * void StorePacket(size_type, size_type, const Simd::Packet<value_type>&);
+ * ```
+ * Both access `Simd::Packet<value_type>::size` consecutive elements starting
+ * at the given position along the core's major axis. `value_type` must
+ * satisfy `Sglty::Simd::is_vectorizable_v`, and the major must be `Row` or
+ * `Col`.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const bool has_packet_access_v;
+
+/**
+ * @brief Byte alignment of a core's storage.
+ *
+ * Read from `core_traits::alignment` when present (see
+ * `Sglty::Traits::Core::GetAligned`), `alignof(value_type)` otherwise.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const std::size_t alignment_v;
+
+/**
+ * @brief Checks whether a core has a runtime-sized shape.
+ *
+ * True when either extent in `size_traits` equals
+ * `Sglty::Traits::Size::dynamic`. Such cores must additionally provide:
+ * ```
+ * _core_impl(size_type rows, size_type cols);
+ * size_type Rows() const;
+ * size_type Cols() const;
+ * void      Resize(size_type rows, size_type cols);
+ * ```
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const bool is_dynamic_v;
+
+/**
+ * @brief Checks whether a core stores its elements in compressed sparse form.
+ *
+ * True when `core_traits::core_type` is `Sglty::Core::Type::Sparse`. Such
+ * cores must additionally provide the compressed buffers read by the sparse
+ * kernels:
+ * ```
+ * static constexpr size_type capacity;  // maximum stored entries
+ *
+ * size_type        NonZeros() const;
+ * size_type*       OuterIndex();
+ * const size_type* OuterIndex() const;
+ * size_type*       InnerIndex();
+ * const size_type* InnerIndex() const;
+ * ```
+ * with `Data()` returning the values of the stored entries.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ *
+ * @see Sglty::Core::Sparse
+ */
+template <typename _core_impl>
+extern const bool is_sparse_v;
+
+/**
+ * @brief Checks whether a core views storage it does not own.
+ *
+ * True when `core_traits::is_view` is present and set (see
+ * `Sglty::Traits::Core::GetView`). A default-constructed view refers to no
+ * storage, so views cannot be the result of an expression: their
+ * `core_rebind_*` aliases name owning cores instead (see
+ * `Sglty::Traits::Core::plain_t`).
+ *
+ * Copying a view copies the reference to the storage, never the elements.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ *
+ * @see Sglty::Core::Map
+ * @see Sglty::Core::MapStrided
+ */
+template <typename _core_impl>
+extern const bool is_view_v;
+
+/**
+ * @brief Distance in elements between consecutive rows (row-major) or columns
+ * (column-major) of a core's storage.
+ *
+ * Read from `core_traits::leading_dim` when present (see
+ * `Sglty::Traits::Core::GetAligned`). Otherwise storage is assumed tightly
+ * packed: `cols` for row-major and `rows` for column-major cores.
+ *
+ * `Sglty::Traits::Size::dynamic` when only known at runtime. Fixed-size cores
+ * with a runtime leading dimension must then provide:
+ * ```
+ * size_type OuterStride() const;
+ * ```
+ * while runtime-sized cores are assumed tightly packed.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ *
+ * @see Sglty::Types::Matrix::OuterStride
+ */
+template <typename _core_impl>
+extern const std::size_t leading_dim_v;
+
+/**
+ * @brief Extent of the square tiles a core stores its elements in.
+ *
+ * Read from `core_traits::tile` when present (see
+ * `Sglty::Traits::Core::GetTiled`), `SGLTY_TILE_EXTENT` for cores stored
+ * `Sglty::Core::Major::Tiled`, and `0` otherwise. `Sglty::Types::Traverse`
+ * visits tiled cores tile by tile.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ *
+ * @see Sglty::Core::Mapped
+ */
+template <typename _core_impl>
+extern const std::size_t tile_v;
+
+/**
+ * @brief Checks whether a core has a structure known from its type.
+ *
+ * True when `core_traits::core_type` is `Sglty::Core::Type::Structured` (see
+ * `Sglty::Traits::Core::GetStructured`). Such cores only store the elements
+ * their structure does not imply:
+ *
+ * - the const `At()` returns a reference to zero outside the band, or to the
+ *   mirrored element for symmetric cores
+ *
+ * - the mutable `At()` only accepts stored elements, and
+ *   `Sglty::Types::Traverse` only visits those (the band, or the upper
+ *   triangle), so assigning an expression to such a matrix keeps the part of
+ *   it within the structure
+ *
+ * - `core_rebind_major<Row>` names a dense core holding the same elements,
+ *   used for results without structure
+ *
+ * and optionally provide:
+ * ```
+ * using core_transpose = // the core of the transpose //;
+ *
+ * template <std::size_t lower, std::size_t upper>
+ * using core_rebind_band = // the same core with other bands //;
+ * ```
+ * read by `transpose_t`, `sum_t` and `product_t`.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ *
+ * @see Sglty::Core::Banded
+ * @see Sglty::Core::Symmetric
+ * @see Sglty::Core::Identity
+ */
+template <typename _core_impl>
+extern const bool is_structured_v;
+
+/**
+ * @brief Checks whether the elements of a core mirror along its diagonal.
+ *
+ * Read from `core_traits::is_symmetric` when present, `false` otherwise.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const bool is_symmetric_v;
+
+/**
+ * @brief Number of sub-diagonals of a core that may hold non-zero elements.
+ *
+ * Read from `core_traits::lower` when present (see
+ * `Sglty::Traits::Core::GetStructured`), `Sglty::Traits::Size::dynamic`
+ * (unbounded) otherwise. Products only read the operand elements within the
+ * bands (see `Sglty::Expr::MulMatrix`).
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const std::size_t lower_bandwidth_v;
+
+/**
+ * @brief Number of super-diagonals of a core that may hold non-zero
+ * elements.
+ *
+ * Same as `lower_bandwidth_v`, from `core_traits::upper`.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const std::size_t upper_bandwidth_v;
+
+namespace Impl {
+
+template <typename _core_impl>
+struct Plain;
+
+template <typename _core_impl, typename _enable>
+struct Transpose;
+
+template <typename _lhs, typename _rhs, bool, bool>
+struct Sum;
+
+template <typename _lhs, typename _rhs, bool, bool>
+struct Product;
+
+}  // namespace Impl
+
+/**
+ * @brief The owning core able to hold the elements of `_core_impl`.
+ *
+ * `_core_impl` itself, except for views (see `Sglty::Traits::Core::is_view_v`)
+ * where it is their size rebind to the same shape. Used for results and
+ * temporaries that must own their storage.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+using plain_t = typename Impl::Plain<_core_impl>::type;
+
+/**
+ * @brief The core holding the transpose of the elements of `_core_impl`.
+ *
+ * `core_transpose` when the core defines it (e.g. upper and lower triangles,
+ * see `Sglty::Traits::Core::is_structured_v`), its size rebind to the
+ * transposed shape otherwise.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+using transpose_t = typename Impl::Transpose<_core_impl, void>::type;
+
+/**
+ * @brief The core holding the sum of the elements of `_lhs` and `_rhs`, two
+ * cores of the same shape.
+ *
+ * - cores that agree (as by `plain_t`) sum into that core
+ *
+ * - a structured core summed with another one sums into the other
+ *
+ * - two bands sum into the band covering both, and other structured cores
+ *   into a dense core; so does a band covering the whole matrix
+ *
+ * Other combinations have no common core, and yield `plain_t<_lhs>`.
+ *
+ * @tparam _lhs Core of the left-hand side.
+ * @tparam _rhs Core of the right-hand side.
+ */
+template <typename _lhs, typename _rhs>
+using sum_t = typename Impl::Sum<_lhs,
+                                 _rhs,
+                                 is_structured_v<_lhs>,
+                                 is_structured_v<_rhs>>::type;
+
+/**
+ * @brief The core holding the product of `_lhs` and `_rhs`, shaped as the
+ * rows of `_lhs` and the columns of `_rhs`.
+ *
+ * - a product of two bands is a band, whose bandwidths are the sums of
+ *   those of the operands (e.g. triangular x triangular of the same side, or
+ *   diagonal x banded); other structured operands, and bands covering the
+ *   whole matrix, give a dense core
+ *
+ * - a structured operand multiplied with another one gives the core of the
+ *   other
+ *
+ * - otherwise the core of `_lhs`, or that of `_rhs` for sparse x dense
+ *   products
+ *
+ * @tparam _lhs Core of the left-hand side.
+ * @tparam _rhs Core of the right-hand side.
+ */
+template <typename _lhs, typename _rhs>
+using product_t = typename Impl::Product<_lhs,
+                                         _rhs,
+                                         is_structured_v<_lhs>,
+                                         is_structured_v<_rhs>>::type;
+
 /**
  * @brief Checks whether a core satisfies all required traits and behaviors.
  *
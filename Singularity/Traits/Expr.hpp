@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+
+#include "../Expr/Enums.hpp"
+
 namespace Sglty::Traits::Expr {
 
 /**
@@ -63,6 +67,197 @@ extern const bool has_interface_v;
 template <typename _expr>
 extern const bool is_valid_v;
 
+/**
+ * @brief Checks whether an expression is a terminal (leaf) node.
+ *
+ * Terminals are concrete `Sglty::Types::Matrix<...>` instances, i.e. nodes
+ * that own (or view) actual storage instead of computing values on the fly.
+ *
+ * @tparam _expr Expression type being inspected.
+ *
+ * @see Sglty::Traits::Expr::nested_t
+ */
+template <typename _expr>
+extern const bool is_terminal_v;
+
+namespace Impl {
+
+template <typename _operand>
+struct Nested;
+
+}  // namespace Impl
+
+/**
+ * @brief Storage policy for operands held inside expression nodes.
+ *
+ * Maps a (forwarded) operand type to the type an expression node should store
+ * it as:
+ *
+ * - lvalue terminals (`Matrix&`, `const Matrix&`) are held by const reference,
+ *   so building `a + b` never copies the matrices themselves
+ *
+ * - rvalue terminals (e.g. the result of `Cast()`) are held by value, so the
+ *   node never refers to a temporary that is about to die
+ *
+ * - non-terminal expression nodes and scalars are held by value, as they are
+ *   small and usually temporaries
+ *
+ * Example:
+ * ```
+ * nested_t<Matrix<C>&>       // -> const Matrix<C>&
+ * nested_t<Matrix<C>>        // -> Matrix<C>
+ * nested_t<Expr::Binary<..>&> // -> Expr::Binary<..>
+ * nested_t<float>            // -> float
+ * ```
+ *
+ * Since lvalue terminals are referenced, an expression must not outlive the
+ * matrices it was built from.
+ *
+ * @tparam _operand The operand type as deduced by a forwarding reference.
+ *
+ * @see Sglty::Traits::Expr::is_terminal_v
+ */
+template <typename _operand>
+using nested_t = typename Impl::Nested<_operand>::type;
+
+/**
+ * @brief Checks whether an expression node is a product.
+ *
+ * A product is a `Binary`/`Unary` node whose operator reads more than one
+ * operand element per output element (`Sglty::Traits::Op::reads_v > 1`),
+ * e.g. `Binary<_lhs, _rhs, MulMatrix>`.
+ *
+ * @tparam _expr Expression type being inspected.
+ *
+ * @see Sglty::Traits::Op::reads_v
+ */
+template <typename _expr>
+extern const bool is_product_v;
+
+/**
+ * @brief Checks whether an expression tree contains a product that is still
+ * evaluated lazily.
+ *
+ * Materialized sub-expressions (`Sglty::Expr::Materialized`) count as
+ * terminals.
+ *
+ * @tparam _expr Expression type being inspected.
+ *
+ * @see Sglty::Traits::Expr::is_product_v
+ */
+template <typename _expr>
+extern const bool contains_product_v;
+
+/**
+ * @brief Estimated scalar operations needed to compute one element of an
+ * expression through `operator()(i, j)`.
+ *
+ * Computed recursively as
+ * `Op::cost_v + Op::reads_v * (element cost of each operand)`, where
+ * terminals, scalars and generated nodes (`Sglty::Expr::Constant`, `Zero`
+ * and `Identity`) cost nothing, and an `Sglty::Expr::Broadcast` costs its
+ * operand.
+ *
+ * @tparam _expr Expression type being inspected.
+ *
+ * @see Sglty::Traits::Expr::cost_v
+ */
+template <typename _expr>
+extern const std::size_t element_cost_v;
+
+/**
+ * @brief Estimated scalar operations needed to evaluate a whole expression.
+ *
+ * Equals `rows * cols * element_cost_v` plus the cost of every temporary the
+ * expression materializes (see `Sglty::Expr::Materialized`). This makes the
+ * effect of evaluation strategies visible at compile time:
+ * ```
+ * using M = Sglty::DenseMat<float, 64, 64>;
+ * M a, b, c;
+ * // (a * b) materialized once: ~2 * 2 * 64^3 instead of ~2 * 64^4
+ * static_assert(Sglty::Traits::Expr::cost_v<decltype((a * b) * c)> <=
+ *               4 * 64 * 64 * 64);
+ * ```
+ *
+ * Costs saturate at `Sglty::Traits::Size::dynamic` instead of wrapping, so a
+ * runtime-sized expression, or a product with a runtime inner dimension,
+ * costs `dynamic` and fails every finite budget.
+ *
+ * @tparam _expr Expression type being inspected.
+ */
+template <typename _expr>
+extern const std::size_t cost_v;
+
+/**
+ * @brief Memory access pattern of evaluating an expression element by
+ * element.
+ *
+ * The largest `Sglty::Traits::Op::access_v` of the nodes that are evaluated
+ * lazily; terminals, scalars and materialized sub-expressions are
+ * `Access::Contiguous`. E.g. `a + b` is contiguous, `Trp(a) + b` strided and
+ * `c + a * b` reuse:
+ * ```
+ * static_assert(Sglty::Traits::Expr::access_v<decltype(a + b)> ==
+ *               Sglty::Expr::Access::Contiguous);
+ * ```
+ * Large strided expressions over dense storage are evaluated by first
+ * transposing their strided operands through a tiled copy (see
+ * `SGLTY_STRIDED_THRESHOLD`).
+ *
+ * @tparam _expr Expression type being inspected.
+ *
+ * @see Sglty::Expr::Access
+ */
+template <typename _expr>
+extern const Sglty::Expr::Access access_v;
+
+/**
+ * @brief Checks whether an expression can be evaluated a SIMD packet at a
+ * time through `Packet(i, j)`.
+ *
+ * True for terminals whose core satisfies
+ * `Sglty::Traits::Core::has_packet_access_v`, and for `Binary` / `Unary`
+ * nodes whose operator satisfies `Sglty::Traits::Op::is_vectorizable_v` and
+ * whose operands are vectorizable themselves (scalars always are). Anything
+ * else, including `Trp` and `MulMatrix`, is evaluated element by element.
+ *
+ * @tparam _expr Expression type being inspected.
+ */
+template <typename _expr>
+extern const bool is_vectorizable_v;
+
+/**
+ * @brief Checks whether an expression has a runtime-sized shape.
+ *
+ * True when either `_expr::rows` or `_expr::cols` equals
+ * `Sglty::Traits::Size::dynamic`, in which case the actual extents must be
+ * read through `Rows()` / `Cols()`. False for anything that is not an
+ * expression, such as scalars.
+ *
+ * @tparam _expr Type being inspected.
+ */
+template <typename _expr>
+extern const bool is_dynamic_v;
+
+/**
+ * @brief Checks whether evaluating an expression may read storage that
+ * `_matrix` writes.
+ *
+ * True when a terminal of `_expr` may share storage with `_matrix`: it has
+ * the same core, or either core is a view (see
+ * `Sglty::Traits::Core::is_view_v`) over the same value type. Materialized
+ * sub-expressions and scalars never alias, as they are evaluated before
+ * `_matrix` is written.
+ *
+ * When false, `_expr` is always evaluated straight into `_matrix`; when true,
+ * `Sglty::Expr::Aliases` decides at runtime whether a scratch buffer is needed.
+ *
+ * @tparam _expr   Expression type being inspected.
+ * @tparam _matrix The `Matrix` type written to.
+ */
+template <typename _expr, typename _matrix>
+extern const bool may_alias_v;
+
 }  // namespace Sglty::Traits::Expr
 
 #include "Impl/Expr.tpp"
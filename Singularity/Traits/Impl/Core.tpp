@@ -2,7 +2,14 @@
 
 #include "../Core.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
+
+#include "../Size.hpp"
+#include "../../Config.hpp"
+#include "../../Simd/Packet.hpp"
 
 namespace Sglty::Traits::Core {
 
@@ -13,13 +20,60 @@ struct Get {
 
   static_assert(
       (core_type == Sglty::Core::Type::Dense &&
-       (core_major == Sglty::Core::Major::Row ||
-        core_major == Sglty::Core::Major::Col)) ||
+       core_major != Sglty::Core::Major::Undefined) ||
           (core_type == Sglty::Core::Type::Sparse &&
+           core_major != Sglty::Core::Major::Tiled &&
+           core_major != Sglty::Core::Major::Morton) ||
+          (core_type == Sglty::Core::Type::Structured &&
            core_major == Sglty::Core::Major::Undefined),
       "Error: Invalid combination of `_core_type` and `_core_major` passed.");
 };
 
+template <Sglty::Core::Type _core_type,
+          Sglty::Core::Major _core_major,
+          std::size_t _alignment,
+          std::size_t _leading_dim>
+struct GetAligned : Get<_core_type, _core_major> {
+  static constexpr std::size_t alignment   = _alignment;
+  static constexpr std::size_t leading_dim = _leading_dim;
+
+  static_assert(alignment > 0 && (alignment & (alignment - 1)) == 0,
+                "Error: `_alignment` must be a power of two.");
+};
+
+template <Sglty::Core::Type _core_type,
+          Sglty::Core::Major _core_major,
+          std::size_t _leading_dim>
+struct GetView : Get<_core_type, _core_major> {
+  static constexpr bool is_view            = true;
+  static constexpr std::size_t leading_dim = _leading_dim;
+};
+
+template <Sglty::Core::Type _core_type,
+          Sglty::Core::Major _core_major,
+          std::size_t _tile>
+struct GetTiled : Get<_core_type, _core_major> {
+  static constexpr std::size_t tile = _tile;
+
+  static_assert(tile > 0, "Error: `_tile` must be positive.");
+  static_assert(_core_major == Sglty::Core::Major::Row ||
+                    _core_major == Sglty::Core::Major::Col,
+                "Error: `_core_major` orders the tiles, so it must be `Row` "
+                "or `Col`.");
+};
+
+template <std::size_t _lower, std::size_t _upper, bool _symmetric>
+struct GetStructured
+    : Get<Sglty::Core::Type::Structured, Sglty::Core::Major::Undefined> {
+  static constexpr std::size_t lower = _lower;
+  static constexpr std::size_t upper = _upper;
+  static constexpr bool is_symmetric = _symmetric;
+
+  static_assert(!is_symmetric || (lower == Traits::Size::dynamic &&
+                                  upper == Traits::Size::dynamic),
+                "Error: a symmetric core has no zero band.");
+};
+
 namespace Impl {
 
 template <typename, typename _enable = void>
@@ -117,6 +171,224 @@ struct HasMemberFunctions<
       _m_Data_nonconst_returns_ptr && _m_Data_const_returns_cptr;
 };
 
+// Packets run along rows or columns, so blocked majors do without them.
+template <typename _core_impl, typename _enable = void>
+struct HasPacketAccess : std::false_type {};
+
+template <typename _core_impl>
+struct HasPacketAccess<
+    _core_impl,
+    std::void_t<std::enable_if_t<
+                    Simd::is_vectorizable_v<typename _core_impl::value_type> &&
+                    (_core_impl::core_traits::core_major ==
+                         Sglty::Core::Major::Row ||
+                     _core_impl::core_traits::core_major ==
+                         Sglty::Core::Major::Col)>,
+                decltype(std::declval<const _core_impl&>().LoadPacket(
+                    std::size_t{}, std::size_t{})),
+                decltype(std::declval<_core_impl&>().StorePacket(
+                    std::size_t{},
+                    std::size_t{},
+                    std::declval<const Simd::Packet<
+                        typename _core_impl::value_type>&>()))>>
+    : std::true_type {};
+
+template <typename _core_impl, typename _enable = void>
+struct Alignment
+    : std::integral_constant<std::size_t,
+                             alignof(typename _core_impl::value_type)> {};
+
+template <typename _core_impl>
+struct Alignment<_core_impl,
+                 std::void_t<decltype(_core_impl::core_traits::alignment)>>
+    : std::integral_constant<std::size_t,
+                             _core_impl::core_traits::alignment> {};
+
+template <typename _core_impl, typename _enable = void>
+struct LeadingDim
+    : std::integral_constant<std::size_t,
+                             _core_impl::core_traits::core_major ==
+                                     Sglty::Core::Major::Row
+                                 ? _core_impl::size_traits::cols
+                                 : _core_impl::size_traits::rows> {};
+
+template <typename _core_impl>
+struct LeadingDim<_core_impl,
+                  std::void_t<decltype(_core_impl::core_traits::leading_dim)>>
+    : std::integral_constant<std::size_t,
+                             _core_impl::core_traits::leading_dim> {};
+
+template <typename _core_impl, typename _enable = void>
+struct IsView : std::false_type {};
+
+template <typename _core_impl>
+struct IsView<_core_impl,
+              std::void_t<decltype(_core_impl::core_traits::is_view)>>
+    : std::bool_constant<_core_impl::core_traits::is_view> {};
+
+template <typename _core_impl, typename _enable = void>
+struct Tile
+    : std::integral_constant<std::size_t,
+                             _core_impl::core_traits::core_major ==
+                                     Sglty::Core::Major::Tiled
+                                 ? SGLTY_TILE_EXTENT
+                                 : 0> {};
+
+template <typename _core_impl>
+struct Tile<_core_impl, std::void_t<decltype(_core_impl::core_traits::tile)>>
+    : std::integral_constant<std::size_t, _core_impl::core_traits::tile> {};
+
+template <typename _core_impl>
+struct Plain {
+  using type = std::conditional_t<
+      IsView<_core_impl>::value,
+      typename _core_impl::template core_rebind_size<
+          _core_impl::size_traits::rows,
+          _core_impl::size_traits::cols>,
+      _core_impl>;
+};
+
+template <typename _core_impl, typename _enable = void>
+struct IsSymmetric : std::false_type {};
+
+template <typename _core_impl>
+struct IsSymmetric<
+    _core_impl,
+    std::void_t<decltype(_core_impl::core_traits::is_symmetric)>>
+    : std::bool_constant<_core_impl::core_traits::is_symmetric> {};
+
+template <typename _core_impl, typename _enable = void>
+struct LowerBandwidth
+    : std::integral_constant<std::size_t, Traits::Size::dynamic> {};
+
+template <typename _core_impl>
+struct LowerBandwidth<_core_impl,
+                      std::void_t<decltype(_core_impl::core_traits::lower)>>
+    : std::integral_constant<std::size_t, _core_impl::core_traits::lower> {};
+
+template <typename _core_impl, typename _enable = void>
+struct UpperBandwidth
+    : std::integral_constant<std::size_t, Traits::Size::dynamic> {};
+
+template <typename _core_impl>
+struct UpperBandwidth<_core_impl,
+                      std::void_t<decltype(_core_impl::core_traits::upper)>>
+    : std::integral_constant<std::size_t, _core_impl::core_traits::upper> {};
+
+template <typename _core_impl, typename _enable>
+struct Transpose {
+  using type = typename _core_impl::template core_rebind_size<
+      _core_impl::size_traits::cols,
+      _core_impl::size_traits::rows>;
+};
+
+template <typename _core_impl>
+struct Transpose<_core_impl,
+                 std::void_t<typename _core_impl::core_transpose>> {
+  using type = typename _core_impl::core_transpose;
+};
+
+// `_lower` and `_upper` clamped to the bands a `_rows` x `_cols` core has.
+constexpr std::size_t ClampBand(const std::size_t _band,
+                                const std::size_t _extent) {
+  return _extent == 0 ? 0 : _band < _extent ? _band : _extent - 1;
+}
+
+// `_lhs` with `_lower` and `_upper` bands when `_rhs` is the same kind of
+// band and some elements stay zero, a dense core otherwise.
+template <typename _lhs,
+          typename _rhs,
+          std::size_t _lower,
+          std::size_t _upper,
+          typename _enable = void>
+struct Band {
+  using type =
+      typename _lhs::template core_rebind_major<Sglty::Core::Major::Row>;
+};
+
+template <typename _lhs,
+          typename _rhs,
+          std::size_t _lower,
+          std::size_t _upper>
+struct Band<
+    _lhs,
+    _rhs,
+    _lower,
+    _upper,
+    std::enable_if_t<
+        std::is_same_v<typename _lhs::core_base, typename _rhs::core_base> &&
+        (_lower < ClampBand(Traits::Size::dynamic, _lhs::size_traits::rows) ||
+         _upper < ClampBand(Traits::Size::dynamic, _lhs::size_traits::cols)),
+        std::void_t<
+            typename _lhs::template core_rebind_band<_lower, _upper>>>> {
+  using type = typename _lhs::template core_rebind_band<_lower, _upper>;
+};
+
+template <typename _lhs, typename _rhs, bool, bool>
+struct Sum : Plain<_lhs> {};
+
+template <typename _lhs, typename _rhs>
+struct Sum<_lhs, _rhs, true, false> : Plain<_rhs> {};
+
+template <typename _lhs, typename _rhs>
+struct Sum<_lhs, _rhs, true, true>
+    : std::conditional_t<
+          std::is_same_v<typename Plain<_lhs>::type,
+                         typename Plain<_rhs>::type>,
+          Plain<_lhs>,
+          Band<typename Plain<_lhs>::type,
+               typename Plain<_rhs>::type,
+               std::max(LowerBandwidth<_lhs>::value,
+                        LowerBandwidth<_rhs>::value),
+               std::max(UpperBandwidth<_lhs>::value,
+                        UpperBandwidth<_rhs>::value)>> {};
+
+template <typename _lhs, typename _rhs, bool, bool>
+struct Product {
+  using type = typename std::conditional_t<
+      _lhs::core_traits::core_type == Sglty::Core::Type::Sparse &&
+          _rhs::core_traits::core_type != Sglty::Core::Type::Sparse,
+      _rhs,
+      _lhs>::template core_rebind_size<_lhs::size_traits::rows,
+                                       _rhs::size_traits::cols>;
+};
+
+template <typename _lhs, typename _rhs>
+struct Product<_lhs, _rhs, false, true> {
+  using type = typename _lhs::template core_rebind_size<
+      _lhs::size_traits::rows,
+      _rhs::size_traits::cols>;
+};
+
+template <typename _lhs, typename _rhs>
+struct Product<_lhs, _rhs, true, false> {
+  using type = typename _rhs::template core_rebind_size<
+      _lhs::size_traits::rows,
+      _rhs::size_traits::cols>;
+};
+
+template <typename _lhs, typename _rhs>
+struct Product<_lhs, _rhs, true, true> {
+ private:
+  static constexpr std::size_t rows = _lhs::size_traits::rows;
+  static constexpr std::size_t cols = _rhs::size_traits::cols;
+
+  using lhs_plain = typename Plain<_lhs>::type::template core_rebind_size<rows,
+                                                                          cols>;
+  using rhs_plain = typename Plain<_rhs>::type;
+
+ public:
+  using type = typename Band<
+      lhs_plain,
+      rhs_plain,
+      ClampBand(Traits::Size::SaturatedAdd(LowerBandwidth<_lhs>::value,
+                                           LowerBandwidth<_rhs>::value),
+                rows),
+      ClampBand(Traits::Size::SaturatedAdd(UpperBandwidth<_lhs>::value,
+                                           UpperBandwidth<_rhs>::value),
+                cols)>::type;
+};
+
 template <typename _core_impl>
 struct IsValid : std::conjunction<HasSizeTraits<_core_impl>,
                                   HasTypeTraits<_core_impl>,
@@ -146,6 +418,47 @@ template <typename _core_impl>
 constexpr inline bool has_member_functions_v =
     Impl::HasMemberFunctions<_core_impl>::value;
 
+template <typename _core_impl>
+constexpr inline bool has_packet_access_v =
+    Impl::HasPacketAccess<_core_impl>::value;
+
+template <typename _core_impl>
+constexpr inline std::size_t alignment_v = Impl::Alignment<_core_impl>::value;
+
+template <typename _core_impl>
+constexpr inline bool is_dynamic_v =
+    _core_impl::size_traits::rows == Traits::Size::dynamic ||
+    _core_impl::size_traits::cols == Traits::Size::dynamic;
+
+template <typename _core_impl>
+constexpr inline bool is_sparse_v =
+    _core_impl::core_traits::core_type == Sglty::Core::Type::Sparse;
+
+template <typename _core_impl>
+constexpr inline bool is_view_v = Impl::IsView<_core_impl>::value;
+
+template <typename _core_impl>
+constexpr inline bool is_structured_v =
+    _core_impl::core_traits::core_type == Sglty::Core::Type::Structured;
+
+template <typename _core_impl>
+constexpr inline bool is_symmetric_v = Impl::IsSymmetric<_core_impl>::value;
+
+template <typename _core_impl>
+constexpr inline std::size_t lower_bandwidth_v =
+    Impl::LowerBandwidth<_core_impl>::value;
+
+template <typename _core_impl>
+constexpr inline std::size_t upper_bandwidth_v =
+    Impl::UpperBandwidth<_core_impl>::value;
+
+template <typename _core_impl>
+constexpr inline std::size_t leading_dim_v =
+    Impl::LeadingDim<_core_impl>::value;
+
+template <typename _core_impl>
+constexpr inline std::size_t tile_v = Impl::Tile<_core_impl>::value;
+
 template <typename _core_impl>
 constexpr bool is_valid_v = Impl::IsValid<_core_impl>::value;
 
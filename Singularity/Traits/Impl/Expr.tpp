@@ -2,15 +2,48 @@
 
 #include "../Expr.hpp"
 
+#include <algorithm>
 #include <type_traits>
 #include <cstddef>
 
+#include "../Core.hpp"
+#include "../Size.hpp"
+#include "../Op.hpp"
+
 namespace Sglty::Expr {
 
-struct Tag;  // forward declaration
+struct Tag;  // forward declarations
+
+template <typename, typename, typename>
+struct Binary;
+
+template <typename, typename>
+struct Unary;
+
+template <typename>
+struct Materialized;
+
+template <typename>
+struct Constant;
+
+template <typename>
+struct Zero;
+
+template <typename>
+struct Identity;
+
+template <typename, typename>
+struct Broadcast;
 
 }  // namespace Sglty::Expr
 
+namespace Sglty::Types {
+
+template <typename>
+class Matrix;  // forward declaration
+
+}  // namespace Sglty::Types
+
 namespace Sglty::Traits::Expr {
 
 namespace Impl {
@@ -33,9 +66,209 @@ struct HasInterface<
 
                 >> : std::true_type {};
 
+template <typename _expr, typename _enable = void>
+struct IsDynamic : std::false_type {};
+
+template <typename _expr>
+struct IsDynamic<_expr, std::enable_if_t<HasInterface<_expr>::value>>
+    : std::bool_constant<_expr::rows == Traits::Size::dynamic ||
+                         _expr::cols == Traits::Size::dynamic> {};
+
+template <typename _expr, typename _matrix>
+struct MayAlias : std::false_type {};
+
+template <typename _core_impl, typename _matrix>
+struct MayAlias<Sglty::Types::Matrix<_core_impl>, _matrix> {
+ private:
+  using other_core = typename _matrix::core_impl;
+
+ public:
+  static constexpr bool value =
+      std::is_same_v<_core_impl, other_core> ||
+      ((Traits::Core::is_view_v<_core_impl> ||
+        Traits::Core::is_view_v<other_core>) &&
+       std::is_same_v<typename _core_impl::type_traits::value_type,
+                      typename other_core::type_traits::value_type>);
+};
+
+template <typename _lhs, typename _rhs, typename _op, typename _matrix>
+struct MayAlias<Sglty::Expr::Binary<_lhs, _rhs, _op>, _matrix>
+    : std::disjunction<
+          MayAlias<std::remove_cv_t<std::remove_reference_t<_lhs>>, _matrix>,
+          MayAlias<std::remove_cv_t<std::remove_reference_t<_rhs>>, _matrix>> {
+};
+
+template <typename _operand, typename _op, typename _matrix>
+struct MayAlias<Sglty::Expr::Unary<_operand, _op>, _matrix>
+    : MayAlias<std::remove_cv_t<std::remove_reference_t<_operand>>, _matrix> {
+};
+
+template <typename _operand, typename _core_impl, typename _matrix>
+struct MayAlias<Sglty::Expr::Broadcast<_operand, _core_impl>, _matrix>
+    : MayAlias<std::remove_cv_t<std::remove_reference_t<_operand>>, _matrix> {
+};
+
 template <typename _expr, typename _enable = void>
 struct IsValid : std::conjunction<HasTagBase<_expr>, HasInterface<_expr>> {};
 
+template <typename _expr>
+struct IsTerminal : std::false_type {};
+
+template <typename _core_impl>
+struct IsTerminal<Sglty::Types::Matrix<_core_impl>> : std::true_type {};
+
+template <typename _operand>
+struct Nested {
+  using type = std::decay_t<_operand>;
+};
+
+template <typename _operand>
+struct Nested<_operand&> {
+  using type = std::conditional_t<IsTerminal<std::decay_t<_operand>>::value,
+                                  const std::decay_t<_operand>&,
+                                  std::decay_t<_operand>>;
+};
+
+// Terminals, scalars and unknown user expressions.
+template <typename _expr>
+struct Cost {
+  static constexpr bool leaf = IsTerminal<_expr>::value ||
+                               std::is_arithmetic_v<_expr>;
+
+  static constexpr bool        product      = false;
+  static constexpr bool        lazy_product = false;
+  static constexpr std::size_t element      = leaf ? 0 : 1;
+  static constexpr std::size_t setup        = 0;
+
+  static constexpr Sglty::Expr::Access access = Sglty::Expr::Access::Contiguous;
+};
+
+template <typename _expr>
+struct Cost<Sglty::Expr::Materialized<_expr>> {
+  static constexpr bool        product      = false;
+  static constexpr bool        lazy_product = false;
+  static constexpr std::size_t element      = 0;
+  static constexpr Sglty::Expr::Access access = Sglty::Expr::Access::Contiguous;
+  static constexpr std::size_t setup = Size::SaturatedAdd(
+      Size::SaturatedMul(Size::SaturatedMul(_expr::rows, _expr::cols),
+                         Cost<_expr>::element),
+      Cost<_expr>::setup);
+};
+
+// Generated nodes read no memory, like terminals.
+template <typename _core_impl>
+struct Cost<Sglty::Expr::Constant<_core_impl>>
+    : Cost<Sglty::Types::Matrix<_core_impl>> {};
+
+template <typename _core_impl>
+struct Cost<Sglty::Expr::Zero<_core_impl>>
+    : Cost<Sglty::Types::Matrix<_core_impl>> {};
+
+template <typename _core_impl>
+struct Cost<Sglty::Expr::Identity<_core_impl>>
+    : Cost<Sglty::Types::Matrix<_core_impl>> {};
+
+// Each element costs one element of the operand.
+template <typename _operand, typename _core_impl>
+struct Cost<Sglty::Expr::Broadcast<_operand, _core_impl>>
+    : Cost<std::remove_cv_t<std::remove_reference_t<_operand>>> {
+  static constexpr bool product = false;
+};
+
+template <typename _lhs, typename _rhs, typename _op>
+struct Cost<Sglty::Expr::Binary<_lhs, _rhs, _op>> {
+ private:
+  using lhs_type = std::remove_cv_t<std::remove_reference_t<_lhs>>;
+  using rhs_type = std::remove_cv_t<std::remove_reference_t<_rhs>>;
+
+  static constexpr std::size_t reads =
+      Traits::Op::reads_v<_op, lhs_type, rhs_type>;
+
+ public:
+  static constexpr bool product      = reads > 1;
+  static constexpr bool lazy_product = product ||
+                                       Cost<lhs_type>::lazy_product ||
+                                       Cost<rhs_type>::lazy_product;
+  static constexpr std::size_t element = Size::SaturatedAdd(
+      Traits::Op::cost_v<_op, lhs_type, rhs_type>,
+      Size::SaturatedMul(
+          reads,
+          Size::SaturatedAdd(Cost<lhs_type>::element,
+                             Cost<rhs_type>::element)));
+  static constexpr std::size_t setup =
+      Size::SaturatedAdd(Cost<lhs_type>::setup, Cost<rhs_type>::setup);
+
+  static constexpr Sglty::Expr::Access access =
+      std::max({Traits::Op::access_v<_op, lhs_type, rhs_type>,
+                Cost<lhs_type>::access,
+                Cost<rhs_type>::access});
+};
+
+template <typename _operand, typename _op>
+struct Cost<Sglty::Expr::Unary<_operand, _op>> {
+ private:
+  using operand_type = std::remove_cv_t<std::remove_reference_t<_operand>>;
+
+  static constexpr std::size_t reads = Traits::Op::reads_v<_op, operand_type>;
+
+ public:
+  static constexpr bool product      = reads > 1;
+  static constexpr bool lazy_product = product ||
+                                       Cost<operand_type>::lazy_product;
+  static constexpr std::size_t element =
+      Size::SaturatedAdd(Traits::Op::cost_v<_op, operand_type>,
+                         Size::SaturatedMul(reads,
+                                            Cost<operand_type>::element));
+  static constexpr std::size_t setup = Cost<operand_type>::setup;
+
+  static constexpr Sglty::Expr::Access access =
+      std::max(Traits::Op::access_v<_op, operand_type>,
+               Cost<operand_type>::access);
+};
+
+template <typename _expr>
+struct IsVectorizable : std::false_type {};
+
+template <typename _core_impl>
+struct IsVectorizable<Sglty::Types::Matrix<_core_impl>>
+    : std::bool_constant<Traits::Core::has_packet_access_v<_core_impl>> {};
+
+template <typename _expr>
+struct IsVectorizable<Sglty::Expr::Materialized<_expr>>
+    : IsVectorizable<Sglty::Types::Matrix<typename _expr::core_impl>> {};
+
+template <typename _core_impl>
+struct IsVectorizable<Sglty::Expr::Constant<_core_impl>>
+    : IsVectorizable<Sglty::Types::Matrix<_core_impl>> {};
+
+template <typename _core_impl>
+struct IsVectorizable<Sglty::Expr::Zero<_core_impl>>
+    : IsVectorizable<Sglty::Types::Matrix<_core_impl>> {};
+
+template <typename _lhs, typename _rhs, typename _op>
+struct IsVectorizable<Sglty::Expr::Binary<_lhs, _rhs, _op>> {
+ private:
+  using lhs_type = std::remove_cv_t<std::remove_reference_t<_lhs>>;
+  using rhs_type = std::remove_cv_t<std::remove_reference_t<_rhs>>;
+
+ public:
+  static constexpr bool value =
+      Traits::Op::is_vectorizable_v<_op, lhs_type, rhs_type> &&
+      IsVectorizable<lhs_type>::value &&
+      (std::is_arithmetic_v<rhs_type> || IsVectorizable<rhs_type>::value);
+};
+
+template <typename _operand, typename _op>
+struct IsVectorizable<Sglty::Expr::Unary<_operand, _op>> {
+ private:
+  using operand_type = std::remove_cv_t<std::remove_reference_t<_operand>>;
+
+ public:
+  static constexpr bool value =
+      Traits::Op::is_vectorizable_v<_op, operand_type> &&
+      IsVectorizable<operand_type>::value;
+};
+
 }  // namespace Impl
 
 template <typename _expr>
@@ -47,6 +280,36 @@ constexpr inline bool has_interface_v = Impl::HasInterface<_expr>::value;
 template <typename _expr>
 constexpr inline bool is_valid_v = Impl::IsValid<_expr>::value;
 
+template <typename _expr>
+constexpr inline bool is_terminal_v = Impl::IsTerminal<_expr>::value;
+
+template <typename _expr>
+constexpr inline bool is_product_v = Impl::Cost<_expr>::product;
+
+template <typename _expr>
+constexpr inline bool contains_product_v = Impl::Cost<_expr>::lazy_product;
+
+template <typename _expr>
+constexpr inline std::size_t element_cost_v = Impl::Cost<_expr>::element;
+
+template <typename _expr>
+constexpr inline std::size_t cost_v = Size::SaturatedAdd(
+    Size::SaturatedMul(Size::SaturatedMul(_expr::rows, _expr::cols),
+                       Impl::Cost<_expr>::element),
+    Impl::Cost<_expr>::setup);
+
+template <typename _expr>
+constexpr inline Sglty::Expr::Access access_v = Impl::Cost<_expr>::access;
+
+template <typename _expr>
+constexpr inline bool is_vectorizable_v = Impl::IsVectorizable<_expr>::value;
+
+template <typename _expr>
+constexpr inline bool is_dynamic_v = Impl::IsDynamic<_expr>::value;
+
+template <typename _expr, typename _matrix>
+constexpr inline bool may_alias_v = Impl::MayAlias<_expr, _matrix>::value;
+
 }  // namespace Sglty::Traits::Expr
 
 // Singularity/Traits/Impl/Expr.tpp
@@ -2,8 +2,10 @@
 
 #include "../Op.hpp"
 
+#include <cstddef>
 #include <type_traits>
 
+#include "../Expr.hpp"
 #include "../../Expr/Dummy.hpp"
 
 namespace Sglty::Traits::Op {
@@ -50,6 +52,63 @@ struct IsBinary<
 template <typename _op>
 struct IsValid : std::disjunction<IsUnary<_op>, IsBinary<_op>> {};
 
+template <typename _op, typename _enable, typename... _operands>
+struct Cost : std::integral_constant<std::size_t, 1> {};
+
+template <typename _op, typename... _operands>
+struct Cost<_op,
+            std::void_t<decltype(_op::template cost<_operands...>)>,
+            _operands...>
+    : std::integral_constant<std::size_t, _op::template cost<_operands...>> {};
+
+template <typename _op, typename _enable, typename... _operands>
+struct Reads : std::integral_constant<std::size_t, 1> {};
+
+template <typename _op, typename... _operands>
+struct Reads<_op,
+             std::void_t<decltype(_op::template reads<_operands...>)>,
+             _operands...>
+    : std::integral_constant<std::size_t, _op::template reads<_operands...>> {
+};
+
+template <typename _op, typename _enable, typename... _operands>
+struct IsVectorizable : std::false_type {};
+
+template <typename _op, typename... _operands>
+struct IsVectorizable<
+    _op,
+    std::void_t<decltype(_op::template vectorizable<_operands...>)>,
+    _operands...>
+    : std::bool_constant<_op::template vectorizable<_operands...>> {};
+
+template <typename _op, typename _enable, typename... _operands>
+struct IsElementwise : std::false_type {};
+
+template <typename _op, typename... _operands>
+struct IsElementwise<
+    _op,
+    std::void_t<decltype(_op::template elementwise<_operands...>)>,
+    _operands...>
+    : std::bool_constant<_op::template elementwise<_operands...>> {};
+
+template <typename _op, typename _enable, typename... _operands>
+struct Access {
+  static constexpr Sglty::Expr::Access value =
+      IsElementwise<_op, void, _operands...>::value
+          ? Sglty::Expr::Access::Contiguous
+      : Reads<_op, void, _operands...>::value > 1
+          ? Sglty::Expr::Access::Reuse
+          : Sglty::Expr::Access::Strided;
+};
+
+template <typename _op, typename... _operands>
+struct Access<_op,
+              std::void_t<decltype(_op::template access<_operands...>)>,
+              _operands...> {
+  static constexpr Sglty::Expr::Access value =
+      _op::template access<_operands...>;
+};
+
 }  // namespace Impl
 
 template <typename _op>
@@ -61,6 +120,32 @@ constexpr inline bool is_binary_v = Impl::IsBinary<_op>::value;
 template <typename _op>
 constexpr inline bool is_valid_v = Impl::IsValid<_op>::value;
 
+template <typename _op, typename... _operands>
+constexpr inline std::size_t cost_v =
+    Impl::Cost<_op, void, _operands...>::value;
+
+template <typename _op, typename... _operands>
+constexpr inline std::size_t reads_v =
+    Impl::Reads<_op, void, _operands...>::value;
+
+template <typename _op, typename _operand, typename... _operands>
+constexpr inline bool evaluate_before_use_v =
+    reads_v<_op, _operands...> > 1 &&
+    !Traits::Expr::is_terminal_v<_operand> &&
+    Traits::Expr::contains_product_v<_operand>;
+
+template <typename _op, typename... _operands>
+constexpr inline bool is_vectorizable_v =
+    Impl::IsVectorizable<_op, void, _operands...>::value;
+
+template <typename _op, typename... _operands>
+constexpr inline bool is_elementwise_v =
+    Impl::IsElementwise<_op, void, _operands...>::value;
+
+template <typename _op, typename... _operands>
+constexpr inline Sglty::Expr::Access access_v =
+    Impl::Access<_op, void, _operands...>::value;
+
 }  // namespace Sglty::Traits::Op
 
 // Singularity/Traits/Impl/Op.tpp
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+
+#include "../Expr/Enums.hpp"
+
 namespace Sglty::Traits::Op {
 
 /**
@@ -98,8 +102,133 @@ extern const bool is_binary_v;
 template <typename _op>
 extern const bool is_valid_v;
 
+/**
+ * @brief Estimated scalar operations an operator spends per output element.
+ *
+ * Read from an optional member of the operator:
+ * ```
+ * template <typename _lhs, typename _rhs>  // or <typename _operand>
+ * static constexpr std::size_t cost = // some value //;
+ * ```
+ * Defaults to `1` for operators that do not publish it. The cost excludes
+ * the cost of evaluating the operands themselves.
+ *
+ * @tparam _op       Operator type being inspected.
+ * @tparam _operands Operand expression types (one or two).
+ *
+ * @see Sglty::Traits::Expr::cost_v
+ */
+template <typename _op, typename... _operands>
+extern const std::size_t cost_v;
+
+/**
+ * @brief Number of operand elements an operator reads per output element.
+ *
+ * Read from an optional member of the operator:
+ * ```
+ * template <typename _lhs, typename _rhs>  // or <typename _operand>
+ * static constexpr std::size_t reads = // some value //;
+ * ```
+ * Defaults to `1` (element-wise operators). Operators reading more than one
+ * element of an operand per output element — such as `MulMatrix`, which
+ * reads a whole row and column — are considered products.
+ *
+ * @tparam _op       Operator type being inspected.
+ * @tparam _operands Operand expression types (one or two).
+ *
+ * @see Sglty::Traits::Expr::is_product_v
+ */
+template <typename _op, typename... _operands>
+extern const std::size_t reads_v;
+
+/**
+ * @brief Checks whether an operand should be evaluated before `_op` uses it.
+ *
+ * True when `_op` reads each operand element several times (see `reads_v`)
+ * and `_operand` is a non-terminal expression that itself contains a
+ * product. Such operands are materialized into a temporary once instead of
+ * being recomputed for every read, e.g. the inner product of `(a * b) * c`.
+ *
+ * Element-wise sub-expressions (`Add`, `Neg`, `Trp`, ...) are never
+ * materialized by this rule and stay lazily fused.
+ *
+ * @tparam _op       Operator consuming the operand.
+ * @tparam _operand  The operand being inspected (one of `_operands`).
+ * @tparam _operands All operand expression types of `_op`.
+ *
+ * @see Sglty::Expr::Materialized
+ * @see Sglty::Traits::Expr::contains_product_v
+ */
+template <typename _op, typename _operand, typename... _operands>
+extern const bool evaluate_before_use_v;
+
+/**
+ * @brief Checks whether an operator has a SIMD packet form for its operands.
+ *
+ * Read from an optional pair of members of the operator:
+ * ```
+ * template <typename _lhs, typename _rhs>  // or <typename _operand>
+ * static constexpr bool vectorizable = // some value //;
+ *
+ * template <typename _lhs, typename _rhs>
+ * auto Packet(const _lhs&, const _rhs&, std::size_t, std::size_t) const;
+ * ```
+ * where `Packet()` must produce the same lanes as `operator()` would for
+ * consecutive positions along the major axis. Defaults to `false`, in which
+ * case expressions using the operator are evaluated element by element.
+ *
+ * @tparam _op       Operator type being inspected.
+ * @tparam _operands Operand expression types (one or two).
+ *
+ * @see Sglty::Traits::Expr::is_vectorizable_v
+ */
+template <typename _op, typename... _operands>
+extern const bool is_vectorizable_v;
+
+/**
+ * @brief Checks whether an operator computes each output element from the
+ * operand elements at the same position only.
+ *
+ * Read from an optional member of the operator:
+ * ```
+ * template <typename _lhs, typename _rhs>  // or <typename _operand>
+ * static constexpr bool elementwise = // some value //;
+ * ```
+ * Defaults to `false`. Element-wise operators can be evaluated directly into
+ * storage that is also one of their operands, since every element is read
+ * before it is overwritten; `Trp` and `MulMatrix` cannot.
+ *
+ * @tparam _op       Operator type being inspected.
+ * @tparam _operands Operand expression types (one or two).
+ *
+ * @see Sglty::Expr::Aliases
+ */
+template <typename _op, typename... _operands>
+extern const bool is_elementwise_v;
+
+/**
+ * @brief Memory access pattern of an operator over its operands.
+ *
+ * Read from an optional member of the operator:
+ * ```
+ * template <typename _lhs, typename _rhs>  // or <typename _operand>
+ * static constexpr Sglty::Expr::Access access = // some value //;
+ * ```
+ * Defaults to `Access::Contiguous` for element-wise operators (see
+ * `is_elementwise_v`), `Access::Reuse` for products (see `reads_v`) and
+ * `Access::Strided` otherwise. The access excludes the access of the
+ * operands themselves.
+ *
+ * @tparam _op       Operator type being inspected.
+ * @tparam _operands Operand expression types (one or two).
+ *
+ * @see Sglty::Traits::Expr::access_v
+ */
+template <typename _op, typename... _operands>
+extern const Sglty::Expr::Access access_v;
+
 }  // namespace Sglty::Traits::Op
 
 #include "Impl/Op.tpp"
 
-// Singularity/Traits/Op/hpp
\ No newline at end of file
+// Singularity/Traits/Op.hpp
\ No newline at end of file
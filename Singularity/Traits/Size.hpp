@@ -3,8 +3,77 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "../Config.hpp"
+
 namespace Sglty::Traits::Size {
 
+/**
+ * @brief Sentinel extent for dimensions only known at runtime.
+ *
+ * Used in place of a row or column count in `size_traits` (and therefore in
+ * `Matrix::rows`, `Binary::rows`, ...) by cores whose shape is chosen at
+ * runtime, such as `Sglty::Core::Dynamic`. The actual extents are then read
+ * through `Rows()` / `Cols()`.
+ *
+ * Mirrors `std::dynamic_extent`.
+ */
+constexpr inline std::size_t dynamic = static_cast<std::size_t>(-1);
+
+/**
+ * @brief Checks whether two extents may describe the same dimension.
+ *
+ * True when they are equal or when either one is `dynamic`, in which case the
+ * actual extents have to be compared at runtime.
+ *
+ * @tparam _lhs First extent.
+ * @tparam _rhs Second extent.
+ */
+template <std::size_t _lhs, std::size_t _rhs>
+constexpr inline bool is_compatible_v =
+    _lhs == _rhs || _lhs == dynamic || _rhs == dynamic;
+
+/**
+ * @brief Checks whether loops over a fixed extent are unrolled at compile
+ * time.
+ *
+ * True for extents other than `dynamic` that do not exceed
+ * `SGLTY_UNROLL_LIMIT`, e.g. the 4 x 4 = 16 elements of a `DenseMat<float, 4,
+ * 4>` with the default limit.
+ *
+ * @tparam _extent The number of iterations.
+ */
+template <std::size_t _extent>
+constexpr inline bool is_unrolled_v =
+    _extent != dynamic && _extent <= std::size_t{SGLTY_UNROLL_LIMIT};
+
+/**
+ * @brief Adds two extents or costs, saturating at `dynamic`.
+ *
+ * A sum involving `dynamic` (or overflowing) is `dynamic`, so costs that
+ * depend on a runtime extent stay recognizable instead of wrapping around.
+ *
+ * @see Sglty::Traits::Expr::element_cost_v
+ */
+constexpr std::size_t SaturatedAdd(std::size_t _lhs,
+                                   std::size_t _rhs) noexcept {
+  return _lhs > dynamic - _rhs ? dynamic : _lhs + _rhs;
+}
+
+/**
+ * @brief Multiplies two extents or costs, saturating at `dynamic`.
+ *
+ * A product with `0` is `0`, e.g. reading `dynamic` elements that cost
+ * nothing; any other product involving `dynamic` (or overflowing) is
+ * `dynamic`.
+ */
+constexpr std::size_t SaturatedMul(std::size_t _lhs,
+                                   std::size_t _rhs) noexcept {
+  if (_lhs == 0 || _rhs == 0) {
+    return 0;
+  }
+  return _lhs > dynamic / _rhs ? dynamic : _lhs * _rhs;
+}
+
 /**
  * @brief Maps dimension values and size type to a compile-time `size_traits`
  * definition.
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
 namespace Sglty::Traits::Type {
 
@@ -43,6 +44,76 @@ struct Get {
   using const_pointer   = const value_type*;
 };
 
+/**
+ * @brief `type_traits` for read-only storage of `_Tp`.
+ *
+ * `value_type` stays the unqualified `_Tp`, so the element type compares
+ * equal to that of mutable storage, while all references and pointers are
+ * const. Used by view cores over `const` buffers (e.g. `Core::Map<const T,
+ * ...>`); writing through them is a compile error.
+ *
+ * @tparam _Tp Value type
+ */
+template <typename _Tp>
+struct Get<const _Tp> {
+  using size_type       = std::size_t;
+  using value_type      = _Tp;
+  using difference_type = std::ptrdiff_t;
+  using reference       = const value_type&;
+  using const_reference = const value_type&;
+  using pointer         = const value_type*;
+  using const_pointer   = const value_type*;
+};
+
+/**
+ * @brief Type that arithmetic on elements of type `_Tp` is carried out in.
+ *
+ * `_Tp` itself by default. Reduced-precision storage types, which only
+ * convert to and from a wider type (e.g. `Sglty::Core::BFloat16` and
+ * `Sglty::Core::Float16` to `float`), specialize it, as may user-defined
+ * storage types. Kernels accumulate in `compute_t` and round to the storage
+ * type once per stored element.
+ *
+ * @tparam _Tp Value type
+ */
+template <typename _Tp>
+struct Compute {
+  using type = _Tp;
+};
+
+/**
+ * @brief Shorthand for `Compute<_Tp>::type`.
+ */
+template <typename _Tp>
+using compute_t = typename Compute<_Tp>::type;
+
+/**
+ * @brief Value type that operands of element types `_Tp` and `_Up` are
+ * promoted to when they meet in one operation.
+ *
+ * The `std::common_type` of their compute types, e.g. `double` for `float`
+ * and `double`, `float` for `BFloat16` and `float`, and also `float` for two
+ * `BFloat16` operands, whose products are accumulated in `float`.
+ *
+ * @tparam _Tp Value type of the first operand.
+ * @tparam _Up Value type of the second operand.
+ */
+template <typename _Tp, typename _Up>
+struct Promote : std::common_type<compute_t<_Tp>, compute_t<_Up>> {};
+
+/**
+ * @brief Shorthand for `Promote<_Tp, _Up>::type`.
+ */
+template <typename _Tp, typename _Up>
+using promote_t = typename Promote<_Tp, _Up>::type;
+
+/**
+ * @brief Whether `_Tp` can be an element of numeric kernels: an arithmetic
+ * type, or a storage type whose `compute_t` is one.
+ */
+template <typename _Tp>
+constexpr inline bool is_numeric_v = std::is_arithmetic_v<compute_t<_Tp>>;
+
 }  // namespace Sglty::Traits::Type
 
 // Singularity/Traits/Type.hpp
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Matrix.hpp"
+
+namespace Sglty::Types {
+
+/**
+ * @brief Copies item `_k` out of a batched matrix.
+ *
+ * `_core_impl::value_type` must be a `Simd::Lanes` type (see
+ * `Sglty::BatchMat`). The result is backed by the same core rebound to the
+ * scalar type of the lanes, e.g. `Core::Dense<float, 4, 4, ...>` for a batch
+ * of `DenseMat<float, 4, 4>`.
+ *
+ * @tparam _core_impl The core implementation of the batch.
+ * @param _batch The batched matrix.
+ * @param _k The item index (zero-based).
+ * @return The matrix holding lane `_k` of every element.
+ */
+template <typename _core_impl>
+constexpr auto Item(const Matrix<_core_impl>& _batch, std::size_t _k);
+
+/**
+ * @brief Overwrites item `_k` of a batched matrix with an expression.
+ *
+ * @tparam _core_impl The core implementation of the batch.
+ * @tparam _expr The expression type, shaped like one item. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v`.
+ * @param _batch The batched matrix.
+ * @param _k The item index (zero-based).
+ * @param _e The values to store in lane `_k`.
+ */
+template <typename _core_impl, typename _expr>
+constexpr void SetItem(Matrix<_core_impl>& _batch,
+                       std::size_t _k,
+                       const _expr& _e);
+
+}  // namespace Sglty::Types
+
+#include "Impl/Batch.tpp"
+
+// Singularity/Types/Batch.hpp
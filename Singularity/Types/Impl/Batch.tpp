@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../Batch.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "../../Simd/Lanes.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
+#include "../../Traits/Size.hpp"
+
+namespace Sglty::Types {
+
+template <typename _core_impl>
+constexpr auto Item(const Matrix<_core_impl>& _batch, std::size_t _k) {
+  using lanes_type = typename Matrix<_core_impl>::value_type;
+  static_assert(Simd::is_lanes_v<lanes_type>,
+                "Error: `_core_impl::value_type` is not a batch of lanes.");
+
+  using item_core = typename _core_impl::template core_rebind_value<
+      typename lanes_type::value_type>;
+
+  Matrix<item_core> item;
+  if constexpr (Traits::Core::is_dynamic_v<item_core>) {
+    item.Resize(_batch.Rows(), _batch.Cols());
+  }
+  Traverse(item, [&](std::size_t i, std::size_t j) {
+    item(i, j) = _batch(i, j)[_k];
+  });
+  return item;
+}
+
+template <typename _core_impl, typename _expr>
+constexpr void SetItem(Matrix<_core_impl>& _batch,
+                       std::size_t _k,
+                       const _expr& _e) {
+  static_assert(Simd::is_lanes_v<typename Matrix<_core_impl>::value_type>,
+                "Error: `_core_impl::value_type` is not a batch of lanes.");
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+  static_assert(
+      Traits::Size::is_compatible_v<Matrix<_core_impl>::rows, _expr::rows> &&
+          Traits::Size::is_compatible_v<Matrix<_core_impl>::cols, _expr::cols>,
+      "Error: dimension mismatch.");
+
+  if constexpr (Traits::Core::is_dynamic_v<_core_impl> ||
+                Traits::Expr::is_dynamic_v<_expr>) {
+    if (_batch.Rows() != _e.Rows() || _batch.Cols() != _e.Cols()) {
+      throw std::invalid_argument(
+          "Error: dimension mismatch between `_batch` and `_expr`.");
+    }
+  }
+  Traverse(_batch, [&](std::size_t i, std::size_t j) {
+    _batch(i, j)[_k] = _e(i, j);
+  });
+}
+
+}  // namespace Sglty::Types
+
+// Singularity/Types/Impl/Batch.tpp
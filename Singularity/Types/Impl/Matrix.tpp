@@ -2,29 +2,48 @@
 
 #include "../Matrix.hpp"
 
-#include <iostream>
+#include <cstdio>
 #include <type_traits>
 #include <utility>
 
+#include "../../Traits/Core.hpp"
 #include "../../Traits/Expr.hpp"
+#include "../../Traits/Size.hpp"
+#include "../../Traits/Type.hpp"
+#include "../../Expr/Assign.hpp"
+#include "../../Expr/NoAlias.hpp"
+#include "../../Kernel/Copy.hpp"
+#include "../../Kernel/Unroll.hpp"
+#include "../../Simd/Packet.hpp"
+#include "../../Trace/Tracer.hpp"
+#include "../../Core/Identity.hpp"
+#include "../../Core/Layout.hpp"
+#include "../../Core/MapStrided.hpp"
+#include "../../IO/Text.hpp"
+#include "../../Op/Alg/Trp.hpp"
+#include "../../Op/Arthm/Add.hpp"
+#include "../../Op/Arthm/Mul.hpp"
 #include "../../Op/Arthm/Neg.hpp"
+#include "../../Op/Arthm/Sub.hpp"
 
 namespace Sglty::Types {
 
 template <typename _core_impl>
 template <typename _core_other, bool _enable, typename>
 constexpr Matrix<_core_impl>::Matrix(const Matrix<_core_other>& _other) {
+  static_assert(!Traits::Core::is_view_v<core_impl>,
+                "Error: a view cannot be constructed from another matrix.");
   static_assert(std::is_convertible_v<typename _core_other::value_type,
                                       typename core_impl::value_type>,
                 "Error: cannot convert `_core_other::value_type` to "
                 "`core_impl::value_type`.");
   static_assert(
-      Matrix<core_impl>::rows == Matrix<_core_other>::rows &&
-          Matrix<core_impl>::cols == Matrix<_core_other>::cols,
+      Traits::Size::is_compatible_v<rows, Matrix<_core_other>::rows> &&
+          Traits::Size::is_compatible_v<cols, Matrix<_core_other>::cols>,
       "Error: dimension mismatch between `core_impl` and `_core_other`.");
 
-  Traverse(*this,
-           [&](std::size_t i, std::size_t j) { (*this)(i, j) = _other(i, j); });
+  // Handles runtime-sized and sparse storage on either side.
+  Expr::AssignNoAlias(*this, _other);
 }
 
 template <typename _core_impl>
@@ -34,22 +53,23 @@ constexpr Matrix<_core_impl>::Matrix(const _expr& _e) {
       std::is_same_v<typename Matrix::core_impl, typename _expr::core_impl>,
       "Error: `core_impl` mismatch.");
 
-  Traverse(*this,
-           [&](std::size_t i, std::size_t j) { (*this)(i, j) = _e(i, j); });
+  const Trace::Span span =
+      Trace::Begin(Trace::Kind::Evaluate, Trace::Bytes(_e), Trace::Flops(_e));
+  Expr::AssignNoAlias(*this, _e);
+  Trace::End(span);
 }
 
 template <typename _core_impl>
 template <typename _core_other, bool _enable, typename>
 constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator=(
     const Matrix<_core_other>& _other) {
-  static_assert(Matrix<core_impl>::rows == Matrix<_core_other>::rows &&
-                    Matrix<core_impl>::cols == Matrix<_core_other>::cols,
-                "Error: dimension mismatch.");
-
-  Matrix<_core_other> temp(_other);
+  static_assert(
+      Traits::Size::is_compatible_v<rows, Matrix<_core_other>::rows> &&
+          Traits::Size::is_compatible_v<cols, Matrix<_core_other>::cols>,
+      "Error: dimension mismatch.");
 
-  Traverse(*this,
-           [&](std::size_t i, std::size_t j) { (*this)(i, j) = temp(i, j); });
+  // Views keep referring to their buffer, the elements are copied into it.
+  Expr::Assign(*this, _other);
 
   return *this;
 }
@@ -57,11 +77,11 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator=(
 template <typename _core_impl>
 template <typename _expr, bool _enable, typename>
 constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator=(const _expr& _e) {
-  static_assert(rows == _expr::rows && cols == _expr::cols,
+  static_assert(Traits::Size::is_compatible_v<rows, _expr::rows> &&
+                    Traits::Size::is_compatible_v<cols, _expr::cols>,
                 "Error: dimension mismatch.");
 
-  Traverse(*this,
-           [&](std::size_t i, std::size_t j) { (*this)(i, j) = _e(i, j); });
+  Expr::Assign(*this, _e);
 
   return *this;
 }
@@ -69,7 +89,7 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator=(const _expr& _e) {
 template <typename _core_impl>
 template <typename... Args, bool _enable, typename>
 constexpr Matrix<_core_impl>::Matrix(Args&&... args)
-    : _m_data(std::forward<Args>(args)...) {
+    : _m_storage(std::in_place, std::forward<Args>(args)...) {
   static_assert(
       std::is_constructible_v<core_impl, Args&&...>,
       "Error: `core_impl` is not constructible with the passed arguments.");
@@ -78,13 +98,51 @@ constexpr Matrix<_core_impl>::Matrix(Args&&... args)
 template <typename _core_impl>
 constexpr typename Matrix<_core_impl>::size_type Matrix<_core_impl>::Rows()
     const {
-  return rows;
+  if constexpr (Traits::Core::is_dynamic_v<core_impl>) {
+    return _m_data.Rows();
+  } else {
+    return rows;
+  }
 }
 
 template <typename _core_impl>
 constexpr typename Matrix<_core_impl>::size_type Matrix<_core_impl>::Cols()
     const {
-  return cols;
+  if constexpr (Traits::Core::is_dynamic_v<core_impl>) {
+    return _m_data.Cols();
+  } else {
+    return cols;
+  }
+}
+
+template <typename _core_impl>
+void Matrix<_core_impl>::Resize(const size_type _rows, const size_type _cols) {
+  static_assert(Traits::Core::is_dynamic_v<core_impl>,
+                "Error: only runtime-sized cores can be resized.");
+
+  _m_data.Resize(_rows, _cols);
+}
+
+template <typename _core_impl>
+void Matrix<_core_impl>::Advise(const size_type _row,
+                                const size_type _col,
+                                const size_type _rows,
+                                const size_type _cols,
+                                const Sglty::Core::Advice _advice) const {
+  _m_data.Advise(_row, _col, _rows, _cols, _advice);
+}
+
+template <typename _core_impl>
+constexpr typename Matrix<_core_impl>::size_type
+Matrix<_core_impl>::OuterStride() const {
+  constexpr size_type ld = Traits::Core::leading_dim_v<core_impl>;
+  if constexpr (ld != Traits::Size::dynamic) {
+    return ld;
+  } else if constexpr (Traits::Core::is_dynamic_v<core_impl>) {
+    return core_major == Core::Major::Row ? Cols() : Rows();
+  } else {
+    return _m_data.OuterStride();
+  }
 }
 
 template <typename _core_impl>
@@ -101,15 +159,27 @@ template <typename _core_impl>
 template <typename _Up>
 constexpr Matrix<typename _core_impl::core_rebind_value<_Up>>
 Matrix<_core_impl>::Cast() const {
-  static_assert(std::is_arithmetic_v<_Up>,
+  static_assert(Traits::Type::is_numeric_v<_Up>,
                 "Error: cannot cast to a non-arithmetic type.");
 
   using result_core = typename core_impl::core_rebind_value<_Up>;
 
+  const Trace::Span span =
+      Trace::Begin(Trace::Kind::Cast, Trace::Bytes(*this), 0);
+
   Matrix<result_core> result;
+  if constexpr (Traits::Core::is_dynamic_v<result_core>) {
+    result.Resize(Rows(), Cols());
+  }
   Traverse(result, [&](std::size_t i, std::size_t j) {
-    result(i, j) = static_cast<_Up>((*this)(i, j));
+    const _Up value = static_cast<_Up>((*this)(i, j));
+    if (!Traits::Core::is_sparse_v<result_core> || value != _Up{}) {
+      result(i, j) = value;
+    }
   });
+
+  Trace::Count(Trace::Kind::Temporary, Trace::Bytes(result), 0);
+  Trace::End(span);
   return result;
 }
 
@@ -117,34 +187,133 @@ template <typename _core_impl>
 template <Core::Major _major>
 constexpr Matrix<typename _core_impl::core_rebind_major<_major>>
 Matrix<_core_impl>::Reorder() const {
-  {
-    Traits::Core::Get<core_type,
-                      _major>
-        _;  // to assert correctness of new major
-  }
-
   using result_core = typename core_impl::core_rebind_major<_major>;
 
+  // Instantiating the trait asserts the new major suits the result core;
+  // structured cores rebind to a dense core of the new major.
+  static_assert(
+      Traits::Core::Get<Matrix<result_core>::core_type, _major>::core_major ==
+          _major,
+      "Error: invalid major for the reordered core.");
+
+  const Trace::Span span =
+      Trace::Begin(Trace::Kind::Reorder, Trace::Bytes(*this), 0);
+
   Matrix<result_core> result;
-  Traverse(result,
-           [&](std::size_t i, std::size_t j) { result(i, j) = (*this)(i, j); });
+  Expr::AssignNoAlias(result, *this);
+
+  Trace::Count(Trace::Kind::Temporary, Trace::Bytes(result), 0);
+  Trace::End(span);
   return result;
 }
 
+template <typename _core_impl>
+constexpr void Matrix<_core_impl>::TransposeInPlace() {
+  static_assert(Traits::Size::is_compatible_v<rows, cols>,
+                "Error: only square matrices can be transposed in place.");
+
+  if constexpr (Traits::Core::is_structured_v<core_impl>) {
+    static_assert(
+        std::is_same_v<Traits::Core::transpose_t<core_impl>, core_impl>,
+        "Error: the transpose has another structure; assign `Trp()` of the "
+        "matrix to a matrix of that structure instead.");
+    if constexpr (!Traits::Core::is_symmetric_v<core_impl>) {
+      // The band is as wide on both sides, so only its elements move.
+      constexpr size_type upper = Traits::Core::upper_bandwidth_v<core_impl>;
+      for (size_type i = 0; i < Rows(); i++) {
+        const size_type last = upper < Cols() - i ? i + upper + 1 : Cols();
+        for (size_type j = i + 1; j < last; j++) {
+          const value_type tmp = (*this)(i, j);
+          (*this)(i, j)        = (*this)(j, i);
+          (*this)(j, i)        = tmp;
+        }
+      }
+    }
+  } else if constexpr (Traits::Core::is_sparse_v<core_impl>) {
+    *this = Matrix(Op::Alg::Trp(*this));
+    return;
+  } else {
+    if constexpr (Traits::Core::is_dynamic_v<core_impl>) {
+      if (Rows() != Cols()) {
+        *this = Matrix(Op::Alg::Trp(*this));
+        return;
+      }
+    }
+    if constexpr (Expr::Impl::IsDirectAccess<Matrix>::value) {
+      if (!Config::IsConstantEvaluated()) {
+        Kernel::TransposeInPlace(Rows(), Data(), OuterStride());
+        return;
+      }
+    }
+    for (size_type i = 0; i < Rows(); i++) {
+      for (size_type j = i + 1; j < Cols(); j++) {
+        const value_type tmp = (*this)(i, j);
+        (*this)(i, j)        = (*this)(j, i);
+        (*this)(j, i)        = tmp;
+      }
+    }
+  }
+}
+
 template <typename _core_impl>
 constexpr Matrix<_core_impl> Matrix<_core_impl>::Zero() {
+  static_assert(!Traits::Core::is_view_v<core_impl>,
+                "Error: a view cannot be returned by value.");
+  static_assert(!Traits::Core::is_dynamic_v<core_impl>,
+                "Error: a runtime-sized matrix has no shape, use "
+                "`Zero(rows, cols)` or `Sglty::Zero()`.");
   Matrix<_core_impl> result;
+  if constexpr (!Traits::Core::is_sparse_v<core_impl>) {
+    Traverse(result, [&](std::size_t i, std::size_t j) { result(i, j) = 0; });
+  }
+  return result;
+}
+
+template <typename _core_impl>
+constexpr Matrix<_core_impl> Matrix<_core_impl>::Zero(const size_type _rows,
+                                                      const size_type _cols) {
+  static_assert(Traits::Core::is_dynamic_v<core_impl>,
+                "Error: only runtime-sized matrices take a shape, use "
+                "`Zero()`.");
+  Matrix<_core_impl> result(_rows, _cols);
   Traverse(result, [&](std::size_t i, std::size_t j) { result(i, j) = 0; });
   return result;
 }
 
 template <typename _core_impl>
-constexpr Matrix<_core_impl> Matrix<_core_impl>::Identity() {
+constexpr auto Matrix<_core_impl>::Identity() {
   static_assert(Matrix<core_impl>::rows == Matrix<core_impl>::cols,
                 "Error: an Identity matrix must be a square matrix.");
-  Matrix<core_impl> result;
-  for (size_type i = 0; i < Matrix<core_impl>::rows; i++) {
-    result(i, i) = Matrix<core_impl>::value_type(1);
+  if constexpr (!Traits::Core::is_dynamic_v<core_impl> &&
+                !Traits::Core::is_sparse_v<core_impl>) {
+    return Matrix<Core::Identity<value_type, rows>>();
+  } else {
+    static_assert(!Traits::Core::is_view_v<core_impl>,
+                  "Error: a view cannot be returned by value.");
+    static_assert(!Traits::Core::is_dynamic_v<core_impl>,
+                  "Error: a runtime-sized matrix has no shape, use "
+                  "`Identity(size)` or `Sglty::Identity()`.");
+    Matrix<core_impl> result;
+    if constexpr (Traits::Size::is_unrolled_v<rows>) {
+      Kernel::Unroll<rows>([&](auto i) { result(i, i) = value_type(1); });
+    } else {
+      for (size_type i = 0; i < result.Rows(); i++) {
+        result(i, i) = value_type(1);
+      }
+    }
+    return result;
+  }
+}
+
+template <typename _core_impl>
+constexpr Matrix<_core_impl> Matrix<_core_impl>::Identity(
+    const size_type _size) {
+  static_assert(Traits::Core::is_dynamic_v<core_impl>,
+                "Error: only runtime-sized matrices take a shape, use "
+                "`Identity()`.");
+  Matrix<_core_impl> result = Zero(_size, _size);
+  for (size_type i = 0; i < _size; i++) {
+    result(i, i) = value_type(1);
   }
   return result;
 }
@@ -152,7 +321,8 @@ constexpr Matrix<_core_impl> Matrix<_core_impl>::Identity() {
 template <typename _core_impl>
 constexpr typename Matrix<_core_impl>::reference Matrix<_core_impl>::operator()(
     const size_type _row, const size_type _col) {
-  return const_cast<reference>(std::as_const(*this).operator()(_row, _col));
+  // The mutable `At()` may differ, e.g. sparse cores insert missing entries.
+  return _m_data.At(_row, _col);
 }
 
 template <typename _core_impl>
@@ -162,6 +332,151 @@ Matrix<_core_impl>::operator()(const size_type _row,
   return _m_data.At(_row, _col);
 }
 
+template <typename _core_impl>
+constexpr typename Matrix<_core_impl>::pointer Matrix<_core_impl>::Data() {
+  return _m_data.Data();
+}
+
+template <typename _core_impl>
+constexpr typename Matrix<_core_impl>::const_pointer
+Matrix<_core_impl>::Data() const {
+  return _m_data.Data();
+}
+
+template <typename _core_impl>
+auto Matrix<_core_impl>::Packet(const size_type _row,
+                                const size_type _col) const {
+  return _m_data.LoadPacket(_row, _col);
+}
+
+template <typename _core_impl>
+template <typename _packet>
+void Matrix<_core_impl>::StorePacket(const size_type _row,
+                                     const size_type _col,
+                                     const _packet& _p) {
+  _m_data.StorePacket(_row, _col, _p);
+}
+
+template <typename _core_impl>
+constexpr typename Matrix<_core_impl>::size_type
+Matrix<_core_impl>::NonZeros() const {
+  return _m_data.NonZeros();
+}
+
+template <typename _core_impl>
+constexpr typename Matrix<_core_impl>::size_type*
+Matrix<_core_impl>::OuterIndex() {
+  return _m_data.OuterIndex();
+}
+
+template <typename _core_impl>
+constexpr const typename Matrix<_core_impl>::size_type*
+Matrix<_core_impl>::OuterIndex() const {
+  return _m_data.OuterIndex();
+}
+
+template <typename _core_impl>
+constexpr typename Matrix<_core_impl>::size_type*
+Matrix<_core_impl>::InnerIndex() {
+  return _m_data.InnerIndex();
+}
+
+template <typename _core_impl>
+constexpr const typename Matrix<_core_impl>::size_type*
+Matrix<_core_impl>::InnerIndex() const {
+  return _m_data.InnerIndex();
+}
+
+template <typename _core_impl>
+template <typename Matrix<_core_impl>::size_type _block_rows,
+          typename Matrix<_core_impl>::size_type _block_cols>
+constexpr auto Matrix<_core_impl>::Block(const size_type _row,
+                                         const size_type _col) {
+  static_assert(Traits::Core::is_dynamic_v<core_impl> ||
+                    (_block_rows <= rows && _block_cols <= cols),
+                "Error: the block exceeds the matrix dimensions.");
+
+  using view_type = Matrix<Core::MapStrided<std::remove_pointer_t<pointer>,
+                                            _block_rows,
+                                            _block_cols,
+                                            core_major>>;
+  return _m_View<view_type>(*this, _row, _col);
+}
+
+template <typename _core_impl>
+template <typename Matrix<_core_impl>::size_type _block_rows,
+          typename Matrix<_core_impl>::size_type _block_cols>
+constexpr auto Matrix<_core_impl>::Block(const size_type _row,
+                                         const size_type _col) const {
+  static_assert(Traits::Core::is_dynamic_v<core_impl> ||
+                    (_block_rows <= rows && _block_cols <= cols),
+                "Error: the block exceeds the matrix dimensions.");
+
+  using view_type = Matrix<Core::MapStrided<const value_type,
+                                            _block_rows,
+                                            _block_cols,
+                                            core_major>>;
+  return _m_View<view_type>(*this, _row, _col);
+}
+
+template <typename _core_impl>
+template <typename Matrix<_core_impl>::size_type _row,
+          typename Matrix<_core_impl>::size_type _col,
+          typename Matrix<_core_impl>::size_type _block_rows,
+          typename Matrix<_core_impl>::size_type _block_cols>
+constexpr auto Matrix<_core_impl>::Block() {
+  static_assert(Traits::Core::is_dynamic_v<core_impl> ||
+                    (_row + _block_rows <= rows && _col + _block_cols <= cols),
+                "Error: the block exceeds the matrix dimensions.");
+
+  return Block<_block_rows, _block_cols>(_row, _col);
+}
+
+template <typename _core_impl>
+template <typename Matrix<_core_impl>::size_type _row,
+          typename Matrix<_core_impl>::size_type _col,
+          typename Matrix<_core_impl>::size_type _block_rows,
+          typename Matrix<_core_impl>::size_type _block_cols>
+constexpr auto Matrix<_core_impl>::Block() const {
+  static_assert(Traits::Core::is_dynamic_v<core_impl> ||
+                    (_row + _block_rows <= rows && _col + _block_cols <= cols),
+                "Error: the block exceeds the matrix dimensions.");
+
+  return Block<_block_rows, _block_cols>(_row, _col);
+}
+
+template <typename _core_impl>
+constexpr auto Matrix<_core_impl>::Row(const size_type _row) {
+  static_assert(!Traits::Core::is_dynamic_v<core_impl>,
+                "Error: use `Block()` for rows of runtime-sized matrices.");
+
+  return Block<1, cols>(_row, 0);
+}
+
+template <typename _core_impl>
+constexpr auto Matrix<_core_impl>::Row(const size_type _row) const {
+  static_assert(!Traits::Core::is_dynamic_v<core_impl>,
+                "Error: use `Block()` for rows of runtime-sized matrices.");
+
+  return Block<1, cols>(_row, 0);
+}
+
+template <typename _core_impl>
+constexpr auto Matrix<_core_impl>::Col(const size_type _col) {
+  static_assert(!Traits::Core::is_dynamic_v<core_impl>,
+                "Error: use `Block()` for columns of runtime-sized matrices.");
+
+  return Block<rows, 1>(0, _col);
+}
+
+template <typename _core_impl>
+constexpr auto Matrix<_core_impl>::Col(const size_type _col) const {
+  static_assert(!Traits::Core::is_dynamic_v<core_impl>,
+                "Error: use `Block()` for columns of runtime-sized matrices.");
+
+  return Block<rows, 1>(0, _col);
+}
+
 template <typename _core_impl>
 template <typename _expr>
 constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator+=(const _expr& _e) {
@@ -170,20 +485,19 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator+=(const _expr& _e) {
   static_assert(Matrix::rows == _expr::rows && Matrix::cols == _expr::cols,
                 "Error: dimension mismatch.");
 
-  TraverseIndices(
-      [&](std::size_t i, std::size_t j) { (*this)(i, j) += _e(i, j); });
+  // Each element only reads its own position, so no temporary is needed.
+  Expr::Assign(*this, Op::Arthm::Add(*this, _e));
   return (*this);
 }
 
 template <typename _core_impl>
-template <typename _scalar>
+template <typename _scalar, typename>
 constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator*=(
     const _scalar _other) {
   static_assert(std::is_arithmetic_v<_scalar>,
                 "Error: non-integral value passed.");
 
-  TraverseIndices(
-      [&](std::size_t i, std::size_t j) { (*this)(i, j) *= _other; });
+  Expr::Assign(*this, Op::Arthm::Mul(*this, _other));
   return (*this);
 }
 
@@ -195,27 +509,83 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator-=(const _expr& _e) {
   static_assert(Matrix::rows == _expr::rows && Matrix::cols == _expr::cols,
                 "Error: dimension mismatch.");
 
-  return (*this) += -_e;
+  // Subtracts in place, without an intermediate `Neg` node.
+  Expr::Assign(*this, Op::Arthm::Sub(*this, _e));
+  return (*this);
+}
+
+template <typename _core_impl>
+template <typename _expr, bool _enable, typename>
+constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator*=(const _expr& _e) {
+  static_assert(Matrix::cols == _expr::rows && _expr::rows == _expr::cols,
+                "Error: dimension mismatch.");
+
+  // Every result element reads a whole row of `*this`: `Expr::Assign` routes
+  // the product through scratch space.
+  Expr::Assign(*this, Op::Arthm::Mul(*this, _e));
+  return (*this);
+}
+
+template <typename _core_impl>
+constexpr Expr::NoAlias<Matrix<_core_impl>> Matrix<_core_impl>::NoAlias() {
+  return Expr::NoAlias<Matrix>(*this);
 }
 
 template <typename _core_impl>
 void Matrix<_core_impl>::Print() const {
-  for (size_type i = 0; i < Rows(); i++) {
-    for (size_type j = 0; j < Cols(); j++) {
-      std::cout << (*this)(i, j) << ' ';
-    }
-    std::cout << '\n';
-  }
+  IO::WriteText(stdout, *this);
+}
+
+template <typename _core_impl>
+template <typename _view, typename _matrix>
+constexpr _view Matrix<_core_impl>::_m_View(_matrix& _m,
+                                            const size_type _row,
+                                            const size_type _col) {
+  static_assert(core_type == Core::Type::Dense &&
+                    (core_major == Core::Major::Row ||
+                     core_major == Core::Major::Col) &&
+                    Traits::Core::tile_v<core_impl> == 0,
+                "Error: blocks are only available for dense cores stored "
+                "row- or column-major.");
+
+  const size_type ld     = _m.OuterStride();
+  const size_type offset = core_major == Core::Major::Row ? _row * ld + _col
+                                                          : _col * ld + _row;
+  return _view(_m.Data() + offset, ld);
 }
 
 namespace Impl {
 
-template <typename Func>
-constexpr void Traverse(std::size_t rows,
-                        std::size_t cols,
-                        Func&& fn,
-                        Core::Major major) {
-  if (major == Core::Major::Row) {
+template <typename _matrix, typename _core_impl, bool _view>
+template <typename... Args>
+constexpr Storage<_matrix, _core_impl, _view>::Storage(std::in_place_t,
+                                                       Args&&... args)
+    : _m_data(std::forward<Args>(args)...) {}
+
+template <typename _matrix, typename _core_impl>
+constexpr Storage<_matrix, _core_impl, true>&
+Storage<_matrix, _core_impl, true>::operator=(const Storage& _other) {
+  static_assert(!std::is_const_v<
+                    std::remove_reference_t<typename _matrix::reference>>,
+                "Error: a read-only view cannot be assigned to.");
+
+  // As for other sources, a view of the same type is not rebound: its
+  // elements are copied, through a scratch buffer if both overlap.
+  Expr::Assign(static_cast<_matrix&>(*this),
+               static_cast<const _matrix&>(_other));
+
+  return *this;
+}
+
+template <typename _matrix, typename _core_impl>
+constexpr Storage<_matrix, _core_impl, true>&
+Storage<_matrix, _core_impl, true>::operator=(Storage&& _other) {
+  return *this = std::as_const(_other);
+}
+
+template <Core::Major _major, typename Func>
+constexpr void Traverse(std::size_t rows, std::size_t cols, Func&& fn) {
+  if constexpr (_major == Core::Major::Row) {
     for (std::size_t i = 0; i < rows; i++) {
       for (std::size_t j = 0; j < cols; j++) {
         fn(i, j);
@@ -230,16 +600,173 @@ constexpr void Traverse(std::size_t rows,
   }
 }
 
+template <std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _major,
+          typename Func>
+constexpr void TraverseUnrolled(Func&& fn) {
+  Kernel::Unroll<_rows * _cols>([&](auto k) {
+    if constexpr (_major == Core::Major::Row) {
+      fn(std::size_t{k / _cols}, std::size_t{k % _cols});
+    } else {
+      fn(std::size_t{k % _rows}, std::size_t{k / _rows});
+    }
+  });
+}
+
+template <Core::Major _major, std::size_t _tile, typename Func>
+constexpr void TraverseTiled(std::size_t rows, std::size_t cols, Func&& fn) {
+  constexpr bool row = _major == Core::Major::Row;
+
+  const std::size_t outer = row ? rows : cols;
+  const std::size_t inner = row ? cols : rows;
+  for (std::size_t o0 = 0; o0 < outer; o0 += _tile) {
+    const std::size_t o1 = outer - o0 < _tile ? outer : o0 + _tile;
+    for (std::size_t n0 = 0; n0 < inner; n0 += _tile) {
+      const std::size_t n1 = inner - n0 < _tile ? inner : n0 + _tile;
+      for (std::size_t o = o0; o < o1; o++) {
+        for (std::size_t n = n0; n < n1; n++) {
+          if constexpr (row) {
+            fn(o, n);
+          } else {
+            fn(n, o);
+          }
+        }
+      }
+    }
+  }
+}
+
+// Visits the `size` x `size` quadrant at (i0, j0), clipped to `rows` x
+// `cols`: its four quadrants in turn, top-left to bottom-right.
+template <typename Func>
+constexpr void TraverseQuadrant(std::size_t i0,
+                                std::size_t j0,
+                                std::size_t size,
+                                std::size_t rows,
+                                std::size_t cols,
+                                Func& fn) {
+  if (i0 >= rows || j0 >= cols) {
+    return;
+  }
+  if (size == 1) {
+    fn(i0, j0);
+    return;
+  }
+  const std::size_t half = size / 2;
+  TraverseQuadrant(i0, j0, half, rows, cols, fn);
+  TraverseQuadrant(i0, j0 + half, half, rows, cols, fn);
+  TraverseQuadrant(i0 + half, j0, half, rows, cols, fn);
+  TraverseQuadrant(i0 + half, j0 + half, half, rows, cols, fn);
+}
+
+template <typename Func>
+constexpr void TraverseMorton(std::size_t rows, std::size_t cols, Func&& fn) {
+  const std::size_t side = Core::Layout::MortonSide(rows, cols);
+
+  // Blocks follow each other along one extent only.
+  for (std::size_t i0 = 0; i0 < rows; i0 += side) {
+    for (std::size_t j0 = 0; j0 < cols; j0 += side) {
+      TraverseQuadrant(i0, j0, side, rows, cols, fn);
+    }
+  }
+}
+
+template <Core::Major _major, typename PacketFunc, typename ScalarFunc>
+void TraversePacket(std::size_t rows,
+                    std::size_t cols,
+                    std::size_t width,
+                    PacketFunc&& packet_fn,
+                    ScalarFunc&& scalar_fn) {
+  if constexpr (_major == Core::Major::Row) {
+    const std::size_t packet_end = cols - cols % width;
+    for (std::size_t i = 0; i < rows; i++) {
+      for (std::size_t j = 0; j < packet_end; j += width) {
+        packet_fn(i, j);
+      }
+      for (std::size_t j = packet_end; j < cols; j++) {
+        scalar_fn(i, j);
+      }
+    }
+  } else {
+    const std::size_t packet_end = rows - rows % width;
+    for (std::size_t j = 0; j < cols; j++) {
+      for (std::size_t i = 0; i < packet_end; i += width) {
+        packet_fn(i, j);
+      }
+      for (std::size_t i = packet_end; i < rows; i++) {
+        scalar_fn(i, j);
+      }
+    }
+  }
+}
+
+template <std::size_t _lower, std::size_t _upper, typename Func>
+constexpr void TraverseBand(std::size_t rows, std::size_t cols, Func&& fn) {
+  for (std::size_t i = 0; i < rows; i++) {
+    const std::size_t first = i > _lower ? i - _lower : 0;
+    const std::size_t last  = i < cols && _upper < cols - i ? i + _upper + 1
+                                                            : cols;
+    for (std::size_t j = first; j < last; j++) {
+      fn(i, j);
+    }
+  }
+}
+
 }  // namespace Impl
 
 template <typename _core_impl, typename Func>
 constexpr void Traverse(Matrix<_core_impl>& mat, Func&& fn) {
-  Impl::Traverse(mat.Rows(), mat.Cols(), std::forward<Func>(fn), mat.Major());
+  Traverse(std::as_const(mat), std::forward<Func>(fn));
 }
 
 template <typename _core_impl, typename Func>
 constexpr void Traverse(const Matrix<_core_impl>& mat, Func&& fn) {
-  Impl::Traverse(mat.Rows(), mat.Cols(), std::forward<Func>(fn), mat.Major());
+  using matrix_type = Matrix<_core_impl>;
+
+  constexpr auto rows  = matrix_type::rows;
+  constexpr auto cols  = matrix_type::cols;
+  constexpr auto major = matrix_type::core_major;
+
+  // Each extent is checked first so `rows * cols` cannot wrap for `dynamic`.
+  if constexpr (Traits::Core::is_structured_v<_core_impl>) {
+    // Symmetric cores store their upper triangle.
+    constexpr bool symmetric = Traits::Core::is_symmetric_v<_core_impl>;
+
+    Impl::TraverseBand<
+        symmetric ? 0 : Traits::Core::lower_bandwidth_v<_core_impl>,
+        Traits::Core::upper_bandwidth_v<_core_impl>>(
+        mat.Rows(), mat.Cols(), fn);
+  } else if constexpr (major == Core::Major::Morton) {
+    Impl::TraverseMorton(mat.Rows(), mat.Cols(), fn);
+  } else if constexpr (Traits::Core::tile_v<_core_impl> != 0) {
+    // `Tiled` cores order their tiles row-major.
+    constexpr auto order =
+        major == Core::Major::Col ? Core::Major::Col : Core::Major::Row;
+
+    Impl::TraverseTiled<order, Traits::Core::tile_v<_core_impl>>(
+        mat.Rows(), mat.Cols(), fn);
+  } else if constexpr (Traits::Size::is_unrolled_v<rows> &&
+                       Traits::Size::is_unrolled_v<cols> &&
+                       Traits::Size::is_unrolled_v<rows * cols>) {
+    Impl::TraverseUnrolled<rows, cols, major>(fn);
+  } else {
+    Impl::Traverse<major>(mat.Rows(), mat.Cols(), fn);
+  }
+}
+
+template <typename _core_impl, typename PacketFunc, typename ScalarFunc>
+void TraversePacket(Matrix<_core_impl>& mat,
+                    PacketFunc&& packet_fn,
+                    ScalarFunc&& scalar_fn) {
+  using value_type = typename Matrix<_core_impl>::value_type;
+
+  Impl::TraversePacket<Matrix<_core_impl>::core_major>(
+      mat.Rows(),
+      mat.Cols(),
+      Simd::Packet<value_type>::size,
+      std::forward<PacketFunc>(packet_fn),
+      std::forward<ScalarFunc>(scalar_fn));
 }
 
 }  // namespace Sglty::Types
@@ -1,13 +1,58 @@
 #pragma once
 
 #include <type_traits>
+#include <utility>
 
 #include "../Expr/Tag.hpp"
 #include "../Traits/Core.hpp"
 #include "../Traits/Expr.hpp"
 
+namespace Sglty::Expr {
+
+template <typename>
+class NoAlias;
+
+}  // namespace Sglty::Expr
+
 namespace Sglty::Types {
 
+namespace Impl {
+
+// Holds the core of `_matrix`. Owning cores keep their defaulted special
+// members, so a `Matrix` is trivially copyable whenever its core is.
+template <typename _matrix,
+          typename _core_impl,
+          bool = Traits::Core::is_view_v<_core_impl>>
+class Storage {
+ protected:
+  constexpr Storage() = default;
+
+  template <typename... Args>
+  constexpr explicit Storage(std::in_place_t, Args&&... args);
+
+  _core_impl _m_data{};
+};
+
+// Views copy the elements of a view of the same type into their storage
+// when assigned, instead of being rebound to it.
+template <typename _matrix, typename _core_impl>
+class Storage<_matrix, _core_impl, true>
+    : public Storage<_matrix, _core_impl, false> {
+  using _m_base = Storage<_matrix, _core_impl, false>;
+
+ protected:
+  using _m_base::_m_base;
+
+  constexpr Storage()                   = default;
+  constexpr Storage(const Storage&)     = default;
+  constexpr Storage(Storage&&) noexcept = default;
+
+  constexpr Storage& operator=(const Storage& _other);
+  constexpr Storage& operator=(Storage&& _other);
+};
+
+}  // namespace Impl
+
 /**
  * @brief Compile-time matrix wrapper for a core implementation.
  *
@@ -40,7 +85,8 @@ namespace Sglty::Types {
  * @tparam _core_impl The core implementation backing the matrix data.
  */
 template <typename _core_impl>
-class Matrix : public Expr::Tag {
+class Matrix : public Expr::Tag,
+               public Impl::Storage<Matrix<_core_impl>, _core_impl> {
   static_assert(std::is_default_constructible_v<_core_impl>,
                 "Error: `_core_impl` must be default constructible.");
 
@@ -113,9 +159,13 @@ class Matrix : public Expr::Tag {
   using size_traits = typename core_impl::size_traits;
 
   /// Number of rows in the matrix (compile-time constant).
+  ///
+  /// `Sglty::Traits::Size::dynamic` for runtime-sized cores, see `Rows()`.
   constexpr static auto rows = size_traits::rows;
 
   /// Number of columns in the matrix (compile-time constant).
+  ///
+  /// `Sglty::Traits::Size::dynamic` for runtime-sized cores, see `Cols()`.
   constexpr static auto cols = size_traits::cols;
 
   /**
@@ -157,7 +207,11 @@ class Matrix : public Expr::Tag {
   /**
    * @brief Copy-assigns from another Matrix.
    *
-   * Performs a shallow copy of the underlying core.
+   * Performs a shallow copy of the underlying core. Views (see
+   * `Sglty::Traits::Core::is_view_v`) copy the elements of `_other` into the
+   * storage they refer to instead, like every other assignment to a view, so
+   * `m.Row(0) = m.Row(3)` writes the row of `m`. Read-only views cannot be
+   * assigned to.
    *
    * @return Reference to the current Matrix.
    */
@@ -167,11 +221,12 @@ class Matrix : public Expr::Tag {
    * @brief Move-assigns from another Matrix.
    *
    * Moves the underlying core, leaving `_other` in a valid but unspecified
-   * state.
+   * state. Views copy the elements of `_other`, as for the copy-assignment.
+   * `noexcept` whenever the move-assignment of the core is.
    *
    * @return Reference to the current Matrix.
    */
-  constexpr Matrix& operator=(Matrix&& _other) noexcept = default;
+  constexpr Matrix& operator=(Matrix&& _other) = default;
 
   /**
    * @brief Constructs a Matrix from another Matrix with a different core
@@ -182,7 +237,13 @@ class Matrix : public Expr::Tag {
    * type is not the same as the current one.
    *
    * The core implementations must define matching dimensions and compatible
-   * traits for this to compile successfully.
+   * traits for this to compile successfully. If either core is runtime-sized
+   * the check happens at runtime instead: a runtime-sized matrix takes the
+   * shape of `_other`, a fixed-size one throws `std::invalid_argument` on
+   * mismatch.
+   *
+   * Not available for view cores (see `Sglty::Traits::Core::is_view_v`),
+   * which must be constructed over a buffer and assigned to instead.
    *
    * @tparam _core_other The core implementation of the source Matrix.
    * @param _other The source Matrix to copy from.
@@ -216,6 +277,12 @@ class Matrix : public Expr::Tag {
    *
    * Allows assigning between `Matrix` instances backed by different
    * `_core_impl` types, provided they are compatible in dimensions and traits.
+   * Runtime-sized shapes are handled as in the converting constructor. Views
+   * copy the elements of `_other` into the storage they refer to.
+   *
+   * The elements are written straight into the current storage, through a
+   * scratch buffer only if `_other` is a view overlapping it (see
+   * `Sglty::Expr::Aliases`).
    *
    * Enabled only if the other core type is not the same.
    *
@@ -232,7 +299,14 @@ class Matrix : public Expr::Tag {
    * @brief Assigns from a valid expression type.
    *
    * Evaluates the expression and stores the result in the current Matrix.
-   * The expression must satisfy `Sglty::Traits::Expr::is_valid_v`.
+   * The expression must satisfy `Sglty::Traits::Expr::is_valid_v`. A
+   * runtime-sized matrix takes the shape of the expression (see
+   * `Sglty::Expr::Assign`).
+   *
+   * The result is written straight into the current storage unless the
+   * expression reads it in a way that is not element-wise, as in `a = a * b`
+   * or `a = Trp(a)`, which go through a scratch buffer (see
+   * `Sglty::Expr::Aliases`). Use `NoAlias()` to skip that check.
    *
    * Enabled only if `_expr` is a valid expression type.
    *
@@ -278,17 +352,61 @@ class Matrix : public Expr::Tag {
   /**
    * @brief Returns the number of rows in the matrix.
    *
-   * @return The number of rows as a constant expression.
+   * @return The number of rows as a constant expression, or the core's
+   * current row count for runtime-sized cores.
    */
   constexpr size_type Rows() const;
 
   /**
    * @brief Returns the number of columns in the matrix.
    *
-   * @return The number of columns as a constant expression.
+   * @return The number of columns as a constant expression, or the core's
+   * current column count for runtime-sized cores.
    */
   constexpr size_type Cols() const;
 
+  /**
+   * @brief Changes the shape of a runtime-sized matrix.
+   *
+   * Forwards to the core's `Resize()`; element values are not preserved.
+   * Only available when `Sglty::Traits::Core::is_dynamic_v<core_impl>` holds.
+   *
+   * @param _rows The new number of rows.
+   * @param _cols The new number of columns.
+   */
+  void Resize(const size_type _rows, const size_type _cols);
+
+  /**
+   * @brief Passes an access hint for a region of the matrix to its core.
+   *
+   * Forwards to the core's `Advise()`, e.g. to prefetch the tiles of a
+   * `Sglty::Core::Mapped` matrix ahead of reading them. Only available for
+   * cores providing it.
+   *
+   * @param _row    The first row of the region.
+   * @param _col    The first column of the region.
+   * @param _rows   The number of rows of the region.
+   * @param _cols   The number of columns of the region.
+   * @param _advice The hint.
+   */
+  void Advise(const size_type _row,
+              const size_type _col,
+              const size_type _rows,
+              const size_type _cols,
+              const Sglty::Core::Advice _advice) const;
+
+  /**
+   * @brief Returns the distance in elements between consecutive rows
+   * (row-major) or columns (column-major) of the storage behind `Data()`.
+   *
+   * `Sglty::Traits::Core::leading_dim_v<core_impl>` when known at
+   * compile-time, the packed extent for runtime-sized cores, and the core's
+   * `OuterStride()` otherwise.
+   *
+   * @return The leading dimension of the storage.
+   */
+  constexpr size_type OuterStride() const;
+
   /**
    * @brief Returns the core storage type tag.
    *
@@ -323,30 +441,65 @@ class Matrix : public Expr::Tag {
   constexpr Matrix<typename core_impl::core_rebind_value<_Up>> Cast() const;
 
   /**
-   * @brief Reorders the matrix to a different memory layout (row-major or
-   * column-major).
+   * @brief Reorders the matrix to a different memory layout (row-major,
+   * column-major, or one of the blocked `Tiled` and `Morton` layouts).
    *
    * Rebinds the core implementation to use the new memory layout specified
    * by `_major`. Actual layout handling is delegated to the core
-   * implementation.
-   *
-   * @tparam _major The new layout order (row-major or column-major).
+   * implementation. Blocked layouts keep both rows and columns local, e.g.
+   * for products reading one operand across its rows and the other across
+   * its columns:
+   * ```
+   * const auto t = b.Reorder<Sglty::Core::Major::Tiled>();
+   * c = a * Trp(t);
+   * ```
+   *
+   * @tparam _major The new layout order.
    * @return A new Matrix with the reordered layout.
    */
   template <Core::Major _major>
   constexpr Matrix<typename core_impl::core_rebind_major<_major>> Reorder()
       const;
 
+  /**
+   * @brief Transposes the matrix in place.
+   *
+   * Square dense matrices swap mirrored blocks without a temporary (see
+   * `Sglty::Kernel::TransposeInPlace`); `a = Trp(a)` does the same.
+   * Structured matrices must be their own transpose type: symmetric ones
+   * are left as they are, banded ones swap within the band.
+   * Non-square runtime-sized matrices and sparse matrices are rebuilt from
+   * `Trp(*this)` through a temporary. Fixed-size matrices must be square.
+   */
+  constexpr void TransposeInPlace();
+
   /**
    * @brief Returns a zero-initialized matrix.
    *
    * Constructs a matrix of the same type and size with all elements set to
    * zero. The implementation is handled manually by the `Matrix` class.
    *
+   * Sparse matrices are returned without stored entries. Not available for
+   * views, nor for runtime-sized matrices, which have no shape to take: use
+   * `Zero(rows, cols)`, or `Sglty::Zero()`, which takes the shape of the
+   * other operand.
+   *
    * @return A zero matrix.
    */
   constexpr static Matrix Zero();
 
+  /**
+   * @brief Returns a zero-initialized runtime-sized matrix of the given
+   * shape.
+   *
+   * Only available for runtime-sized cores constructible from a shape.
+   *
+   * @param _rows The number of rows.
+   * @param _cols The number of columns.
+   * @return A zero matrix of `_rows` x `_cols`.
+   */
+  constexpr static Matrix Zero(const size_type _rows, const size_type _cols);
+
   /**
    * @brief Returns the identity matrix.
    *
@@ -354,10 +507,26 @@ class Matrix : public Expr::Tag {
    * are one and all others are zero. The implementation is handled manually.
    *
    * Only meaningful for square matrices — compiler error otherwise.
+   * Fixed-size non-sparse matrices get a `Matrix<Core::Identity>`, which
+   * stores nothing and converts to this type on assignment; products with
+   * it cost one multiply per element. Sparse matrices are returned with
+   * their diagonal stored. Not available for views of these, nor for
+   * runtime-sized matrices: use `Identity(size)`, or `Sglty::Identity()`,
+   * which takes the shape of the other operand.
    *
    * @return An identity matrix.
    */
-  constexpr static Matrix Identity();
+  constexpr static auto Identity();
+
+  /**
+   * @brief Returns a runtime-sized identity matrix of `_size` x `_size`.
+   *
+   * Only available for runtime-sized cores constructible from a shape.
+   *
+   * @param _size The number of rows and columns.
+   * @return An identity matrix of `_size` x `_size`.
+   */
+  constexpr static Matrix Identity(const size_type _size);
 
   /**
    * @brief Accesses a mutable element at the specified position.
@@ -378,6 +547,201 @@ class Matrix : public Expr::Tag {
   constexpr const_reference operator()(const size_type _row,
                                        const size_type _col) const;
 
+  /**
+   * @brief Returns a raw pointer to the core's underlying storage.
+   *
+   * The meaning of the layout is defined by the core (see `core_traits`).
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the core's underlying storage.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  constexpr const_pointer Data() const;
+
+  /**
+   * @brief Loads a SIMD packet starting at the specified position.
+   *
+   * Forwards to the core's `LoadPacket()`, only usable when
+   * `Sglty::Traits::Core::has_packet_access_v<core_impl>` holds.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return The packet of consecutive elements along the major axis.
+   */
+  auto Packet(const size_type _row, const size_type _col) const;
+
+  /**
+   * @brief Stores a SIMD packet starting at the specified position.
+   *
+   * Forwards to the core's `StorePacket()`, only usable when
+   * `Sglty::Traits::Core::has_packet_access_v<core_impl>` holds.
+   *
+   * @tparam _packet The packet type.
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @param _p   The packet to store.
+   */
+  template <typename _packet>
+  void StorePacket(const size_type _row,
+                   const size_type _col,
+                   const _packet& _p);
+
+  /**
+   * @brief Returns the number of explicitly stored entries.
+   *
+   * Forwards to the core's `NonZeros()`, only usable when
+   * `Sglty::Traits::Core::is_sparse_v<core_impl>` holds.
+   */
+  constexpr size_type NonZeros() const;
+
+  /**
+   * @brief Returns the compressed offsets of the core.
+   *
+   * Forwards to the core's `OuterIndex()`, only usable when
+   * `Sglty::Traits::Core::is_sparse_v<core_impl>` holds.
+   *
+   * @return Mutable pointer to the first offset.
+   */
+  constexpr size_type* OuterIndex();
+
+  /**
+   * @brief Returns the compressed offsets of the core.
+   *
+   * @return Const pointer to the first offset.
+   */
+  constexpr const size_type* OuterIndex() const;
+
+  /**
+   * @brief Returns the inner indices of the stored entries.
+   *
+   * Forwards to the core's `InnerIndex()`, only usable when
+   * `Sglty::Traits::Core::is_sparse_v<core_impl>` holds.
+   *
+   * @return Mutable pointer to the first inner index.
+   */
+  constexpr size_type* InnerIndex();
+
+  /**
+   * @brief Returns the inner indices of the stored entries.
+   *
+   * @return Const pointer to the first inner index.
+   */
+  constexpr const size_type* InnerIndex() const;
+
+  /**
+   * @brief Returns a writable view of a `_block_rows` x `_block_cols`
+   * sub-matrix starting at (_row, _col).
+   *
+   * The view is a `Matrix<Core::MapStrided<...>>` over `Data()` with this
+   * matrix's `OuterStride()`, so it is usable both as an expression operand
+   * and as an assignment target, and refers to this matrix's elements:
+   * ```
+   * m.Block<2, 2>(1, 1) = a * b;
+   * m.Block<2, 2>(1, 1) += c;
+   * m.Block<2, 2>(0, 0) = m.Block<2, 2>(1, 1);  // copies the elements
+   * ```
+   * The view is invalidated by anything that invalidates `Data()`. Only
+   * available for dense cores stored row- or column-major (not tiled cores,
+   * see `Sglty::Traits::Core::tile_v`); offsets are not checked at runtime.
+   *
+   * @tparam _block_rows Number of rows of the block.
+   * @tparam _block_cols Number of columns of the block.
+   * @param _row Row of the top-left element (zero-based).
+   * @param _col Column of the top-left element (zero-based).
+   * @return A view of the block.
+   */
+  template <size_type _block_rows, size_type _block_cols>
+  constexpr auto Block(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Returns a read-only view of a `_block_rows` x `_block_cols`
+   * sub-matrix starting at (_row, _col).
+   *
+   * @tparam _block_rows Number of rows of the block.
+   * @tparam _block_cols Number of columns of the block.
+   * @param _row Row of the top-left element (zero-based).
+   * @param _col Column of the top-left element (zero-based).
+   * @return A read-only view of the block.
+   */
+  template <size_type _block_rows, size_type _block_cols>
+  constexpr auto Block(const size_type _row, const size_type _col) const;
+
+  /**
+   * @brief Returns a writable view of a sub-matrix at a compile-time offset.
+   *
+   * Same as the runtime-offset overload, with the block's bounds checked at
+   * compile-time for fixed-size matrices.
+   *
+   * @tparam _row        Row of the top-left element (zero-based).
+   * @tparam _col        Column of the top-left element (zero-based).
+   * @tparam _block_rows Number of rows of the block.
+   * @tparam _block_cols Number of columns of the block.
+   * @return A view of the block.
+   */
+  template <size_type _row,
+            size_type _col,
+            size_type _block_rows,
+            size_type _block_cols>
+  constexpr auto Block();
+
+  /**
+   * @brief Returns a read-only view of a sub-matrix at a compile-time offset.
+   *
+   * @tparam _row        Row of the top-left element (zero-based).
+   * @tparam _col        Column of the top-left element (zero-based).
+   * @tparam _block_rows Number of rows of the block.
+   * @tparam _block_cols Number of columns of the block.
+   * @return A read-only view of the block.
+   */
+  template <size_type _row,
+            size_type _col,
+            size_type _block_rows,
+            size_type _block_cols>
+  constexpr auto Block() const;
+
+  /**
+   * @brief Returns a writable 1 x `cols` view of row `_row`.
+   *
+   * Shorthand for `Block<1, cols>(_row, 0)`, only available for fixed-size
+   * matrices.
+   *
+   * @param _row The row index (zero-based).
+   * @return A view of the row.
+   */
+  constexpr auto Row(const size_type _row);
+
+  /**
+   * @brief Returns a read-only 1 x `cols` view of row `_row`.
+   *
+   * @param _row The row index (zero-based).
+   * @return A read-only view of the row.
+   */
+  constexpr auto Row(const size_type _row) const;
+
+  /**
+   * @brief Returns a writable `rows` x 1 view of column `_col`.
+   *
+   * Shorthand for `Block<rows, 1>(0, _col)`, only available for fixed-size
+   * matrices.
+   *
+   * @param _col The column index (zero-based).
+   * @return A view of the column.
+   */
+  constexpr auto Col(const size_type _col);
+
+  /**
+   * @brief Returns a read-only `rows` x 1 view of column `_col`.
+   *
+   * @param _col The column index (zero-based).
+   * @return A read-only view of the column.
+   */
+  constexpr auto Col(const size_type _col) const;
+
   /**
    * @brief Adds a valid expression to the matrix.
    *
@@ -401,9 +765,28 @@ class Matrix : public Expr::Tag {
    * @param _other The scalar value to multiply.
    * @return Reference to the current matrix after scaling.
    */
-  template <typename _scalar>
+  template <typename _scalar,
+            typename = std::enable_if_t<std::is_arithmetic_v<_scalar>>>
   constexpr Matrix& operator*=(const _scalar _other);
 
+  /**
+   * @brief Multiplies the matrix from the right by a square expression.
+   *
+   * Equivalent to `*this = *this * _e`; since every result element reads a
+   * whole row of the current matrix, the product is computed into scratch
+   * space first.
+   *
+   * Enabled only if `_expr` is a valid expression type.
+   *
+   * @tparam _expr The expression type. Must be `cols` x `cols`.
+   * @param _e The right-hand side of the product.
+   * @return Reference to the current matrix after modification.
+   */
+  template <typename _expr,
+            bool _enable = Traits::Expr::is_valid_v<std::decay_t<_expr>>,
+            typename     = std::enable_if_t<_enable>>
+  constexpr Matrix& operator*=(const _expr& _e);
+
   /**
    * @brief Subtracts a valid expression from the matrix.
    *
@@ -417,18 +800,86 @@ class Matrix : public Expr::Tag {
   template <typename _expr>
   constexpr Matrix& operator-=(const _expr& _e);
 
+  /**
+   * @brief Returns a proxy whose assignments skip the aliasing check.
+   *
+   * `m.NoAlias() = e` evaluates `e` straight into the storage of `m`; the
+   * caller promises that `e` does not read `m` other than element-wise. See
+   * `Sglty::Expr::NoAlias`.
+   *
+   * @return An assignment proxy referring to the current matrix.
+   */
+  constexpr Expr::NoAlias<Matrix> NoAlias();
+
   // temporary for tests
   void Print() const;
 
  private:
-  core_impl _m_data{};
+  using _m_storage = Impl::Storage<Matrix, core_impl>;
+
+  template <typename, typename, bool>
+  friend class Impl::Storage;
+
+  using _m_storage::_m_data;
+
+  template <typename _view, typename _matrix>
+  static constexpr _view _m_View(_matrix& _m,
+                                 const size_type _row,
+                                 const size_type _col);
 };
 
+namespace Impl {
+
+// Index-based traversal of a `rows` x `cols` range in `_major` order, shared
+// by the public overloads below and by panels of a parallel evaluation.
+template <Core::Major _major, typename Func>
+constexpr void Traverse(std::size_t rows, std::size_t cols, Func&& fn);
+
+// Fully unrolled traversal of a fixed `_rows` x `_cols` range in `_major`
+// order, used for shapes selected by `Traits::Size::is_unrolled_v`.
+template <std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _major,
+          typename Func>
+constexpr void TraverseUnrolled(Func&& fn);
+
+// Traversal of a `rows` x `cols` range in `_tile` x `_tile` tiles, tiles
+// and the elements within each in `_major` (`Row` or `Col`) order: the
+// storage order of a tiled core (see `Traits::Core::tile_v`).
+template <Core::Major _major, std::size_t _tile, typename Func>
+constexpr void TraverseTiled(std::size_t rows, std::size_t cols, Func&& fn);
+
+// Traversal of a `rows` x `cols` range in Z-order, the storage order of a
+// `Major::Morton` core (see `Core::Layout`).
+template <typename Func>
+constexpr void TraverseMorton(std::size_t rows, std::size_t cols, Func&& fn);
+
+// Row-major traversal of the positions of a `rows` x `cols` range within
+// `_lower` diagonals below and `_upper` above the main one, the stored
+// elements of a structured core.
+template <std::size_t _lower, std::size_t _upper, typename Func>
+constexpr void TraverseBand(std::size_t rows, std::size_t cols, Func&& fn);
+
+template <Core::Major _major, typename PacketFunc, typename ScalarFunc>
+void TraversePacket(std::size_t rows,
+                    std::size_t cols,
+                    std::size_t width,
+                    PacketFunc&& packet_fn,
+                    ScalarFunc&& scalar_fn);
+
+}  // namespace Impl
+
 /**
  * @brief Applies a function to each element in the matrix (mutable version).
  *
- * Iterates over the matrix in row-major order and applies `fn` to each
- * element reference. The function must accept a single reference argument.
+ * Visits every position `(i, j)` in the storage order of the matrix's
+ * `core_major` and calls `fn(i, j)`; tiled cores are visited tile by tile
+ * (see `Sglty::Traits::Core::tile_v`) and `Morton` cores in Z-order, so
+ * elements are always reached in memory order. The order is chosen at
+ * compile time; fixed shapes with at most `SGLTY_UNROLL_LIMIT` elements are
+ * fully unrolled. Structured cores (see
+ * `Sglty::Traits::Core::is_structured_v`) visit only the elements they store,
+ * row by row: the band, or the upper triangle of symmetric cores.
  *
  * @tparam _core_impl The core implementation backing the Matrix.
  * @tparam Func The callable type accepting `reference`.
@@ -441,8 +892,7 @@ constexpr void Traverse(Matrix<_core_impl>& mat, Func&& fn);
 /**
  * @brief Applies a function to each element in the matrix (const version).
  *
- * Iterates over the matrix in row-major order and applies `fn` to each
- * element as a const reference. The function must accept a const reference.
+ * Same traversal order and unrolling as the mutable version.
  *
  * @tparam _core_impl The core implementation backing the Matrix.
  * @tparam Func The callable type accepting `const_reference`.
@@ -452,6 +902,26 @@ constexpr void Traverse(Matrix<_core_impl>& mat, Func&& fn);
 template <typename _core_impl, typename Func>
 constexpr void Traverse(const Matrix<_core_impl>& mat, Func&& fn);
 
+/**
+ * @brief Applies packet and scalar functions along the matrix's major axis.
+ *
+ * Each row (row-major) or column (column-major) is split into as many
+ * `Simd::Packet<value_type>::size` element chunks as fit; `packet_fn(i, j)` is
+ * called once per chunk with the position of its first element, and
+ * `scalar_fn(i, j)` is called for each remaining element of the tail.
+ *
+ * @tparam _core_impl The core implementation backing the Matrix.
+ * @tparam PacketFunc The callable type accepting the start of a chunk.
+ * @tparam ScalarFunc The callable type accepting a single position.
+ * @param mat The matrix to traverse.
+ * @param packet_fn The function to apply to each full chunk.
+ * @param scalar_fn The function to apply to each tail element.
+ */
+template <typename _core_impl, typename PacketFunc, typename ScalarFunc>
+void TraversePacket(Matrix<_core_impl>& mat,
+                    PacketFunc&& packet_fn,
+                    ScalarFunc&& scalar_fn);
+
 }  // namespace Sglty::Types
 
 #include "Impl/Matrix.tpp"
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Sglty::Bench {
+
+/**
+ * @brief Describes one benchmark case.
+ *
+ * `flops` and `bytes` are the work done by one run of the body and drive the
+ * reported GFLOP/s, GB/s and bytes per element. `bytes` counts every operand
+ * element read and every destination element written once, i.e. the traffic
+ * of a perfectly blocked evaluation.
+ */
+struct Info {
+  std::string op;
+  std::string core;
+  std::string type;
+  std::string major;
+  std::size_t rows  = 0;
+  std::size_t cols  = 0;
+  std::size_t depth = 1;
+  double flops      = 0;
+  double bytes      = 0;
+
+  /**
+   * @brief Returns `op/core/type/major/rowsxcols/d<depth>`, the key used to
+   * filter cases and to match them between two JSON reports.
+   */
+  std::string Name() const;
+};
+
+/**
+ * @brief One measured case.
+ */
+struct Result {
+  Info info;
+  std::size_t iterations = 0;
+  double seconds         = 0;  ///< Best time of one run of the body.
+};
+
+/**
+ * @brief A case body, run once per iteration.
+ */
+using Body = std::function<void()>;
+
+/**
+ * @brief Allocates and fills a case's operands, returns its body.
+ *
+ * Runs only when the case is selected, so registering every case does not
+ * keep every operand alive at once.
+ */
+using Setup = std::function<Body()>;
+
+/**
+ * @brief Options read from the command line.
+ */
+struct Options {
+  std::string filter;       ///< Substring a case name must contain.
+  std::string json;         ///< File the JSON report is written to.
+  double min_time = 0.1;    ///< Seconds each repetition must run at least.
+  std::size_t reps = 3;     ///< Repetitions, the fastest one is reported.
+  bool parallel    = false; ///< Keep the default executor instead of Serial.
+  bool list        = false; ///< Print the selected names and exit.
+};
+
+/**
+ * @brief Collects cases and runs them.
+ */
+class Registry {
+ public:
+  /**
+   * @brief Adds a case.
+   */
+  void Add(Info _info, Setup _setup);
+
+  /**
+   * @brief Runs every case whose name contains `_opts.filter`.
+   *
+   * Each repetition doubles the iteration count until it runs for at least
+   * `_opts.min_time`; the fastest repetition is kept.
+   */
+  std::vector<Result> Run(const Options& _opts) const;
+
+ private:
+  std::vector<std::pair<Info, Setup>> _m_cases;
+};
+
+/**
+ * @brief Parses `--filter=`, `--json=`, `--min-time=`, `--reps=`,
+ * `--parallel` and `--list`.
+ *
+ * @throws std::invalid_argument on an unknown argument.
+ */
+Options ParseArgs(int argc, char** argv);
+
+/**
+ * @brief Writes `_results` as JSON, including the build configuration.
+ *
+ * The `benchmarks` array has one object per case, keyed by `name`, so two
+ * reports can be diffed with `bench/Compare.py`.
+ */
+void WriteJson(const std::string& _path, const std::vector<Result>& _results);
+
+/**
+ * @brief Keeps the compiler from discarding `_value` or the stores into it.
+ */
+template <typename _Tp>
+void Consume(const _Tp& _value);
+
+}  // namespace Sglty::Bench
+
+#include "Impl/Bench.tpp"
+
+// bench/Bench.hpp
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+"""Compares two JSON reports written by sglty_bench or sglty_bench_compile.
+
+    Compare.py baseline.json current.json [--threshold=0.05]
+
+Cases are matched by name. Prints the time ratio current / baseline of every
+case present in both, and exits with status 1 if any case got slower by more
+than the threshold (5% by default).
+"""
+
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        return {b["name"]: b for b in json.load(f)["benchmarks"]}
+
+
+def main(argv):
+    threshold = 0.05
+    paths = []
+    for arg in argv[1:]:
+        if arg.startswith("--threshold="):
+            threshold = float(arg[len("--threshold="):])
+        else:
+            paths.append(arg)
+    if len(paths) != 2:
+        sys.exit(__doc__)
+
+    base, curr = load(paths[0]), load(paths[1])
+    regressions = 0
+    for name in sorted(base.keys() & curr.keys()):
+        ratio = curr[name]["seconds"] / base[name]["seconds"]
+        mark = ""
+        if ratio > 1 + threshold:
+            mark = "  slower"
+            regressions += 1
+        elif ratio < 1 - threshold:
+            mark = "  faster"
+        print(f"{name:<52} {ratio:8.3f}{mark}")
+
+    for name in sorted(base.keys() - curr.keys()):
+        print(f"{name:<52}  removed")
+    for name in sorted(curr.keys() - base.keys()):
+        print(f"{name:<52}  added")
+
+    print(f"{regressions} case(s) slower by more than {threshold:.0%}")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
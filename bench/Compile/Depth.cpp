@@ -0,0 +1,43 @@
+// Compiled by `sglty_bench_compile` with `SGLTY_BENCH_DEPTH` set to each depth
+// it measures; not part of any target itself.
+
+#include <cstddef>
+
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Lib.hpp"
+
+#ifndef SGLTY_BENCH_DEPTH
+#define SGLTY_BENCH_DEPTH 8
+#endif
+
+using Mat = Sglty::DenseMat<float, 4, 4>;
+
+/**
+ * @brief Builds `_depth` nested nodes, cycling through `+`, `Trp(.) -`,
+ * scalar `*` and, every fourth level, a matrix product.
+ */
+template <std::size_t _depth>
+auto Chain(const Mat& _a, const Mat& _b) {
+  using Sglty::Op::Alg::Trp;
+
+  if constexpr (_depth == 0) {
+    return Mat(_a);
+  } else if constexpr (_depth % 4 == 1) {
+    return Chain<_depth - 1>(_a, _b) + _b;
+  } else if constexpr (_depth % 4 == 2) {
+    return Trp(Chain<_depth - 1>(_a, _b)) - _a;
+  } else if constexpr (_depth % 4 == 3) {
+    return Chain<_depth - 1>(_a, _b) * 2.f;
+  } else {
+    return Chain<_depth - 1>(_a, _b) * _a;
+  }
+}
+
+int main() {
+  const Mat a(1.f);
+  const Mat b(2.f);
+  const Mat r = Chain<SGLTY_BENCH_DEPTH>(a, b);
+  return r(0, 0) > 0 ? 0 : 1;
+}
+
+// bench/Compile/Depth.cpp
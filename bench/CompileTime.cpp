@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Bench.hpp"
+
+#ifndef SGLTY_BENCH_CXX
+#define SGLTY_BENCH_CXX "c++"
+#endif
+
+#ifndef SGLTY_BENCH_INCLUDE
+#define SGLTY_BENCH_INCLUDE "."
+#endif
+
+#ifndef SGLTY_BENCH_SOURCE
+#define SGLTY_BENCH_SOURCE "Compile/Depth.cpp"
+#endif
+
+namespace {
+
+using namespace Sglty;
+
+/// Wall time of one compiler run, in seconds.
+double Compile(const std::string& _flags, std::size_t _depth) {
+  const std::string command = std::string("\"") + SGLTY_BENCH_CXX +
+                              "\" -std=c++17 " + _flags + " -I\"" +
+                              SGLTY_BENCH_INCLUDE + "\" -DSGLTY_BENCH_DEPTH=" +
+                              std::to_string(_depth) + " \"" +
+                              SGLTY_BENCH_SOURCE + "\"";
+
+  const auto start = std::chrono::steady_clock::now();
+  if (std::system(command.c_str()) != 0) {
+    throw std::runtime_error("Error: `" + command + "` failed.");
+  }
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+}  // namespace
+
+/**
+ * Times compiling `Compile/Depth.cpp` at expression depths 1 to 64, once
+ * front-end only (`Compile:syntax`) and once to an optimized object file
+ * (`Compile:object`). Takes the same arguments as `sglty_bench`; `--min-time`
+ * is ignored and the fastest of `--reps` runs is reported.
+ */
+int main(int argc, char** argv) {
+  try {
+    const Bench::Options opts = Bench::ParseArgs(argc, argv);
+
+    const std::pair<const char*, const char*> modes[] = {
+        {"Compile:syntax", "-fsyntax-only"},
+        {"Compile:object", "-O2 -c -o /dev/null"}};
+
+    std::vector<Bench::Result> results;
+    for (const auto& [op, flags] : modes) {
+      for (std::size_t depth = 1; depth <= 64; depth *= 2) {
+        Bench::Result result{
+            Bench::Info{op, "Dense", "float", "Row", 4, 4, depth, 0, 0},
+            opts.reps,
+            std::numeric_limits<double>::infinity()};
+
+        const std::string name = result.info.Name();
+        if (name.find(opts.filter) == std::string::npos) continue;
+        if (opts.list) {
+          std::printf("%s\n", name.c_str());
+          continue;
+        }
+
+        for (std::size_t rep = 0; rep < opts.reps; rep++) {
+          result.seconds = std::min(result.seconds, Compile(flags, depth));
+        }
+        std::printf("%-52s %12.3f s\n", name.c_str(), result.seconds);
+        std::fflush(stdout);
+        results.push_back(result);
+      }
+    }
+
+    if (!opts.json.empty()) Bench::WriteJson(opts.json, results);
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
+
+// bench/CompileTime.cpp
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "../Bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Singularity/Config.hpp"
+
+namespace Sglty::Bench {
+
+namespace Impl {
+
+inline double PerSecond(double _amount, double _seconds) {
+  return _seconds > 0 ? _amount / _seconds : 0;
+}
+
+inline double BytesPerElement(const Info& _info) {
+  const double elements = double(_info.rows) * double(_info.cols);
+  return elements > 0 ? _info.bytes / elements : 0;
+}
+
+inline std::string Escape(const std::string& _str) {
+  std::string out;
+  for (const char c : _str) {
+    if (c == '"' || c == '\\') out += '\\';
+    out += c;
+  }
+  return out;
+}
+
+inline double Measure(const Body& _body, std::size_t _iterations) {
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < _iterations; i++) _body();
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+}  // namespace Impl
+
+inline std::string Info::Name() const {
+  return op + '/' + core + '/' + type + '/' + major + '/' +
+         std::to_string(rows) + 'x' + std::to_string(cols) + "/d" +
+         std::to_string(depth);
+}
+
+inline void Registry::Add(Info _info, Setup _setup) {
+  _m_cases.emplace_back(std::move(_info), std::move(_setup));
+}
+
+inline std::vector<Result> Registry::Run(const Options& _opts) const {
+  std::vector<Result> results;
+
+  for (const auto& [info, setup] : _m_cases) {
+    const std::string name = info.Name();
+    if (name.find(_opts.filter) == std::string::npos) continue;
+    if (_opts.list) {
+      std::printf("%s\n", name.c_str());
+      continue;
+    }
+
+    const Body body = setup();
+    body();  // warm-up, also faults in the destination
+
+    Result result{info, 0, std::numeric_limits<double>::infinity()};
+    for (std::size_t rep = 0; rep < std::max<std::size_t>(_opts.reps, 1);
+         rep++) {
+      std::size_t iterations = 1;
+      double seconds         = Impl::Measure(body, iterations);
+      while (seconds < _opts.min_time) {
+        iterations *= 2;
+        seconds = Impl::Measure(body, iterations);
+      }
+      if (seconds / iterations < result.seconds) {
+        result.seconds    = seconds / iterations;
+        result.iterations = iterations;
+      }
+    }
+
+    std::printf("%-52s %10zu %12.3f us %9.3f GFLOP/s %9.3f GB/s %6.2f B/el\n",
+                name.c_str(),
+                result.iterations,
+                result.seconds * 1e6,
+                Impl::PerSecond(info.flops, result.seconds) * 1e-9,
+                Impl::PerSecond(info.bytes, result.seconds) * 1e-9,
+                Impl::BytesPerElement(info));
+    std::fflush(stdout);
+    results.push_back(std::move(result));
+  }
+
+  return results;
+}
+
+inline Options ParseArgs(int argc, char** argv) {
+  Options opts;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    std::string value;
+    const auto take       = [&](const std::string& _key, std::string& _out) {
+      if (arg.compare(0, _key.size(), _key) != 0) return false;
+      _out = arg.substr(_key.size());
+      return true;
+    };
+
+    if (take("--filter=", opts.filter) || take("--json=", opts.json)) {
+      continue;
+    } else if (take("--min-time=", value)) {
+      opts.min_time = std::stod(value);
+    } else if (take("--reps=", value)) {
+      opts.reps = std::stoul(value);
+    } else if (arg == "--parallel") {
+      opts.parallel = true;
+    } else if (arg == "--list") {
+      opts.list = true;
+    } else {
+      throw std::invalid_argument("Error: unknown argument `" + arg + "`.");
+    }
+  }
+
+  return opts;
+}
+
+inline void WriteJson(const std::string& _path,
+                      const std::vector<Result>& _results) {
+  std::ofstream out(_path);
+  if (!out) throw std::runtime_error("Error: cannot open `" + _path + "`.");
+
+  const std::time_t now = std::time(nullptr);
+  char date[32]         = {};
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+  out << std::setprecision(9);
+  out << "{\n  \"context\": {\n";
+  out << "    \"date\": \"" << date << "\",\n";
+#if defined(__VERSION__)
+  out << "    \"compiler\": \"" << Impl::Escape(__VERSION__) << "\",\n";
+#endif
+#if defined(NDEBUG)
+  out << "    \"ndebug\": true,\n";
+#else
+  out << "    \"ndebug\": false,\n";
+#endif
+  out << "    \"simd_bytes\": " << SGLTY_SIMD_BYTES << ",\n";
+  out << "    \"fma\": " << SGLTY_FMA << ",\n";
+  out << "    \"parallel_threshold\": " << SGLTY_PARALLEL_THRESHOLD << "\n";
+  out << "  },\n  \"benchmarks\": [";
+
+  for (std::size_t k = 0; k < _results.size(); k++) {
+    const Result& r = _results[k];
+    const Info& i   = r.info;
+    out << (k ? "," : "") << "\n    {";
+    out << "\"name\": \"" << Impl::Escape(i.Name()) << "\", ";
+    out << "\"op\": \"" << i.op << "\", ";
+    out << "\"core\": \"" << i.core << "\", ";
+    out << "\"type\": \"" << i.type << "\", ";
+    out << "\"major\": \"" << i.major << "\", ";
+    out << "\"rows\": " << i.rows << ", ";
+    out << "\"cols\": " << i.cols << ", ";
+    out << "\"depth\": " << i.depth << ", ";
+    out << "\"iterations\": " << r.iterations << ", ";
+    out << "\"seconds\": " << r.seconds << ", ";
+    out << "\"gflops\": " << Impl::PerSecond(i.flops, r.seconds) * 1e-9
+        << ", ";
+    out << "\"gbytes_per_second\": "
+        << Impl::PerSecond(i.bytes, r.seconds) * 1e-9 << ", ";
+    out << "\"bytes_per_element\": " << Impl::BytesPerElement(i) << "}";
+  }
+
+  out << "\n  ]\n}\n";
+}
+
+template <typename _Tp>
+inline void Consume(const _Tp& _value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r"(&_value) : "memory");
+#else
+  static const void* volatile sink;
+  sink = &_value;
+#endif
+}
+
+}  // namespace Sglty::Bench
+
+// bench/Impl/Bench.tpp
@@ -0,0 +1,350 @@
+#pragma once
+
+#include "../Suite.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "Singularity/Core/Half.hpp"
+#include "Singularity/Expr/Evaluate.hpp"
+#include "Singularity/Lib.hpp"
+#include "Singularity/Op/Alg/Cast.hpp"
+#include "Singularity/Traits/Size.hpp"
+#include "Singularity/Traits/Type.hpp"
+
+namespace Sglty::Bench {
+
+namespace Impl {
+
+template <typename _Tp>
+const char* TypeName() {
+  if constexpr (std::is_same_v<_Tp, float>) {
+    return "float";
+  } else if constexpr (std::is_same_v<_Tp, double>) {
+    return "double";
+  } else if constexpr (std::is_same_v<_Tp, int>) {
+    return "int";
+  } else if constexpr (std::is_same_v<_Tp, Core::BFloat16>) {
+    return "bf16";
+  } else if constexpr (std::is_same_v<_Tp, Core::Float16>) {
+    return "fp16";
+  } else {
+    return "other";
+  }
+}
+
+constexpr const char* MajorName(Core::Major _major) {
+  return _major == Core::Major::Row ? "Row" : "Col";
+}
+
+template <typename _matrix>
+void Fill(_matrix& _m, std::size_t _i, std::size_t _j, int _seed) {
+  using value_type = typename _matrix::value_type;
+  const int v      = int((_i * 7 + _j * 3 + std::size_t(_seed)) % 11) - 5;
+  _m(_i, _j)       = static_cast<value_type>(static_cast<float>(v) / 4);
+}
+
+template <typename _matrix>
+_matrix Make(std::size_t _rows, std::size_t _cols) {
+  if constexpr (_matrix::rows == Traits::Size::dynamic) {
+    return _matrix(_rows, _cols);
+  } else {
+    return _matrix();
+  }
+}
+
+template <std::size_t _depth, typename _lhs, typename _rhs>
+auto AddChain(const _lhs& _l, const _rhs& _r) {
+  if constexpr (_depth == 1) {
+    return _l + _r;
+  } else {
+    return AddChain<_depth - 1>(_l, _r) + _r;
+  }
+}
+
+template <std::size_t _depth, typename _lhs, typename _rhs>
+auto SubChain(const _lhs& _l, const _rhs& _r) {
+  if constexpr (_depth == 1) {
+    return _l - _r;
+  } else {
+    return SubChain<_depth - 1>(_l, _r) - _r;
+  }
+}
+
+/// Two operands and a destination, kept alive by the case body.
+template <typename _lhs, typename _rhs, typename _dst>
+struct State {
+  State(std::size_t _size, int _seed_b)
+      : a(_size, _size, 1), b(_size, _size, _seed_b), c(_size, _size, 0) {}
+
+  _lhs a;
+  _rhs b;
+  _dst c;
+};
+
+template <typename _holder>
+using matrix_t = typename _holder::matrix_type;
+
+template <typename _holder>
+using value_t = typename matrix_t<_holder>::value_type;
+
+template <typename _holder>
+Info Describe(const std::string& _op,
+              const std::string& _core,
+              std::size_t _size,
+              std::size_t _depth,
+              double _flops,
+              double _bytes) {
+  using matrix_type = matrix_t<_holder>;
+  return Info{_op,
+              _core,
+              TypeName<value_t<_holder>>(),
+              MajorName(matrix_type::core_major),
+              _size,
+              _size,
+              _depth,
+              _flops,
+              _bytes};
+}
+
+/// Registers `_op(a, b, c)` over a fresh `State<_lhs, _rhs, _dst>`.
+template <typename _lhs, typename _rhs, typename _dst, typename _fn>
+void AddCase(Registry& _registry,
+             Info _info,
+             std::size_t _size,
+             int _seed_b,
+             _fn _op) {
+  _registry.Add(std::move(_info), [_size, _seed_b, _op] {
+    const auto state =
+        std::make_shared<State<_lhs, _rhs, _dst>>(_size, _seed_b);
+    return Body([state, _op] { _op(*state->a, *state->b, *state->c); });
+  });
+}
+
+template <std::size_t _depth, typename _holder>
+void AddChains(Registry& _registry,
+               const std::string& _core,
+               std::size_t _size) {
+  const double n = double(_size) * double(_size);
+  const double s = sizeof(value_t<_holder>);
+
+  AddCase<_holder, _holder, _holder>(
+      _registry,
+      Describe<_holder>("Add", _core, _size, _depth, n * _depth, 3 * n * s),
+      _size,
+      2,
+      [](const auto& _a, const auto& _b, auto& _c) {
+        _c = AddChain<_depth>(_a, _b);
+        Consume(_c);
+      });
+  AddCase<_holder, _holder, _holder>(
+      _registry,
+      Describe<_holder>("Sub", _core, _size, _depth, n * _depth, 3 * n * s),
+      _size,
+      2,
+      [](const auto& _a, const auto& _b, auto& _c) {
+        _c = SubChain<_depth>(_a, _b);
+        Consume(_c);
+      });
+}
+
+}  // namespace Impl
+
+template <typename _matrix>
+Owned<_matrix>::Owned(std::size_t _rows, std::size_t _cols, int _seed)
+    : _m_matrix(Impl::Make<_matrix>(_rows, _cols)) {
+  for (std::size_t i = 0; i < _rows; i++) {
+    for (std::size_t j = 0; j < _cols; j++) Impl::Fill(_m_matrix, i, j, _seed);
+  }
+}
+
+template <typename _matrix>
+_matrix& Owned<_matrix>::operator*() {
+  return _m_matrix;
+}
+
+template <typename _matrix, std::size_t _pad>
+Mapped<_matrix, _pad>::Mapped(std::size_t _rows, std::size_t _cols, int _seed)
+    : _m_buffer((_matrix::core_major == Core::Major::Row ? _rows : _cols) *
+                ((_matrix::core_major == Core::Major::Row ? _cols : _rows) +
+                 _pad)),
+      _m_matrix(_m_View(_m_buffer.data(),
+                        _matrix::core_major == Core::Major::Row ? _cols
+                                                                : _rows)) {
+  for (std::size_t i = 0; i < _rows; i++) {
+    for (std::size_t j = 0; j < _cols; j++) Impl::Fill(_m_matrix, i, j, _seed);
+  }
+}
+
+template <typename _matrix, std::size_t _pad>
+_matrix& Mapped<_matrix, _pad>::operator*() {
+  return _m_matrix;
+}
+
+template <typename _matrix, std::size_t _pad>
+_matrix Mapped<_matrix, _pad>::_m_View(typename _matrix::value_type* _data,
+                                       std::size_t _inner) {
+  // Views are bound on construction, assigning to one copies elements.
+  if constexpr (_pad == 0) {
+    return _matrix(_data);
+  } else {
+    return _matrix(_data, _inner + _pad);
+  }
+}
+
+template <typename _matrix, std::size_t _band>
+Banded<_matrix, _band>::Banded(std::size_t _rows, std::size_t _cols, int _seed)
+    : _m_matrix(Impl::Make<_matrix>(_rows, _cols)) {
+  // Filled in storage order, so every insertion appends.
+  constexpr bool row = _matrix::core_major == Core::Major::Row;
+  const std::size_t outer = row ? _rows : _cols;
+  const std::size_t inner = row ? _cols : _rows;
+  for (std::size_t o = 0; o < outer; o++) {
+    const std::size_t first = o > _band ? o - _band : 0;
+    for (std::size_t k = first; k < inner && k <= o + _band; k++) {
+      Impl::Fill(_m_matrix, row ? o : k, row ? k : o, _seed);
+    }
+  }
+}
+
+template <typename _matrix, std::size_t _band>
+_matrix& Banded<_matrix, _band>::operator*() {
+  return _m_matrix;
+}
+
+template <typename _holder>
+void AddElementwise(Registry& _registry,
+                    const std::string& _core,
+                    std::size_t _size) {
+  using matrix_type = Impl::matrix_t<_holder>;
+  using value_type  = Impl::value_t<_holder>;
+  using cast_type =
+      std::conditional_t<std::is_same_v<value_type, float>, double, float>;
+  using cast_dst =
+      Owned<Types::Matrix<typename matrix_type::core_impl::
+                              template core_rebind_value<cast_type>>>;
+
+  const double n = double(_size) * double(_size);
+  const double s = sizeof(value_type);
+
+  Impl::AddChains<1, _holder>(_registry, _core, _size);
+  Impl::AddChains<2, _holder>(_registry, _core, _size);
+  Impl::AddChains<4, _holder>(_registry, _core, _size);
+  Impl::AddChains<8, _holder>(_registry, _core, _size);
+
+  Impl::AddCase<_holder, _holder, _holder>(
+      _registry,
+      Impl::Describe<_holder>("Neg", _core, _size, 1, n, 2 * n * s),
+      _size,
+      2,
+      [](const auto& _a, const auto&, auto& _c) {
+        _c = -_a;
+        Consume(_c);
+      });
+  Impl::AddCase<_holder, _holder, _holder>(
+      _registry,
+      Impl::Describe<_holder>("Trp", _core, _size, 1, 0, 2 * n * s),
+      _size,
+      2,
+      [](const auto& _a, const auto&, auto& _c) {
+        _c = Op::Alg::Trp(_a);
+        Consume(_c);
+      });
+  Impl::AddCase<_holder, _holder, _holder>(
+      _registry,
+      Impl::Describe<_holder>("Eql", _core, _size, 1, 0, 2 * n * s),
+      _size,
+      1,
+      [](const auto& _a, const auto& _b, auto&) {
+        const bool equal = _a == _b;
+        Consume(equal);
+      });
+  Impl::AddCase<_holder, _holder, cast_dst>(
+      _registry,
+      Impl::Describe<_holder>(std::string("Cast:") +
+                                  Impl::TypeName<cast_type>(),
+                              _core,
+                              _size,
+                              1,
+                              0,
+                              n * (s + sizeof(cast_type))),
+      _size,
+      2,
+      [](const auto& _a, const auto&, auto& _c) {
+        _c = Op::Alg::Cast<cast_type>(_a);
+        Consume(_c);
+      });
+  Impl::AddCase<_holder, _holder, _holder>(
+      _registry,
+      Impl::Describe<_holder>("Reorder", _core, _size, 1, 0, 2 * n * s),
+      _size,
+      2,
+      [](const auto& _a, const auto&, auto&) {
+        constexpr auto other = matrix_type::core_major == Core::Major::Row
+                                   ? Core::Major::Col
+                                   : Core::Major::Row;
+
+        const auto r = _a.template Reorder<other>();
+        Consume(r);
+      });
+  Impl::AddCase<_holder, _holder, _holder>(
+      _registry,
+      Impl::Describe<_holder>("Evaluate", _core, _size, 1, n, 3 * n * s),
+      _size,
+      2,
+      [](const auto& _a, const auto& _b, auto&) {
+        const auto r = Expr::Evaluate(_a + _b);
+        Consume(r);
+      });
+}
+
+template <typename _lhs, typename _rhs>
+void AddProduct(Registry& _registry,
+                const std::string& _core,
+                std::size_t _size) {
+  const double n = double(_size) * double(_size);
+  const double s = sizeof(Impl::value_t<_rhs>);
+
+  Impl::AddCase<_lhs, _rhs, _rhs>(
+      _registry,
+      Impl::Describe<_lhs>("Mul", _core, _size, 1, 2 * n * _size, 3 * n * s),
+      _size,
+      2,
+      [](const auto& _a, const auto& _b, auto& _c) {
+        _c = _a * _b;
+        Consume(_c);
+      });
+  // The destination grows every run, which would overflow integers.
+  if constexpr (std::is_floating_point_v<
+                    Traits::Type::compute_t<Impl::value_t<_rhs>>>) {
+    Impl::AddCase<_lhs, _rhs, _rhs>(
+        _registry,
+        Impl::Describe<_lhs>(
+            "MulAdd", _core, _size, 1, 2 * n * _size + n, 4 * n * s),
+        _size,
+        2,
+        [](const auto& _a, const auto& _b, auto& _c) {
+          _c += _a * _b;
+          Consume(_c);
+        });
+  }
+  if constexpr (std::is_same_v<_lhs, _rhs>) {
+    Impl::AddCase<_lhs, _rhs, _rhs>(
+        _registry,
+        Impl::Describe<_lhs>(
+            "Mul", _core, _size, 2, 4 * n * _size, 5 * n * s),
+        _size,
+        2,
+        [](const auto& _a, const auto& _b, auto& _c) {
+          _c = _a * _b * _a;
+          Consume(_c);
+        });
+  }
+}
+
+}  // namespace Sglty::Bench
+
+// bench/Impl/Suite.tpp
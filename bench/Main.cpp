@@ -0,0 +1,89 @@
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+
+#include "Bench.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Lib.hpp"
+#include "Suite.hpp"
+
+namespace {
+
+using namespace Sglty;
+using Core::Major;
+
+constexpr std::size_t max_size = 1024;
+
+/// Fixed-size dense cores, instantiated once per size.
+template <typename _Tp, Major _major, std::size_t... _sizes>
+void AddDense(Bench::Registry& _registry) {
+  (Bench::AddElementwise<Bench::Owned<DenseMat<_Tp, _sizes, _sizes, _major>>>(
+       _registry, "Dense", _sizes),
+   ...);
+  (Bench::AddProduct<Bench::Owned<DenseMat<_Tp, _sizes, _sizes, _major>>>(
+       _registry, "Dense", _sizes),
+   ...);
+}
+
+/// Runtime-sized cores, swept from 2x2 to `max_size`.
+template <typename _Tp, Major _major>
+void AddDynamic(Bench::Registry& _registry) {
+  using holder = Bench::Owned<DynamicMat<_Tp, _major>>;
+  for (std::size_t n = 2; n <= max_size; n *= 2) {
+    Bench::AddElementwise<holder>(_registry, "Dynamic", n);
+    Bench::AddProduct<holder>(_registry, "Dynamic", n);
+  }
+}
+
+template <typename _Tp, Major _major>
+void AddCores(Bench::Registry& _registry) {
+  AddDense<_Tp, _major, 2, 4, 8, 16, 32, 64>(_registry);
+  AddDynamic<_Tp, _major>(_registry);
+
+  using aligned = Bench::Owned<DenseAlignedMat<_Tp, 64, 64, _major>>;
+  Bench::AddElementwise<aligned>(_registry, "DenseAligned", 64);
+  Bench::AddProduct<aligned>(_registry, "DenseAligned", 64);
+
+  using heap = Bench::Owned<DenseHeapMat<_Tp, 256, 256, _major>>;
+  Bench::AddElementwise<heap>(_registry, "DenseHeap", 256);
+  Bench::AddProduct<heap>(_registry, "DenseHeap", 256);
+
+  using map = Bench::Mapped<MapMat<_Tp, 64, 64, _major>>;
+  Bench::AddElementwise<map>(_registry, "Map", 64);
+  Bench::AddProduct<map>(_registry, "Map", 64);
+
+  using strided = Bench::Mapped<MapStridedMat<_Tp, 64, 64, _major>, 8>;
+  Bench::AddElementwise<strided>(_registry, "MapStrided", 64);
+  Bench::AddProduct<strided>(_registry, "MapStrided", 64);
+
+  // Five diagonals, i.e. about 2% of the entries of a 256x256 matrix.
+  using sparse = Bench::Banded<SparseMat<_Tp, 256, 256, 256 * 5, _major>, 2>;
+  Bench::AddElementwise<sparse>(_registry, "Sparse", 256);
+  Bench::AddProduct<sparse, heap>(_registry, "Sparse", 256);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  try {
+    const Bench::Options opts = Bench::ParseArgs(argc, argv);
+    if (!opts.parallel) Exec::SetExecutor(Exec::Serial{});
+
+    Bench::Registry registry;
+    AddCores<float, Major::Row>(registry);
+    AddCores<float, Major::Col>(registry);
+    AddCores<double, Major::Row>(registry);
+    AddCores<double, Major::Col>(registry);
+    AddDynamic<int, Major::Row>(registry);
+    AddDynamic<Core::BFloat16, Major::Row>(registry);
+
+    const auto results = registry.Run(opts);
+    if (!opts.json.empty()) Bench::WriteJson(opts.json, results);
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
+
+// bench/Main.cpp
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+namespace Sglty::Bench {
+
+/**
+ * @brief Owns a matrix of any core that constructs its own storage.
+ *
+ * Fixed-size cores are default-constructed, runtime-sized ones from
+ * `(_rows, _cols)`. Every element is filled from `_seed`.
+ *
+ * @tparam _matrix A `Sglty::Types::Matrix<...>`.
+ */
+template <typename _matrix>
+class Owned {
+ public:
+  using matrix_type = _matrix;
+
+  Owned(std::size_t _rows, std::size_t _cols, int _seed);
+  Owned(const Owned&) = delete;
+
+  _matrix& operator*();
+
+ private:
+  _matrix _m_matrix;
+};
+
+/**
+ * @brief Owns a buffer viewed through a `Core::Map` or `Core::MapStrided`.
+ *
+ * @tparam _matrix A `MapMat<...>`, or a `MapStridedMat<...>` when `_pad` is
+ * non-zero.
+ * @tparam _pad Extra elements after each row (column) of a strided view.
+ */
+template <typename _matrix, std::size_t _pad = 0>
+class Mapped {
+ public:
+  using matrix_type = _matrix;
+
+  Mapped(std::size_t _rows, std::size_t _cols, int _seed);
+  Mapped(const Mapped&) = delete;
+
+  _matrix& operator*();
+
+ private:
+  // The view over `_data`, whose rows (or columns) hold `_inner` elements.
+  static _matrix _m_View(typename _matrix::value_type* _data,
+                         std::size_t _inner);
+
+  std::vector<typename _matrix::value_type> _m_buffer;
+  _matrix _m_matrix;
+};
+
+/**
+ * @brief Owns a `Core::Sparse` matrix storing a band around the diagonal.
+ *
+ * @tparam _matrix A `SparseMat<...>` with room for the band.
+ * @tparam _band Number of stored sub- and super-diagonals.
+ */
+template <typename _matrix, std::size_t _band>
+class Banded {
+ public:
+  using matrix_type = _matrix;
+
+  Banded(std::size_t _rows, std::size_t _cols, int _seed);
+  Banded(const Banded&) = delete;
+
+  _matrix& operator*();
+
+ private:
+  _matrix _m_matrix;
+};
+
+/**
+ * @brief Registers the element-wise cases of one square shape.
+ *
+ * `Add` and `Sub` are chains `a + b + b ...` of depth 1, 2, 4 and 8; `Neg`,
+ * `Trp`, `Eql`, `Cast`, `Reorder` and `Evaluate` are depth 1. Results are
+ * assigned into a preallocated destination, except for `Reorder()` and
+ * `Evaluate()`, which return a new matrix.
+ *
+ * @tparam _holder `Owned`, `Mapped` or `Banded`.
+ */
+template <typename _holder>
+void AddElementwise(Registry& _registry,
+                    const std::string& _core,
+                    std::size_t _size);
+
+/**
+ * @brief Registers `c = a * b`, `c = a * b * a` and `c += a * b` for one
+ * square shape.
+ *
+ * @tparam _lhs Holder of `a`.
+ * @tparam _rhs Holder of `b` and of the destination.
+ */
+template <typename _lhs, typename _rhs = _lhs>
+void AddProduct(Registry& _registry,
+                const std::string& _core,
+                std::size_t _size);
+
+}  // namespace Sglty::Bench
+
+#include "Impl/Suite.tpp"
+
+// bench/Suite.hpp